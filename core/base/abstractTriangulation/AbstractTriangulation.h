@@ -13,10 +13,12 @@
 
 // base code includes
 #include <Cache.h>
+#include <FlatJaggedArray.h>
 #include <Geometry.h>
 #include <Wrapper.h>
 
 #include <array>
+#include <numeric>
 #include <ostream>
 #include <unordered_map>
 
@@ -77,6 +79,14 @@ namespace ttk {
     /// \return Returns 0 upon success, negative values otherwise.
     size_t footprint(size_t size = 0) const;
 
+    /// Set the maximum memory footprint (in bytes) of the discrete
+    /// gradients cached on this triangulation. Least recently used
+    /// gradients are evicted above this budget. A zero budget (default)
+    /// only bounds the number of cached gradients.
+    inline void setGradientCacheMemoryBudget(const size_t budget) const {
+      this->gradientCache_.setMemoryBudget(budget);
+    }
+
     /// Get the \p localEdgeId-th edge of the \p cellId-th cell.
     ///
     /// Here the notion of cell refers to the simplicices of maximal
@@ -2559,6 +2569,335 @@ namespace ttk {
       return getCellVTKIDInternal(ttkId, vtkId);
     }
 
+    // Zero-copy adjacency API
+    //
+    // The get*CSR() functions return a whole adjacency relation in
+    // compressed sparse row layout (offsets and flattened identifiers,
+    // see FlatJaggedArray) and the get*Range() functions the list of a
+    // single simplex, as a contiguous view on the same table. Contrary to
+    // the get*s() functions above, no std::vector<std::vector<SimplexId>>
+    // is filled.
+    //
+    // Explicit triangulations return their internal storage. Other
+    // triangulations build the table from the per-simplex queries on the
+    // first get*CSR() call, which is not thread-safe and should happen in
+    // the pre-processing step. get*Range() can then be called concurrently.
+
+    /// Read-only view on the adjacency list of a simplex.
+    using SimplexRange = FlatJaggedArray::Slice;
+
+    /// Get the cell neighbors of all cells as a compressed sparse row table,
+    /// without copy.
+    ///
+    /// \pre preconditionCellNeighbors()
+    /// \return Returns a pointer to the table, nullptr on error.
+    /// \sa getCellNeighborsRange()
+    virtual inline const FlatJaggedArray *getCellNeighborsCSR() {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!hasPreconditionedCellNeighbors())
+        return nullptr;
+#endif
+      return getCellNeighborsCSRInternal();
+    }
+
+    /// Get the cell neighbors of the \p cellId-th cell, without copy.
+    ///
+    /// \pre getCellNeighborsCSR()
+    /// \sa getCellNeighborsCSR()
+    virtual inline SimplexRange
+      getCellNeighborsRange(const SimplexId &cellId) const {
+      return getCellNeighborsRangeInternal(cellId);
+    }
+
+    /// Get the link simplices of all edges as a compressed sparse row table,
+    /// without copy.
+    ///
+    /// \pre preconditionEdgeLinks()
+    /// \return Returns a pointer to the table, nullptr on error.
+    /// \sa getEdgeLinksRange()
+    virtual inline const FlatJaggedArray *getEdgeLinksCSR() {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(getDimensionality() == 1)
+        return nullptr;
+
+      if(!hasPreconditionedEdgeLinks())
+        return nullptr;
+#endif
+      return getEdgeLinksCSRInternal();
+    }
+
+    /// Get the link simplices of the \p edgeId-th edge, without copy.
+    ///
+    /// \pre getEdgeLinksCSR()
+    /// \sa getEdgeLinksCSR()
+    virtual inline SimplexRange
+      getEdgeLinksRange(const SimplexId &edgeId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(getDimensionality() == 1)
+        return {0, nullptr};
+#endif
+      return getEdgeLinksRangeInternal(edgeId);
+    }
+
+    /// Get the star cells of all edges as a compressed sparse row table,
+    /// without copy.
+    ///
+    /// \pre preconditionEdgeStars()
+    /// \return Returns a pointer to the table, nullptr on error.
+    /// \sa getEdgeStarsRange()
+    virtual inline const FlatJaggedArray *getEdgeStarsCSR() {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(getDimensionality() == 1)
+        return nullptr;
+
+      if(!hasPreconditionedEdgeStars())
+        return nullptr;
+#endif
+      return getEdgeStarsCSRInternal();
+    }
+
+    /// Get the star cells of the \p edgeId-th edge, without copy.
+    ///
+    /// \pre getEdgeStarsCSR()
+    /// \sa getEdgeStarsCSR()
+    virtual inline SimplexRange
+      getEdgeStarsRange(const SimplexId &edgeId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(getDimensionality() == 1)
+        return {0, nullptr};
+#endif
+      return getEdgeStarsRangeInternal(edgeId);
+    }
+
+    /// Get the triangles of all edges as a compressed sparse row table, without
+    /// copy.
+    ///
+    /// \pre preconditionEdgeTriangles()
+    /// \return Returns a pointer to the table, nullptr on error.
+    /// \sa getEdgeTrianglesRange()
+    virtual inline const FlatJaggedArray *getEdgeTrianglesCSR() {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(getDimensionality() == 1)
+        return nullptr;
+
+      if(!hasPreconditionedEdgeTriangles())
+        return nullptr;
+#endif
+      if(getDimensionality() == 2)
+        return getEdgeStarsCSR();
+
+      return getEdgeTrianglesCSRInternal();
+    }
+
+    /// Get the triangles of the \p edgeId-th edge, without copy.
+    ///
+    /// \pre getEdgeTrianglesCSR()
+    /// \sa getEdgeTrianglesCSR()
+    virtual inline SimplexRange
+      getEdgeTrianglesRange(const SimplexId &edgeId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(getDimensionality() == 1)
+        return {0, nullptr};
+#endif
+      if(getDimensionality() == 2)
+        return getEdgeStarsRange(edgeId);
+
+      return getEdgeTrianglesRangeInternal(edgeId);
+    }
+
+    /// Get the link simplices of all triangles as a compressed sparse row
+    /// table, without copy.
+    ///
+    /// \pre preconditionTriangleLinks()
+    /// \return Returns a pointer to the table, nullptr on error.
+    /// \sa getTriangleLinksRange()
+    virtual inline const FlatJaggedArray *getTriangleLinksCSR() {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(getDimensionality() != 3)
+        return nullptr;
+
+      if(!hasPreconditionedTriangleLinks())
+        return nullptr;
+#endif
+      return getTriangleLinksCSRInternal();
+    }
+
+    /// Get the link simplices of the \p triangleId-th triangle, without copy.
+    ///
+    /// \pre getTriangleLinksCSR()
+    /// \sa getTriangleLinksCSR()
+    virtual inline SimplexRange
+      getTriangleLinksRange(const SimplexId &triangleId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(getDimensionality() != 3)
+        return {0, nullptr};
+#endif
+      return getTriangleLinksRangeInternal(triangleId);
+    }
+
+    /// Get the star cells of all triangles as a compressed sparse row table,
+    /// without copy.
+    ///
+    /// \pre preconditionTriangleStars()
+    /// \return Returns a pointer to the table, nullptr on error.
+    /// \sa getTriangleStarsRange()
+    virtual inline const FlatJaggedArray *getTriangleStarsCSR() {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(getDimensionality() != 3)
+        return nullptr;
+
+      if(!hasPreconditionedTriangleStars())
+        return nullptr;
+#endif
+      return getTriangleStarsCSRInternal();
+    }
+
+    /// Get the star cells of the \p triangleId-th triangle, without copy.
+    ///
+    /// \pre getTriangleStarsCSR()
+    /// \sa getTriangleStarsCSR()
+    virtual inline SimplexRange
+      getTriangleStarsRange(const SimplexId &triangleId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(getDimensionality() != 3)
+        return {0, nullptr};
+#endif
+      return getTriangleStarsRangeInternal(triangleId);
+    }
+
+    /// Get the edges of all vertices as a compressed sparse row table, without
+    /// copy.
+    ///
+    /// \pre preconditionVertexEdges()
+    /// \return Returns a pointer to the table, nullptr on error.
+    /// \sa getVertexEdgesRange()
+    virtual inline const FlatJaggedArray *getVertexEdgesCSR() {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!hasPreconditionedVertexEdges())
+        return nullptr;
+#endif
+      if(getDimensionality() == 1)
+        return getVertexStarsCSR();
+
+      return getVertexEdgesCSRInternal();
+    }
+
+    /// Get the edges of the \p vertexId-th vertex, without copy.
+    ///
+    /// \pre getVertexEdgesCSR()
+    /// \sa getVertexEdgesCSR()
+    virtual inline SimplexRange
+      getVertexEdgesRange(const SimplexId &vertexId) const {
+      if(getDimensionality() == 1)
+        return getVertexStarsRange(vertexId);
+
+      return getVertexEdgesRangeInternal(vertexId);
+    }
+
+    /// Get the link simplices of all vertices as a compressed sparse row table,
+    /// without copy.
+    ///
+    /// \pre preconditionVertexLinks()
+    /// \return Returns a pointer to the table, nullptr on error.
+    /// \sa getVertexLinksRange()
+    virtual inline const FlatJaggedArray *getVertexLinksCSR() {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!hasPreconditionedVertexLinks())
+        return nullptr;
+#endif
+      return getVertexLinksCSRInternal();
+    }
+
+    /// Get the link simplices of the \p vertexId-th vertex, without copy.
+    ///
+    /// \pre getVertexLinksCSR()
+    /// \sa getVertexLinksCSR()
+    virtual inline SimplexRange
+      getVertexLinksRange(const SimplexId &vertexId) const {
+      return getVertexLinksRangeInternal(vertexId);
+    }
+
+    /// Get the neighbors of all vertices as a compressed sparse row table,
+    /// without copy.
+    ///
+    /// \pre preconditionVertexNeighbors()
+    /// \return Returns a pointer to the table, nullptr on error.
+    /// \sa getVertexNeighborsRange()
+    virtual inline const FlatJaggedArray *getVertexNeighborsCSR() {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!hasPreconditionedVertexNeighbors())
+        return nullptr;
+#endif
+      return getVertexNeighborsCSRInternal();
+    }
+
+    /// Get the neighbors of the \p vertexId-th vertex, without copy.
+    ///
+    /// \pre getVertexNeighborsCSR()
+    /// \sa getVertexNeighborsCSR()
+    virtual inline SimplexRange
+      getVertexNeighborsRange(const SimplexId &vertexId) const {
+      return getVertexNeighborsRangeInternal(vertexId);
+    }
+
+    /// Get the star cells of all vertices as a compressed sparse row table,
+    /// without copy.
+    ///
+    /// \pre preconditionVertexStars()
+    /// \return Returns a pointer to the table, nullptr on error.
+    /// \sa getVertexStarsRange()
+    virtual inline const FlatJaggedArray *getVertexStarsCSR() {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!hasPreconditionedVertexStars())
+        return nullptr;
+#endif
+      return getVertexStarsCSRInternal();
+    }
+
+    /// Get the star cells of the \p vertexId-th vertex, without copy.
+    ///
+    /// \pre getVertexStarsCSR()
+    /// \sa getVertexStarsCSR()
+    virtual inline SimplexRange
+      getVertexStarsRange(const SimplexId &vertexId) const {
+      return getVertexStarsRangeInternal(vertexId);
+    }
+
+    /// Get the triangles of all vertices as a compressed sparse row table,
+    /// without copy.
+    ///
+    /// \pre preconditionVertexTriangles()
+    /// \return Returns a pointer to the table, nullptr on error.
+    /// \sa getVertexTrianglesRange()
+    virtual inline const FlatJaggedArray *getVertexTrianglesCSR() {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(getDimensionality() == 1)
+        return nullptr;
+
+      if(!hasPreconditionedVertexTriangles())
+        return nullptr;
+#endif
+      if(getDimensionality() == 2)
+        return getVertexStarsCSR();
+
+      return getVertexTrianglesCSRInternal();
+    }
+
+    /// Get the triangles of the \p vertexId-th vertex, without copy.
+    ///
+    /// \pre getVertexTrianglesCSR()
+    /// \sa getVertexTrianglesCSR()
+    virtual inline SimplexRange
+      getVertexTrianglesRange(const SimplexId &vertexId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(getDimensionality() == 1)
+        return {0, nullptr};
+#endif
+      if(getDimensionality() == 2)
+        return getVertexStarsRange(vertexId);
+
+      return getVertexTrianglesRangeInternal(vertexId);
+    }
 #ifdef TTK_ENABLE_MPI
 
     // "vtkGhostType" on points & cells
@@ -2934,6 +3273,13 @@ namespace ttk {
       return this->hasPreconditionedDistributedCells_;
     }
 
+    /// Ghost exchanges of the triangulation, whose plans and persistent
+    /// requests are reused across calls (see ttk::exchangeGhostVertices()
+    /// and ttk::getGhostVerticesExchange()).
+    virtual inline GhostExchangeCache &getGhostExchangeCache() const {
+      return this->ghostExchangeCache_;
+    }
+
     inline int getDistributedGlobalCellId(const SimplexId &localCellId,
                                           const int &cellDim,
                                           SimplexId &globalCellId) const {
@@ -3039,6 +3385,245 @@ namespace ttk {
 #endif // TTK_ENABLE_MPI
 
   protected:
+    /// Build a compressed sparse row table from per-simplex queries
+    /// (default implementation of the get*CSRInternal() functions).
+    template <typename numberFunc, typename getFunc>
+    void buildCSR(FlatJaggedArray &csr,
+                  const SimplexId nItems,
+                  const numberFunc &getNumber,
+                  const getFunc &get) const {
+
+      std::vector<SimplexId> offsets(nItems + 1);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+      for(SimplexId i = 0; i < nItems; ++i) {
+        offsets[i + 1] = getNumber(i);
+      }
+      std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+      std::vector<SimplexId> data(offsets.back());
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+      for(SimplexId i = 0; i < nItems; ++i) {
+        const int nb = offsets[i + 1] - offsets[i];
+        for(int j = 0; j < nb; ++j) {
+          get(i, j, data[offsets[i] + j]);
+        }
+      }
+
+      csr.setData(std::move(data), std::move(offsets));
+    }
+
+    virtual inline const FlatJaggedArray *getCellNeighborsCSRInternal() {
+      if(this->cellNeighborCSR_.empty()) {
+        this->buildCSR(
+          this->cellNeighborCSR_, this->getNumberOfCells(),
+          [this](const SimplexId id) {
+            return this->getCellNeighborNumber(id);
+          },
+          [this](const SimplexId id, const int i, SimplexId &out) {
+            this->getCellNeighbor(id, i, out);
+          });
+      }
+      return &this->cellNeighborCSR_;
+    }
+
+    virtual inline SimplexRange
+      getCellNeighborsRangeInternal(const SimplexId &cellId) const {
+      return this->cellNeighborCSR_[cellId];
+    }
+
+    virtual inline const FlatJaggedArray *getEdgeLinksCSRInternal() {
+      if(this->edgeLinkCSR_.empty()) {
+        this->buildCSR(
+          this->edgeLinkCSR_, this->getNumberOfEdges(),
+          [this](const SimplexId id) {
+            return this->getEdgeLinkNumber(id);
+          },
+          [this](const SimplexId id, const int i, SimplexId &out) {
+            this->getEdgeLink(id, i, out);
+          });
+      }
+      return &this->edgeLinkCSR_;
+    }
+
+    virtual inline SimplexRange
+      getEdgeLinksRangeInternal(const SimplexId &edgeId) const {
+      return this->edgeLinkCSR_[edgeId];
+    }
+
+    virtual inline const FlatJaggedArray *getEdgeStarsCSRInternal() {
+      if(this->edgeStarCSR_.empty()) {
+        this->buildCSR(
+          this->edgeStarCSR_, this->getNumberOfEdges(),
+          [this](const SimplexId id) {
+            return this->getEdgeStarNumber(id);
+          },
+          [this](const SimplexId id, const int i, SimplexId &out) {
+            this->getEdgeStar(id, i, out);
+          });
+      }
+      return &this->edgeStarCSR_;
+    }
+
+    virtual inline SimplexRange
+      getEdgeStarsRangeInternal(const SimplexId &edgeId) const {
+      return this->edgeStarCSR_[edgeId];
+    }
+
+    virtual inline const FlatJaggedArray *getEdgeTrianglesCSRInternal() {
+      if(this->edgeTriangleCSR_.empty()) {
+        this->buildCSR(
+          this->edgeTriangleCSR_, this->getNumberOfEdges(),
+          [this](const SimplexId id) {
+            return this->getEdgeTriangleNumber(id);
+          },
+          [this](const SimplexId id, const int i, SimplexId &out) {
+            this->getEdgeTriangle(id, i, out);
+          });
+      }
+      return &this->edgeTriangleCSR_;
+    }
+
+    virtual inline SimplexRange
+      getEdgeTrianglesRangeInternal(const SimplexId &edgeId) const {
+      return this->edgeTriangleCSR_[edgeId];
+    }
+
+    virtual inline const FlatJaggedArray *getTriangleLinksCSRInternal() {
+      if(this->triangleLinkCSR_.empty()) {
+        this->buildCSR(
+          this->triangleLinkCSR_, this->getNumberOfTriangles(),
+          [this](const SimplexId id) {
+            return this->getTriangleLinkNumber(id);
+          },
+          [this](const SimplexId id, const int i, SimplexId &out) {
+            this->getTriangleLink(id, i, out);
+          });
+      }
+      return &this->triangleLinkCSR_;
+    }
+
+    virtual inline SimplexRange
+      getTriangleLinksRangeInternal(const SimplexId &triangleId) const {
+      return this->triangleLinkCSR_[triangleId];
+    }
+
+    virtual inline const FlatJaggedArray *getTriangleStarsCSRInternal() {
+      if(this->triangleStarCSR_.empty()) {
+        this->buildCSR(
+          this->triangleStarCSR_, this->getNumberOfTriangles(),
+          [this](const SimplexId id) {
+            return this->getTriangleStarNumber(id);
+          },
+          [this](const SimplexId id, const int i, SimplexId &out) {
+            this->getTriangleStar(id, i, out);
+          });
+      }
+      return &this->triangleStarCSR_;
+    }
+
+    virtual inline SimplexRange
+      getTriangleStarsRangeInternal(const SimplexId &triangleId) const {
+      return this->triangleStarCSR_[triangleId];
+    }
+
+    virtual inline const FlatJaggedArray *getVertexEdgesCSRInternal() {
+      if(this->vertexEdgeCSR_.empty()) {
+        this->buildCSR(
+          this->vertexEdgeCSR_, this->getNumberOfVertices(),
+          [this](const SimplexId id) {
+            return this->getVertexEdgeNumber(id);
+          },
+          [this](const SimplexId id, const int i, SimplexId &out) {
+            this->getVertexEdge(id, i, out);
+          });
+      }
+      return &this->vertexEdgeCSR_;
+    }
+
+    virtual inline SimplexRange
+      getVertexEdgesRangeInternal(const SimplexId &vertexId) const {
+      return this->vertexEdgeCSR_[vertexId];
+    }
+
+    virtual inline const FlatJaggedArray *getVertexLinksCSRInternal() {
+      if(this->vertexLinkCSR_.empty()) {
+        this->buildCSR(
+          this->vertexLinkCSR_, this->getNumberOfVertices(),
+          [this](const SimplexId id) {
+            return this->getVertexLinkNumber(id);
+          },
+          [this](const SimplexId id, const int i, SimplexId &out) {
+            this->getVertexLink(id, i, out);
+          });
+      }
+      return &this->vertexLinkCSR_;
+    }
+
+    virtual inline SimplexRange
+      getVertexLinksRangeInternal(const SimplexId &vertexId) const {
+      return this->vertexLinkCSR_[vertexId];
+    }
+
+    virtual inline const FlatJaggedArray *getVertexNeighborsCSRInternal() {
+      if(this->vertexNeighborCSR_.empty()) {
+        this->buildCSR(
+          this->vertexNeighborCSR_, this->getNumberOfVertices(),
+          [this](const SimplexId id) {
+            return this->getVertexNeighborNumber(id);
+          },
+          [this](const SimplexId id, const int i, SimplexId &out) {
+            this->getVertexNeighbor(id, i, out);
+          });
+      }
+      return &this->vertexNeighborCSR_;
+    }
+
+    virtual inline SimplexRange
+      getVertexNeighborsRangeInternal(const SimplexId &vertexId) const {
+      return this->vertexNeighborCSR_[vertexId];
+    }
+
+    virtual inline const FlatJaggedArray *getVertexStarsCSRInternal() {
+      if(this->vertexStarCSR_.empty()) {
+        this->buildCSR(
+          this->vertexStarCSR_, this->getNumberOfVertices(),
+          [this](const SimplexId id) {
+            return this->getVertexStarNumber(id);
+          },
+          [this](const SimplexId id, const int i, SimplexId &out) {
+            this->getVertexStar(id, i, out);
+          });
+      }
+      return &this->vertexStarCSR_;
+    }
+
+    virtual inline SimplexRange
+      getVertexStarsRangeInternal(const SimplexId &vertexId) const {
+      return this->vertexStarCSR_[vertexId];
+    }
+
+    virtual inline const FlatJaggedArray *getVertexTrianglesCSRInternal() {
+      if(this->vertexTriangleCSR_.empty()) {
+        this->buildCSR(
+          this->vertexTriangleCSR_, this->getNumberOfVertices(),
+          [this](const SimplexId id) {
+            return this->getVertexTriangleNumber(id);
+          },
+          [this](const SimplexId id, const int i, SimplexId &out) {
+            this->getVertexTriangle(id, i, out);
+          });
+      }
+      return &this->vertexTriangleCSR_;
+    }
+
+    virtual inline SimplexRange
+      getVertexTrianglesRangeInternal(const SimplexId &vertexId) const {
+      return this->vertexTriangleCSR_[vertexId];
+    }
     virtual int getCellEdgeInternal(const SimplexId &ttkNotUsed(cellId),
                                     const int &ttkNotUsed(localEdgeId),
                                     SimplexId &ttkNotUsed(edgeId)) const {
@@ -3803,6 +4388,20 @@ namespace ttk {
     std::vector<std::vector<SimplexId>> cellTriangleVector_{};
     std::vector<std::vector<SimplexId>> triangleEdgeVector_{};
 
+    // tables of the get*CSR() functions (when built from per-simplex
+    // queries)
+    FlatJaggedArray cellNeighborCSR_{};
+    FlatJaggedArray edgeLinkCSR_{};
+    FlatJaggedArray edgeStarCSR_{};
+    FlatJaggedArray edgeTriangleCSR_{};
+    FlatJaggedArray triangleLinkCSR_{};
+    FlatJaggedArray triangleStarCSR_{};
+    FlatJaggedArray vertexEdgeCSR_{};
+    FlatJaggedArray vertexLinkCSR_{};
+    FlatJaggedArray vertexNeighborCSR_{};
+    FlatJaggedArray vertexStarCSR_{};
+    FlatJaggedArray vertexTriangleCSR_{};
+
 #ifdef TTK_ENABLE_MPI
 
     // precondition methods for distributed meshes
@@ -3844,6 +4443,9 @@ namespace ttk {
     bool hasPreconditionedExchangeGhostVertices_{false};
     bool hasPreconditionedGlobalBoundary_{false};
 
+    // ghost exchange plans and persistent requests
+    mutable GhostExchangeCache ghostExchangeCache_{};
+
 #endif // TTK_ENABLE_MPI
 
     // only ttk::dcg::DiscreteGradient should use what's defined below.
@@ -3883,8 +4485,8 @@ namespace ttk {
     /*
      * @brief Type for caching Discrete Gradient internal data structure.
      *
-     * Uses the ttk::LRUCache with \ref gradientKeytype as key and
-     * \ref gradientType as value types.
+     * Uses the thread-safe ttk::LRUCache with \ref gradientKeytype as
+     * key and \ref gradientType as value types.
      */
     using gradientCacheType = LRUCache<gradientKeyType, gradientType>;
     /*
@@ -16,7 +16,6 @@
 #include <AssignmentSolver.h>
 
 #include <limits>
-#include <queue>
 
 namespace ttk {
 
@@ -30,24 +29,26 @@ namespace ttk {
     ~AssignmentAuction() override = default;
 
     int run(std::vector<MatchingType> &matchings) override;
-    void runAuctionRound(std::vector<std::vector<dataType>> &cMatrix);
+    void runAuctionRound(CostMatrix<dataType> &cMatrix);
 
     void initFirstRound();
     void initBiddersAndGoods();
     void initEpsilon();
     void epsilonScaling();
-    void makeBalancedMatrix(std::vector<std::vector<dataType>> &matrix);
+    void makeBalancedMatrix(CostMatrix<dataType> &matrix);
+    dataType getLowerBoundCost(const CostMatrix<dataType> &matrix);
 
-    bool stoppingCriterion(std::vector<std::vector<dataType>> &cMatrix);
-    dataType getRelativePrecision(std::vector<std::vector<dataType>> &cMatrix);
-    dataType getMatchingDistance(std::vector<std::vector<dataType>> &cMatrix);
+    bool stoppingCriterion(CostMatrix<dataType> &cMatrix);
+    dataType getRelativePrecision(CostMatrix<dataType> &cMatrix);
+    dataType getMatchingDistance(CostMatrix<dataType> &cMatrix);
 
+    // reset the prices, to be overridden by setPrices
     inline void setBalanced(bool balanced) override {
       AssignmentSolver<dataType>::setBalanced(balanced);
       if(this->balancedAssignment)
-        goodPrices.resize(this->colSize, 0);
+        goodPrices.assign(this->colSize, 0);
       else
-        goodPrices.resize((this->colSize - 1) + (this->rowSize - 1), 0);
+        goodPrices.assign((this->colSize - 1) + (this->rowSize - 1), 0);
     }
 
     inline void setNumberOfRounds(int noRounds) {
@@ -90,6 +91,13 @@ namespace ttk {
     std::vector<int> goodAssignments{};
     std::vector<double> goodPrices{};
     dataType lowerBoundCost;
+
+    // working memory, kept between two runs
+    std::vector<double> savedPrices{};
+    // FIFO of the bidders, as a ring buffer (a bidder is never twice in
+    // the queue)
+    std::vector<int> unassignedBidders{};
+    std::vector<dataType> minCol{}, minRow{};
   }; // AssignmentAuction Class
 
   template <typename type>
@@ -98,10 +106,9 @@ namespace ttk {
   }
 
   template <class dataType>
-  dataType getMaxValue(std::vector<std::vector<dataType>> &matrix,
-                       bool balancedAsgn) {
-    unsigned int const nRows = matrix.size();
-    unsigned int const nCols = matrix[0].size();
+  dataType getMaxValue(const CostMatrix<dataType> &matrix, bool balancedAsgn) {
+    unsigned int const nRows = matrix.rows();
+    unsigned int const nCols = matrix.cols();
     dataType maxValue = std::numeric_limits<dataType>::lowest();
     for(unsigned int i = 0; i < nRows; ++i) {
       for(unsigned int j = 0; j < nCols; ++j) {
@@ -135,14 +142,12 @@ namespace ttk {
 
   template <typename dataType>
   void AssignmentAuction<dataType>::initBiddersAndGoods() {
-    bidderAssignments.clear();
-    goodAssignments.clear();
     if(this->balancedAssignment) {
-      bidderAssignments.resize(this->rowSize, -1);
-      goodAssignments.resize(this->colSize, -1);
+      bidderAssignments.assign(this->rowSize, -1);
+      goodAssignments.assign(this->colSize, -1);
     } else {
-      bidderAssignments.resize((this->rowSize - 1) + (this->colSize - 1), -1);
-      goodAssignments.resize((this->colSize - 1) + (this->rowSize - 1), -1);
+      bidderAssignments.assign((this->rowSize - 1) + (this->colSize - 1), -1);
+      goodAssignments.assign((this->colSize - 1) + (this->rowSize - 1), -1);
     }
   }
 
@@ -154,21 +159,20 @@ namespace ttk {
 
   template <typename dataType>
   void AssignmentAuction<dataType>::makeBalancedMatrix(
-    std::vector<std::vector<dataType>> &matrix) {
-    unsigned int const nRows = matrix.size();
-    unsigned int const nCols = matrix[0].size();
+    CostMatrix<dataType> &matrix) {
+    unsigned int const nRows = matrix.rows();
+    unsigned int const nCols = matrix.cols();
     matrix[nRows - 1][nCols - 1] = 0;
 
+    unsigned int const size = (nRows - 1) + (nCols - 1);
+    matrix.conservativeResize(size, size);
     // Add rows
-    for(unsigned int i = 0; i < nCols - 2; ++i) {
-      std::vector<dataType> const newLine(matrix[nRows - 1]);
-      matrix.push_back(newLine);
+    for(unsigned int i = nRows; i < size; ++i) {
+      std::copy_n(matrix[nRows - 1], nCols, matrix[i]);
     }
     // Add columns
-    for(unsigned int i = 0; i < (nRows - 1) + (nCols - 1); ++i) {
-      for(unsigned int j = 0; j < nRows - 2; ++j) {
-        matrix[i].push_back(matrix[i][nCols - 1]);
-      }
+    for(unsigned int i = 0; i < size; ++i) {
+      std::fill(matrix[i] + nCols, matrix[i] + size, matrix[i][nCols - 1]);
     }
   }
 
@@ -177,14 +181,17 @@ namespace ttk {
   // ----------------------------------------
   template <typename dataType>
   void AssignmentAuction<dataType>::runAuctionRound(
-    std::vector<std::vector<dataType>> &cMatrix) {
-    std::queue<int> unassignedBidders{};
-    for(unsigned int i = 0; i < bidderAssignments.size(); ++i)
-      unassignedBidders.push(i);
-
-    while(!unassignedBidders.empty()) {
-      int const bidderId = unassignedBidders.front();
-      unassignedBidders.pop();
+    CostMatrix<dataType> &cMatrix) {
+    const size_t nBidders = bidderAssignments.size();
+    unassignedBidders.resize(nBidders);
+    for(unsigned int i = 0; i < nBidders; ++i)
+      unassignedBidders[i] = i;
+    size_t queueFront = 0, queueSize = nBidders;
+
+    while(queueSize != 0) {
+      int const bidderId = unassignedBidders[queueFront];
+      queueFront = (queueFront + 1) % nBidders;
+      queueSize--;
 
       // Get good with highest value
       dataType bestValue = std::numeric_limits<dataType>::lowest();
@@ -205,8 +212,11 @@ namespace ttk {
 
       // Update assignments
       bidderAssignments[bidderId] = bestGoodId;
-      if(goodAssignments[bestGoodId] != -1)
-        unassignedBidders.push(goodAssignments[bestGoodId]);
+      if(goodAssignments[bestGoodId] != -1) {
+        unassignedBidders[(queueFront + queueSize) % nBidders]
+          = goodAssignments[bestGoodId];
+        queueSize++;
+      }
       goodAssignments[bestGoodId] = bidderId;
 
       // If there is only one acceptable good for the bidder
@@ -225,12 +235,12 @@ namespace ttk {
   }
 
   template <typename dataType>
-  dataType getLowerBoundCost(std::vector<std::vector<dataType>> &costMatrix) {
-    std::vector<dataType> minCol(
-      costMatrix[0].size(), std::numeric_limits<dataType>::max()),
-      minRow(costMatrix.size(), std::numeric_limits<dataType>::max());
-    for(unsigned int i = 0; i < costMatrix.size(); ++i) {
-      for(unsigned int j = 0; j < costMatrix[i].size(); ++j) {
+  dataType AssignmentAuction<dataType>::getLowerBoundCost(
+    const CostMatrix<dataType> &costMatrix) {
+    minCol.assign(costMatrix.cols(), std::numeric_limits<dataType>::max());
+    minRow.assign(costMatrix.rows(), std::numeric_limits<dataType>::max());
+    for(unsigned int i = 0; i < costMatrix.rows(); ++i) {
+      for(unsigned int j = 0; j < costMatrix.cols(); ++j) {
         if(costMatrix[i][j] < minCol[j])
           minCol[j] = costMatrix[i][j];
         if(costMatrix[i][j] < minRow[i])
@@ -242,26 +252,25 @@ namespace ttk {
       minColCost += minCol[i];
     for(unsigned int i = 0; i < minRow.size(); ++i)
       minRowCost += minRow[i];
-    dataType lowerBoundCost = std::max(minColCost, minRowCost);
-
-    return lowerBoundCost;
+    return std::max(minColCost, minRowCost);
   }
 
   template <typename dataType>
   int AssignmentAuction<dataType>::run(std::vector<MatchingType> &matchings) {
+    // epsilon is scaled during the run
+    const double inputEpsilon = epsilon;
     initEpsilon();
     dataType bestCost = std::numeric_limits<dataType>::max();
 
     // Try to avoid price war
     double const tempPrice
       = *std::max_element(goodPrices.begin(), goodPrices.end());
-    std::vector<double> savedPrices;
+    savedPrices.resize(goodPrices.size());
     for(unsigned int i = 0; i < goodPrices.size(); ++i) {
       auto old = goodPrices[i];
       goodPrices[i]
         = goodPrices[i] * epsilon / ((tempPrice == 0) ? 1 : tempPrice);
-      auto t = old - goodPrices[i];
-      savedPrices.push_back(t);
+      savedPrices[i] = old - goodPrices[i];
     }
 
     // Make balanced cost matrix
@@ -307,6 +316,8 @@ namespace ttk {
     for(unsigned int i = 0; i < goodPrices.size(); ++i)
       goodPrices[i] += savedPrices[i];
 
+    epsilon = inputEpsilon;
+
     return 0;
   }
 
@@ -316,7 +327,7 @@ namespace ttk {
   // Adapted from Persistence Diagrams Auction
   template <typename dataType>
   bool AssignmentAuction<dataType>::stoppingCriterion(
-    std::vector<std::vector<dataType>> &cMatrix) {
+    CostMatrix<dataType> &cMatrix) {
     if(bidderAssignments[0] == -1) // Auction not started
       return false;
     dataType delta = 5;
@@ -327,7 +338,7 @@ namespace ttk {
   // Adapted from Persistence Diagrams Auction
   template <typename dataType>
   dataType AssignmentAuction<dataType>::getRelativePrecision(
-    std::vector<std::vector<dataType>> &cMatrix) {
+    CostMatrix<dataType> &cMatrix) {
     dataType d = this->getMatchingDistance(cMatrix);
     if(d < 1e-6 or d <= (lowerBoundCost * lowerBoundCostWeight)) {
       return 0;
@@ -343,7 +354,7 @@ namespace ttk {
   // Adapted from Persistence Diagrams Auction
   template <typename dataType>
   dataType AssignmentAuction<dataType>::getMatchingDistance(
-    std::vector<std::vector<dataType>> &cMatrix) {
+    CostMatrix<dataType> &cMatrix) {
     dataType d = 0;
     for(unsigned int bidderId = 0; bidderId < bidderAssignments.size();
         ++bidderId) {
@@ -31,43 +31,13 @@ namespace ttk {
       createdZeros.clear();
     }
 
-    inline int setInput(std::vector<std::vector<dataType>> &C_) override {
-      AssignmentSolver<dataType>::setInput(C_);
-
-      createdZeros.clear();
-
-      auto r = (unsigned long)this->rowSize;
-      auto c = (unsigned long)this->colSize;
-
-      rowCover.resize(r);
-      colCover.resize(c);
-
-      rowLimitsMinus.resize(r);
-      rowLimitsPlus.resize(r);
-      colLimitsMinus.resize(c);
-      colLimitsPlus.resize(c);
-
-      M.resize(r);
-      for(int row = 0; row < this->rowSize; ++row)
-        M[row].resize(c);
-
-      const int nbPaths = 1 + this->colSize + this->rowSize;
-      path.resize((unsigned long)nbPaths);
-      for(int p = 0; p < nbPaths; ++p)
-        path[p].resize(2);
-
-      resetMasks();
-
-      return 0;
-    }
-
     inline void showCostMatrix() {
-      auto C = AssignmentSolver<dataType>::getCostMatrix();
+      const auto &C = AssignmentSolver<dataType>::getCostMatrix();
       std::stringstream msg;
       for(int r = 0; r < this->rowSize; ++r) {
         msg << std::endl << "  ";
         for(int c = 0; c < this->colSize; ++c)
-          msg << std::fixed << std::setprecision(3) << (*C)[r][c] << " ";
+          msg << std::fixed << std::setprecision(3) << C[r][c] << " ";
       }
 
       this->printMsg(msg.str(), debug::Priority::DETAIL);
@@ -93,8 +63,36 @@ namespace ttk {
       this->printMsg(msg.str(), debug::Priority::DETAIL);
     }
 
+  protected:
+    inline int initInput() override {
+      AssignmentSolver<dataType>::initInput();
+
+      createdZeros.clear();
+
+      auto r = (unsigned long)this->rowSize;
+      auto c = (unsigned long)this->colSize;
+
+      rowCover.resize(r);
+      colCover.resize(c);
+
+      rowLimitsMinus.resize(r);
+      rowLimitsPlus.resize(r);
+      colLimitsMinus.resize(c);
+      colLimitsPlus.resize(c);
+
+      M.resize(r, c);
+
+      const int nbPaths = 1 + this->colSize + this->rowSize;
+      path.resize((unsigned long)nbPaths);
+
+      resetMasks();
+
+      return 0;
+    }
+
   private:
-    std::vector<std::vector<int>> M;
+    // 1 for starred zeros, 2 for primed zeros
+    CostMatrix<int> M;
     std::vector<bool> rowCover;
     std::vector<bool> colCover;
 
@@ -103,9 +101,12 @@ namespace ttk {
     std::vector<int> colLimitsMinus;
     std::vector<int> colLimitsPlus;
 
-    std::vector<std::vector<int>> path;
+    std::vector<std::pair<int, int>> path;
     std::vector<std::pair<int, int>> createdZeros;
 
+    // copy of the input cost matrix, modified by the algorithm
+    CostMatrix<dataType> inputMatrix;
+
     int pathRow0;
     int pathCol0;
     int pathCount = 0;
@@ -130,9 +131,9 @@ namespace ttk {
     int stepSeven(int &step);
 
     int affect(std::vector<MatchingType> &matchings,
-               const std::vector<std::vector<dataType>> &C);
+               const CostMatrix<dataType> &C);
 
-    int computeAffectationCost(const std::vector<std::vector<dataType>> &C);
+    int computeAffectationCost(const CostMatrix<dataType> &C);
 
     inline bool isZero(dataType t) {
       // return std::abs((double) t) < 1e-15;
@@ -140,25 +141,14 @@ namespace ttk {
     }
 
     inline int resetMasks() {
-      for(int r = 0; r < this->rowSize; ++r) {
-        rowCover[r] = false;
-        for(int c = 0; c < this->colSize; ++c)
-          M[r][c] = 0;
-      }
-      for(int c = 0; c < this->colSize; ++c)
-        colCover[c] = false;
+      M.fill(0);
+      std::fill(rowCover.begin(), rowCover.end(), false);
+      std::fill(colCover.begin(), colCover.end(), false);
       return 0;
     }
 
-    inline int copyInputMatrix(std::vector<std::vector<dataType>> &saveInput) {
-      auto C = AssignmentSolver<dataType>::getCostMatrixPointer();
-      const int rS = this->rowSize;
-      const int cS = this->colSize;
-
-      for(int r = 0; r < rS; ++r)
-        for(int c = 0; c < cS; ++c)
-          saveInput[r][c] = (*C)[r][c];
-
+    inline int copyInputMatrix(CostMatrix<dataType> &saveInput) {
+      saveInput = AssignmentSolver<dataType>::getCostMatrix();
       return 0;
     }
   };
@@ -13,8 +13,6 @@ int ttk::AssignmentMunkres<dataType>::run(
   bool done = false;
   Timer t;
 
-  std::vector<std::vector<dataType>> inputMatrix(
-    this->rowSize, std::vector<dataType>(this->colSize));
   copyInputMatrix(inputMatrix);
 
   while(!done) {
@@ -85,8 +83,7 @@ template <typename dataType>
 int ttk::AssignmentMunkres<dataType>::stepOne(int &step) // ~ 0% perf
 {
   double minInCol;
-  std::vector<std::vector<dataType>> *C
-    = AssignmentSolver<dataType>::getCostMatrixPointer();
+  auto *C = AssignmentSolver<dataType>::getCostMatrixPointer();
 
   // Benefit from the matrix sparsity.
   dataType maxVal = std::numeric_limits<dataType>::max();
@@ -209,8 +206,7 @@ int ttk::AssignmentMunkres<dataType>::stepOne(int &step) // ~ 0% perf
 template <typename dataType>
 int ttk::AssignmentMunkres<dataType>::stepTwo(int &step) // ~ 0% perf
 {
-  std::vector<std::vector<dataType>> *C
-    = AssignmentSolver<dataType>::getCostMatrixPointer();
+  auto *C = AssignmentSolver<dataType>::getCostMatrixPointer();
 
   for(int r = 0; r < this->rowSize - 1; ++r) {
     for(int c = 0; c < this->colSize - 1; ++c) {
@@ -378,37 +374,37 @@ int ttk::AssignmentMunkres<dataType>::stepFive(int &step) // ~ 10% perf
     int c;
 
     pathCount = 1;
-    path[pathCount - 1][0] = pathRow0;
-    path[pathCount - 1][1] = pathCol0;
+    path[pathCount - 1].first = pathRow0;
+    path[pathCount - 1].second = pathCol0;
 
     bool done = false;
     while(!done) {
-      r = findStarInCol(path[pathCount - 1][1]);
+      r = findStarInCol(path[pathCount - 1].second);
       if(r == -1)
         done = true;
 
       else {
         ++pathCount;
-        path[pathCount - 1][0] = r;
-        path[pathCount - 1][1] = path[pathCount - 2][1];
+        path[pathCount - 1].first = r;
+        path[pathCount - 1].second = path[pathCount - 2].second;
 
-        c = findPrimeInRow(path[pathCount - 1][0]);
+        c = findPrimeInRow(path[pathCount - 1].first);
         if(c == -1) {
           this->printWrn("Did not find an expected prime.");
         }
         ++pathCount;
-        path[pathCount - 1][0] = path[pathCount - 2][0];
-        path[pathCount - 1][1] = c;
+        path[pathCount - 1].first = path[pathCount - 2].first;
+        path[pathCount - 1].second = c;
       }
     }
   }
 
   // process path
   for(int p = 0; p < pathCount; ++p) {
-    if(M[path[p][0]][path[p][1]] == 1)
-      M[path[p][0]][path[p][1]] = 0;
+    if(M[path[p].first][path[p].second] == 1)
+      M[path[p].first][path[p].second] = 0;
     else
-      M[path[p][0]][path[p][1]] = 1;
+      M[path[p].first][path[p].second] = 1;
   }
 
   // clear covers
@@ -512,7 +508,7 @@ int ttk::AssignmentMunkres<dataType>::stepSeven(int &ttkNotUsed(step)) {
 template <typename dataType>
 int ttk::AssignmentMunkres<dataType>::affect(
   std::vector<MatchingType> &matchings,
-  const std::vector<std::vector<dataType>> &C) {
+  const CostMatrix<dataType> &C) {
   const int nbC = this->colSize;
   const int nbR = this->rowSize;
 
@@ -544,7 +540,7 @@ int ttk::AssignmentMunkres<dataType>::affect(
 
 template <typename dataType>
 int ttk::AssignmentMunkres<dataType>::computeAffectationCost(
-  const std::vector<std::vector<dataType>> &C) {
+  const CostMatrix<dataType> &C) {
   const int nbC = this->colSize;
   const int nbR = this->rowSize;
 
@@ -10,9 +10,15 @@
 ///   - the nth row contains the cost of not assigning workers
 ///   - the mth column is the same but with jobs
 ///   - the last cell (costMatrix[n][m]) is not used
+///
+/// The cost matrix is stored in a ttk::CostMatrix and the solvers keep
+/// their working memory between two calls to run(): a solver reused for
+/// a sequence of problems does not allocate once it has solved the
+/// largest one.
 
 #pragma once
 
+#include <CostMatrix.h>
 #include <Debug.h>
 #include <PersistenceDiagramUtils.h>
 
@@ -34,32 +40,33 @@ namespace ttk {
     }
 
     virtual inline void clearMatrix() {
-      std::vector<std::vector<dataType>> C = getCostMatrix();
-      for(int r = 0, rS0 = rowSize; r < rS0; ++r)
-        for(int c = 0, cS0 = colSize; c < cS0; ++c)
-          C[r][c] = 0.0;
+      costMatrix.fill(0.0);
     }
 
-    virtual inline int setInput(std::vector<std::vector<dataType>> &C_) {
-      rowSize = C_.size();
-      colSize = C_[0].size();
+    inline int setInput(const std::vector<std::vector<dataType>> &C_) {
+      costMatrix.assign(C_);
+      return this->initInput();
+    }
 
+    /**
+     * @brief Copy the cost matrix of the next problem
+     *
+     * The copy reuses the memory of the previous cost matrix.
+     */
+    inline int setInput(const CostMatrix<dataType> &C_) {
       costMatrix = C_;
-
-      setBalanced((this->rowSize == this->colSize));
-
-      return 0;
+      return this->initInput();
     }
 
     virtual inline void setBalanced(bool balanced) {
       balancedAssignment = balanced;
     }
 
-    virtual inline std::vector<std::vector<dataType>> getCostMatrix() {
+    inline CostMatrix<dataType> &getCostMatrix() {
       return costMatrix;
     }
 
-    virtual inline std::vector<std::vector<dataType>> *getCostMatrixPointer() {
+    inline CostMatrix<dataType> *getCostMatrixPointer() {
       return &costMatrix;
     }
 
@@ -75,7 +82,17 @@ namespace ttk {
     }
 
   protected:
-    std::vector<std::vector<dataType>> costMatrix;
+    // called once the cost matrix is set, to size the working memory
+    virtual inline int initInput() {
+      rowSize = costMatrix.rows();
+      colSize = costMatrix.cols();
+
+      setBalanced((this->rowSize == this->colSize));
+
+      return 0;
+    }
+
+    CostMatrix<dataType> costMatrix;
 
     int rowSize = 0;
     int colSize = 0;
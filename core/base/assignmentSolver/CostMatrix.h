@@ -0,0 +1,156 @@
+/// \ingroup base
+/// \class ttk::CostMatrix
+///
+/// \brief Dense matrix for the assignment solvers, stored contiguously
+/// in row-major order.
+///
+/// Resizing a matrix keeps its allocated memory: a matrix (or a solver
+/// holding one) reused for a sequence of assignment problems only
+/// allocates when a problem is larger than all the previous ones.
+///
+/// `matrix[r][c]` is supported, as with nested std::vector.
+///
+/// \sa ttk::AssignmentSolver
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ttk {
+
+  template <typename dataType>
+  class CostMatrix {
+
+  public:
+    CostMatrix() = default;
+
+    CostMatrix(const size_t nRows,
+               const size_t nCols,
+               const dataType value = dataType{}) {
+      this->assign(nRows, nCols, value);
+    }
+
+    explicit CostMatrix(const std::vector<std::vector<dataType>> &matrix) {
+      this->assign(matrix);
+    }
+
+    inline size_t rows() const {
+      return this->nRows_;
+    }
+
+    inline size_t cols() const {
+      return this->nCols_;
+    }
+
+    inline bool empty() const {
+      return this->nRows_ == 0 || this->nCols_ == 0;
+    }
+
+    /**
+     * @brief Set the dimensions, the content is unspecified
+     */
+    inline void resize(const size_t nRows, const size_t nCols) {
+      this->nRows_ = nRows;
+      this->nCols_ = nCols;
+      this->data_.resize(nRows * nCols);
+    }
+
+    /**
+     * @brief Set the dimensions and fill the matrix with @p value
+     */
+    inline void
+      assign(const size_t nRows, const size_t nCols, const dataType value) {
+      this->nRows_ = nRows;
+      this->nCols_ = nCols;
+      this->data_.assign(nRows * nCols, value);
+    }
+
+    /**
+     * @brief Copy a matrix stored as nested vectors (rows of equal size)
+     */
+    inline void assign(const std::vector<std::vector<dataType>> &matrix) {
+      this->resize(matrix.size(), matrix.empty() ? 0 : matrix[0].size());
+      for(size_t r = 0; r < this->nRows_; ++r) {
+        std::copy(matrix[r].begin(), matrix[r].end(),
+                  this->data_.begin() + r * this->nCols_);
+      }
+    }
+
+    /**
+     * @brief Set the dimensions, keeping the values of the top-left
+     * block shared by the previous and the new dimensions
+     *
+     * The other values are set to @p value.
+     */
+    inline void conservativeResize(const size_t nRows,
+                                   const size_t nCols,
+                                   const dataType value = dataType{}) {
+      const size_t oldCols = this->nCols_;
+      const size_t keptRows = std::min(this->nRows_, nRows);
+      const size_t keptCols = std::min(oldCols, nCols);
+
+      if(nCols <= oldCols) {
+        // rows move towards the beginning
+        for(size_t r = 1; r < keptRows; ++r) {
+          std::copy_n(this->data_.begin() + r * oldCols, keptCols,
+                      this->data_.begin() + r * nCols);
+        }
+      } else {
+        // rows move towards the end, start with the last one
+        this->data_.resize(std::max(nRows * nCols, this->data_.size()));
+        for(size_t r = keptRows; r-- > 0;) {
+          const auto src = this->data_.begin() + r * oldCols;
+          const auto dst = this->data_.begin() + r * nCols;
+          std::copy_backward(src, src + keptCols, dst + keptCols);
+          std::fill(dst + keptCols, dst + nCols, value);
+        }
+      }
+      this->data_.resize(nRows * nCols);
+      std::fill(
+        this->data_.begin() + keptRows * nCols, this->data_.end(), value);
+
+      this->nRows_ = nRows;
+      this->nCols_ = nCols;
+    }
+
+    inline void fill(const dataType value) {
+      std::fill(this->data_.begin(), this->data_.end(), value);
+    }
+
+    inline dataType *operator[](const size_t r) {
+      return this->data_.data() + r * this->nCols_;
+    }
+
+    inline const dataType *operator[](const size_t r) const {
+      return this->data_.data() + r * this->nCols_;
+    }
+
+    inline dataType &operator()(const size_t r, const size_t c) {
+      return this->data_[r * this->nCols_ + c];
+    }
+
+    inline const dataType &operator()(const size_t r, const size_t c) const {
+      return this->data_[r * this->nCols_ + c];
+    }
+
+    inline dataType *data() {
+      return this->data_.data();
+    }
+
+    inline const dataType *data() const {
+      return this->data_.data();
+    }
+
+    inline size_t footprint() const {
+      return this->data_.capacity() * sizeof(dataType);
+    }
+
+  protected:
+    size_t nRows_{};
+    size_t nCols_{};
+    std::vector<dataType> data_{};
+  };
+
+} // namespace ttk
@@ -1,6 +1,6 @@
 #include <AssignmentMunkres.h>
 #include <BottleneckDistance.h>
-#include <GabowTarjan.h>
+#include <BottleneckMatching.h>
 #include <Geometry.h>
 
 ttk::BottleneckDistance::BottleneckDistance() {
@@ -381,22 +381,45 @@ namespace {
     solver.run(matchings);
     solver.clearMatrix();
   }
+} // namespace
 
-  void solveInfinityWasserstein(const int nbRow,
-                                const int nbCol,
-                                std::vector<std::vector<double>> &matrix,
-                                std::vector<ttk::MatchingType> &matchings,
-                                ttk::GabowTarjan &solver) {
-
-    // Copy input matrix.
-    auto bottleneckMatrix = matrix;
-
-    // Solve.
-    solver.setInput(nbRow, nbCol, &bottleneckMatrix);
-    solver.run(matchings);
-    solver.clear();
+void ttk::BottleneckDistance::solveBottleneck(
+  const ttk::DiagramType &CTDiagram1,
+  const ttk::DiagramType &CTDiagram2,
+  const std::vector<int> &map1,
+  const std::vector<int> &map2,
+  const int wasserstein,
+  std::vector<MatchingType> &matchings) const {
+
+  // the distance between two pairs is bounded below by the weighted L1
+  // distance of their (birth, death) coordinates
+  const auto weight = std::min(this->PE, this->PS);
+
+  std::vector<std::array<double, 2>> points1(map1.size()),
+    points2(map2.size());
+  std::vector<double> diag1(map1.size()), diag2(map2.size());
+  for(size_t i = 0; i < map1.size(); ++i) {
+    const auto &p = CTDiagram1[map1[i]];
+    points1[i] = {weight * p.birth.sfValue, weight * p.death.sfValue};
+    diag1[i] = this->diagonalDistanceFunction(p, wasserstein);
   }
-} // namespace
+  for(size_t j = 0; j < map2.size(); ++j) {
+    const auto &p = CTDiagram2[map2[j]];
+    points2[j] = {weight * p.birth.sfValue, weight * p.death.sfValue};
+    diag2[j] = this->diagonalDistanceFunction(p, wasserstein);
+  }
+
+  BottleneckMatching solver{};
+  solver.setDebugLevel(this->debugLevel_);
+  solver.setThreadNumber(this->threadNumber_);
+  solver.run(
+    points1, diag1, points2, diag2,
+    [&](const int i, const int j) {
+      return this->distanceFunction(
+        CTDiagram1[map1[i]], CTDiagram2[map2[j]], wasserstein);
+    },
+    matchings);
+}
 
 double ttk::BottleneckDistance::buildMappings(
   const std::vector<MatchingType> &inputMatchings,
@@ -465,18 +488,20 @@ double ttk::BottleneckDistance::distanceFunction(const ttk::PersistencePair &a,
            + this->PZ * Geometry::pow(coordsAbsDiff[2], w))
         : (this->PX
              * Geometry::pow(
-               std::abs(a.birth.coords[0] + a.death.coords[0]) / 2
-                 - std::abs(b.birth.coords[0] + b.death.coords[0]) / 2,
+               std::abs(std::abs(a.birth.coords[0] + a.death.coords[0]) / 2
+                        - std::abs(b.birth.coords[0] + b.death.coords[0]) / 2),
                w)
            + this->PY
                * Geometry::pow(
-                 std::abs(a.birth.coords[1] + a.death.coords[1]) / 2
-                   - std::abs(b.birth.coords[1] + b.death.coords[1]) / 2,
+                 std::abs(std::abs(a.birth.coords[1] + a.death.coords[1]) / 2
+                          - std::abs(b.birth.coords[1] + b.death.coords[1])
+                              / 2),
                  w)
            + this->PZ
                * Geometry::pow(
-                 std::abs(a.birth.coords[2] + a.death.coords[2]) / 2
-                   - std::abs(b.birth.coords[2] + b.death.coords[2]) / 2,
+                 std::abs(std::abs(a.birth.coords[2] + a.death.coords[2]) / 2
+                          - std::abs(b.birth.coords[2] + b.death.coords[2])
+                              / 2),
                  w));
 
   const double persDistance = x + y;
@@ -527,10 +552,8 @@ int ttk::BottleneckDistance::computeBottleneck(
   const auto zeroThresh
     = this->computeMinimumRelevantPersistence(CTDiagram1, CTDiagram2);
 
-  // Initialize solvers.
-  std::vector<MatchingType> minMatchings;
-  std::vector<MatchingType> maxMatchings;
-  std::vector<MatchingType> sadMatchings;
+  // Matchings per pair type (minima, saddles, maxima).
+  std::array<std::vector<MatchingType>, 3> typeMatchings{};
 
   // Initialize cost matrices.
   int nbRowMin = 0, nbColMin = 0;
@@ -557,67 +580,57 @@ int ttk::BottleneckDistance::computeBottleneck(
   const auto minRowColMax = std::min(nbRowMax + 1, nbColMax + 1);
   const auto minRowColSad = std::min(nbRowSad + 1, nbColSad + 1);
 
-  std::vector<std::vector<double>> minMatrix(
-    minRowColMin, std::vector<double>(maxRowColMin));
-  std::vector<std::vector<double>> maxMatrix(
-    minRowColMax, std::vector<double>(maxRowColMax));
-  std::vector<std::vector<double>> sadMatrix(
-    minRowColSad, std::vector<double>(maxRowColSad));
-
   const bool transposeMin = nbRowMin > nbColMin;
   const bool transposeMax = nbRowMax > nbColMax;
   const bool transposeSad = nbRowSad > nbColSad;
 
-  Timer t;
+  // per pair type: minima, saddles, maxima
+  const std::array<int, 3> nbRows{nbRowMin, nbRowSad, nbRowMax};
+  const std::array<int, 3> nbCols{nbColMin, nbColSad, nbColMax};
+  std::array<bool, 3> transposed{};
 
-  this->buildCostMatrices(CTDiagram1, CTDiagram2, zeroThresh, minMatrix,
-                          maxMatrix, sadMatrix, transposeMin, transposeMax,
-                          transposeSad, wasserstein);
+  Timer t;
 
   if(!isBottleneck) {
 
-    if(nbRowMin > 0 && nbColMin > 0) {
-      AssignmentMunkres<double> solverMin;
-      this->printMsg("Affecting minima...");
-      solvePWasserstein(minMatrix, minMatchings, solverMin);
-    }
-
-    if(nbRowMax > 0 && nbColMax > 0) {
-      AssignmentMunkres<double> solverMax;
-      this->printMsg("Affecting maxima...");
-      solvePWasserstein(maxMatrix, maxMatchings, solverMax);
-    }
-
-    if(nbRowSad > 0 && nbColSad > 0) {
-      AssignmentMunkres<double> solverSad;
-      this->printMsg("Affecting saddles...");
-      solvePWasserstein(sadMatrix, sadMatchings, solverSad);
+    std::vector<std::vector<double>> minMatrix(
+      minRowColMin, std::vector<double>(maxRowColMin));
+    std::vector<std::vector<double>> maxMatrix(
+      minRowColMax, std::vector<double>(maxRowColMax));
+    std::vector<std::vector<double>> sadMatrix(
+      minRowColSad, std::vector<double>(maxRowColSad));
+
+    this->buildCostMatrices(CTDiagram1, CTDiagram2, zeroThresh, minMatrix,
+                            maxMatrix, sadMatrix, transposeMin, transposeMax,
+                            transposeSad, wasserstein);
+
+    const std::array<std::vector<std::vector<double>> *, 3> matrices{
+      &minMatrix, &sadMatrix, &maxMatrix};
+    transposed = {transposeMin, transposeSad, transposeMax};
+
+    this->printMsg("Affecting minima, saddles and maxima...");
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif // TTK_ENABLE_OPENMP
+    for(int k = 0; k < 3; ++k) {
+      if(nbRows[k] > 0 && nbCols[k] > 0) {
+        AssignmentMunkres<double> solver;
+        solvePWasserstein(*matrices[k], typeMatchings[k], solver);
+      }
     }
 
   } else {
 
-    // Launch solving for minima.
-    if(nbRowMin > 0 && nbColMin > 0) {
-      GabowTarjan solverMin;
-      this->printMsg("Affecting minima...");
-      solveInfinityWasserstein(
-        minRowColMin, maxRowColMin, minMatrix, minMatchings, solverMin);
-    }
-
-    // Launch solving for maxima.
-    if(nbRowMax > 0 && nbColMax > 0) {
-      GabowTarjan solverMax;
-      this->printMsg("Affecting maxima...");
-      solveInfinityWasserstein(
-        minRowColMax, maxRowColMax, maxMatrix, maxMatchings, solverMax);
-    }
-
-    // Launch solving for saddles.
-    if(nbRowSad > 0 && nbColSad > 0) {
-      GabowTarjan solverSad;
-      this->printMsg("Affecting saddles...");
-      solveInfinityWasserstein(
-        minRowColSad, maxRowColSad, sadMatrix, sadMatchings, solverSad);
+    // no cost matrix, the candidate edges are generated geometrically
+    this->printMsg("Affecting minima, saddles and maxima...");
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif // TTK_ENABLE_OPENMP
+    for(int k = 0; k < 3; ++k) {
+      if(nbRows[k] > 0 && nbCols[k] > 0) {
+        this->solveBottleneck(CTDiagram1, CTDiagram2, map1[k], map2[k],
+                              wasserstein, typeMatchings[k]);
+      }
     }
   }
 
@@ -626,11 +639,11 @@ int ttk::BottleneckDistance::computeBottleneck(
   // Rebuild mappings.
   // Begin cost computation for unpaired vertices.
   const std::array<double, 3> addedPersistence{
-    this->buildMappings(minMatchings, transposeOriginal, transposeMin,
+    this->buildMappings(typeMatchings[0], transposeOriginal, transposed[0],
                         matchings, map1[0], map2[0], wasserstein),
-    this->buildMappings(sadMatchings, transposeOriginal, transposeSad,
+    this->buildMappings(typeMatchings[1], transposeOriginal, transposed[1],
                         matchings, map1[1], map2[1], wasserstein),
-    this->buildMappings(maxMatchings, transposeOriginal, transposeMax,
+    this->buildMappings(typeMatchings[2], transposeOriginal, transposed[2],
                         matchings, map1[2], map2[2], wasserstein),
   };
 
@@ -640,9 +653,6 @@ int ttk::BottleneckDistance::computeBottleneck(
   std::vector<bool> paired1(CTDiagram1.size(), false);
   std::vector<bool> paired2(CTDiagram2.size(), false);
 
-  // store last matching distance for bottleneck
-  double partialDistance{};
-
   for(const auto &mt : matchings) {
     const int i = transposeOriginal ? std::get<1>(mt) : std::get<0>(mt);
     const int j = transposeOriginal ? std::get<0>(mt) : std::get<1>(mt);
@@ -652,7 +662,7 @@ int ttk::BottleneckDistance::computeBottleneck(
     paired1[i] = true;
     paired2[j] = true;
 
-    partialDistance = this->distanceFunction(t1, t2, wasserstein);
+    const auto partialDistance = this->distanceFunction(t1, t2, wasserstein);
 
     if(t1.death.type == CriticalType::Local_maximum) {
       if(!isBottleneck) {
@@ -677,7 +687,8 @@ int ttk::BottleneckDistance::computeBottleneck(
   }
 
   const auto affectationD
-    = !isBottleneck ? costs[0] + costs[1] + costs[2] : partialDistance;
+    = !isBottleneck ? costs[0] + costs[1] + costs[2]
+                    : *std::max_element(costs.begin(), costs.end());
   const auto addedPers
     = addedPersistence[0] + addedPersistence[1] + addedPersistence[2];
   this->distance_
@@ -104,6 +104,17 @@ namespace ttk {
                            bool reverseSad,
                            int wasserstein) const;
 
+    /**
+     * @brief Bottleneck matching of the pairs of one type, without
+     * building their cost matrix
+     */
+    void solveBottleneck(const ttk::DiagramType &CTDiagram1,
+                         const ttk::DiagramType &CTDiagram2,
+                         const std::vector<int> &map1,
+                         const std::vector<int> &map2,
+                         const int wasserstein,
+                         std::vector<MatchingType> &matchings) const;
+
     double buildMappings(const std::vector<MatchingType> &inputMatchings,
                          bool transposeGlobal,
                          bool transposeLocal,
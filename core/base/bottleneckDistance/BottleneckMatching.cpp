@@ -0,0 +1,485 @@
+#include <BottleneckMatching.h>
+#include <OpenMP.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <tuple>
+
+namespace {
+
+  using Point = std::array<double, 2>;
+
+  inline double l1Distance(const Point &p, const Point &q) {
+    return std::abs(p[0] - q[0]) + std::abs(p[1] - q[1]);
+  }
+
+  /**
+   * @brief Implicit KD-tree on a set of points of the (birth, death)
+   * plane, for L1 range and nearest neighbor queries
+   *
+   * Every range [begin, end) of the permutation is split at its median
+   * point along the axis of largest extent.
+   */
+  class PlaneKDTree {
+  public:
+    explicit PlaneKDTree(const std::vector<Point> &points)
+      : points_{points}, perm_(points.size()), axes_(points.size()) {
+      std::iota(this->perm_.begin(), this->perm_.end(), 0);
+      this->build(0, this->perm_.size());
+    }
+
+    /**
+     * @brief Find the points at L1 distance lower or equal than @p
+     * radius from @p p
+     */
+    void getRange(const Point &p,
+                  const double radius,
+                  std::vector<int> &ids,
+                  std::vector<std::pair<size_t, size_t>> &stack) const {
+      ids.clear();
+      stack.clear();
+      stack.emplace_back(0, this->perm_.size());
+      while(!stack.empty()) {
+        const auto range{stack.back()};
+        stack.pop_back();
+        if(range.second - range.first <= leafSize_) {
+          for(size_t j = range.first; j < range.second; ++j) {
+            if(l1Distance(p, this->points_[this->perm_[j]]) <= radius) {
+              ids.emplace_back(this->perm_[j]);
+            }
+          }
+          continue;
+        }
+        const auto mid{(range.first + range.second) / 2};
+        const auto axis{this->axes_[mid]};
+        const auto &q{this->points_[this->perm_[mid]]};
+        if(l1Distance(p, q) <= radius) {
+          ids.emplace_back(this->perm_[mid]);
+        }
+        if(p[axis] - radius <= q[axis]) {
+          stack.emplace_back(range.first, mid);
+        }
+        if(p[axis] + radius >= q[axis]) {
+          stack.emplace_back(mid + 1, range.second);
+        }
+      }
+    }
+
+    /**
+     * @brief L1 distance from @p p to its nearest point
+     */
+    double getNearestDistance(
+      const Point &p,
+      std::vector<std::tuple<size_t, size_t, double>> &stack) const {
+      auto best{std::numeric_limits<double>::max()};
+      stack.clear();
+      stack.emplace_back(0, this->perm_.size(), 0.0);
+      while(!stack.empty()) {
+        const auto range{stack.back()};
+        stack.pop_back();
+        const auto begin{std::get<0>(range)};
+        const auto end{std::get<1>(range)};
+        if(std::get<2>(range) >= best) {
+          continue;
+        }
+        if(end - begin <= leafSize_) {
+          for(size_t j = begin; j < end; ++j) {
+            best = std::min(best, l1Distance(p, this->points_[this->perm_[j]]));
+          }
+          continue;
+        }
+        const auto mid{(begin + end) / 2};
+        const auto axis{this->axes_[mid]};
+        const auto &q{this->points_[this->perm_[mid]]};
+        best = std::min(best, l1Distance(p, q));
+        // the nearest side is processed first
+        const auto gap{std::abs(p[axis] - q[axis])};
+        if(p[axis] <= q[axis]) {
+          stack.emplace_back(mid + 1, end, gap);
+          stack.emplace_back(begin, mid, 0.0);
+        } else {
+          stack.emplace_back(begin, mid, gap);
+          stack.emplace_back(mid + 1, end, 0.0);
+        }
+      }
+      return best;
+    }
+
+  private:
+    void build(const size_t begin, const size_t end) {
+      if(end - begin <= leafSize_) {
+        return;
+      }
+
+      // split along the axis of largest extent
+      size_t axis{};
+      double maxExtent{-1.0};
+      for(size_t k = 0; k < 2; ++k) {
+        auto lo{std::numeric_limits<double>::max()};
+        auto hi{std::numeric_limits<double>::lowest()};
+        for(size_t j = begin; j < end; ++j) {
+          const auto c{this->points_[this->perm_[j]][k]};
+          lo = std::min(lo, c);
+          hi = std::max(hi, c);
+        }
+        if(hi - lo > maxExtent) {
+          maxExtent = hi - lo;
+          axis = k;
+        }
+      }
+
+      const auto mid{(begin + end) / 2};
+      this->axes_[mid] = axis;
+      std::nth_element(this->perm_.begin() + begin, this->perm_.begin() + mid,
+                       this->perm_.begin() + end,
+                       [this, axis](const int a, const int b) {
+                         return this->points_[a][axis]
+                                < this->points_[b][axis];
+                       });
+      this->build(begin, mid);
+      this->build(mid + 1, end);
+    }
+
+    static constexpr size_t leafSize_{16};
+
+    const std::vector<Point> &points_;
+    std::vector<int> perm_;
+    std::vector<size_t> axes_;
+  };
+
+  /**
+   * @brief Compressed adjacency of one side of the candidate graph
+   */
+  void buildAdjacency(const size_t vertexNumber,
+                      const std::vector<ttk::BottleneckMatching::Edge> &edges,
+                      const size_t edgeNumber,
+                      const bool secondSide,
+                      std::vector<size_t> &offsets,
+                      std::vector<int> &neighbors) {
+    offsets.assign(vertexNumber + 1, 0);
+    for(size_t e = 0; e < edgeNumber; ++e) {
+      offsets[(secondSide ? edges[e].v2 : edges[e].v1) + 1]++;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    neighbors.resize(edgeNumber);
+    std::vector<size_t> pos(offsets.begin(), offsets.end() - 1);
+    for(size_t e = 0; e < edgeNumber; ++e) {
+      const auto &edge{edges[e]};
+      if(secondSide) {
+        neighbors[pos[edge.v2]++] = edge.v1;
+      } else {
+        neighbors[pos[edge.v1]++] = edge.v2;
+      }
+    }
+  }
+
+} // namespace
+
+bool ttk::BottleneckMatching::saturate(const std::vector<size_t> &offsets,
+                                       const std::vector<int> &neighbors,
+                                       const std::vector<bool> &heavy,
+                                       std::vector<int> &mate,
+                                       std::vector<int> &otherMate) {
+
+  // An augmenting path starts at an unmatched heavy vertex and ends at
+  // an unmatched vertex of the other side or at one matched to a light
+  // vertex, which is then matched to the diagonal. The matched heavy
+  // vertices of both sides stay matched.
+
+  const int n = mate.size();
+  const int inf = std::numeric_limits<int>::max();
+  std::vector<int> dist(n), queue{}, stack{};
+  std::vector<size_t> next(n);
+  queue.reserve(n);
+
+  while(true) {
+    // breadth-first search: layers of alternating paths
+    queue.clear();
+    for(int x = 0; x < n; ++x) {
+      if(heavy[x] && mate[x] == -1) {
+        dist[x] = 0;
+        queue.emplace_back(x);
+      } else {
+        dist[x] = inf;
+      }
+    }
+    int found = inf;
+    for(size_t q = 0; q < queue.size(); ++q) {
+      const int x = queue[q];
+      if(dist[x] >= found) {
+        continue;
+      }
+      for(size_t k = offsets[x]; k < offsets[x + 1]; ++k) {
+        const int x2 = otherMate[neighbors[k]];
+        if(x2 == -1 || !heavy[x2]) {
+          found = std::min(found, dist[x] + 1);
+        } else if(dist[x2] == inf) {
+          dist[x2] = dist[x] + 1;
+          queue.emplace_back(x2);
+        }
+      }
+    }
+    if(found == inf) {
+      break;
+    }
+
+    // depth-first search of vertex-disjoint shortest augmenting paths
+    for(int x = 0; x < n; ++x) {
+      next[x] = offsets[x];
+    }
+    for(int root = 0; root < n; ++root) {
+      if(!heavy[root] || mate[root] != -1) {
+        continue;
+      }
+      stack.clear();
+      stack.emplace_back(root);
+      while(!stack.empty()) {
+        const int x = stack.back();
+        if(next[x] == offsets[x + 1]) {
+          dist[x] = inf;
+          stack.pop_back();
+          if(!stack.empty()) {
+            next[stack.back()]++;
+          }
+          continue;
+        }
+        const int x2 = otherMate[neighbors[next[x]]];
+        if(x2 == -1 || !heavy[x2]) {
+          if(dist[x] + 1 == found) {
+            if(x2 != -1) {
+              mate[x2] = -1;
+            }
+            for(const int xs : stack) {
+              const int ys = neighbors[next[xs]];
+              mate[xs] = ys;
+              otherMate[ys] = xs;
+            }
+            break;
+          }
+          next[x]++;
+        } else if(dist[x2] == dist[x] + 1) {
+          stack.emplace_back(x2);
+        } else {
+          next[x]++;
+        }
+      }
+    }
+  }
+
+  for(int x = 0; x < n; ++x) {
+    if(heavy[x] && mate[x] == -1) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ttk::BottleneckMatching::isMatchable(const double threshold,
+                                          const size_t edgeNumber,
+                                          const std::vector<double> &diag1,
+                                          const std::vector<double> &diag2) {
+
+  const auto n1{diag1.size()};
+  const auto n2{diag2.size()};
+
+  std::vector<size_t> offsets1{}, offsets2{};
+  std::vector<int> neighbors1{}, neighbors2{};
+  buildAdjacency(n1, this->edges_, edgeNumber, false, offsets1, neighbors1);
+  buildAdjacency(n2, this->edges_, edgeNumber, true, offsets2, neighbors2);
+
+  // the light pairs can be matched to the diagonal
+  std::vector<bool> heavy1(n1), heavy2(n2);
+  for(size_t i = 0; i < n1; ++i) {
+    heavy1[i] = diag1[i] > threshold;
+  }
+  for(size_t j = 0; j < n2; ++j) {
+    heavy2[j] = diag2[j] > threshold;
+  }
+
+  this->mate1_.assign(n1, -1);
+  this->mate2_.assign(n2, -1);
+  return this->saturate(offsets1, neighbors1, heavy1, mate1_, mate2_)
+         && this->saturate(offsets2, neighbors2, heavy2, mate2_, mate1_);
+}
+
+int ttk::BottleneckMatching::run(
+  const std::vector<std::array<double, 2>> &points1,
+  const std::vector<double> &diag1,
+  const std::vector<std::array<double, 2>> &points2,
+  const std::vector<double> &diag2,
+  const CostFunction &cost,
+  std::vector<MatchingType> &matchings) {
+
+  Timer tm{};
+
+  const int n1 = points1.size();
+  const int n2 = points2.size();
+  matchings.clear();
+
+  const PlaneKDTree tree1{points1}, tree2{points2};
+
+  // matching every pair to the diagonal is always possible
+  double upperBound{}, minPositive{std::numeric_limits<double>::max()};
+  for(const auto *diag : {&diag1, &diag2}) {
+    for(const auto d : *diag) {
+      upperBound = std::max(upperBound, d);
+      if(d > 0.0) {
+        minPositive = std::min(minPositive, d);
+      }
+    }
+  }
+
+  // every pair is matched either to the diagonal or to a pair at least
+  // as far as its nearest neighbor
+  double lowerBound{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_) reduction(max : lowerBound)
+#endif // TTK_ENABLE_OPENMP
+  {
+    std::vector<std::tuple<size_t, size_t, double>> stack{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for
+#endif // TTK_ENABLE_OPENMP
+    for(int i = 0; i < n1; ++i) {
+      lowerBound = std::max(
+        lowerBound,
+        std::min(diag1[i], tree2.getNearestDistance(points1[i], stack)));
+    }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for
+#endif // TTK_ENABLE_OPENMP
+    for(int j = 0; j < n2; ++j) {
+      lowerBound = std::max(
+        lowerBound,
+        std::min(diag2[j], tree1.getNearestDistance(points2[j], stack)));
+    }
+  }
+
+  // candidate edges of weight lower or equal than the threshold: an
+  // edge is only needed while one of its ends is heavier than its
+  // weight, which bounds the query radius by the diagonal distance
+  const auto getEdges = [&](const double threshold) {
+    this->edges_.clear();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    {
+      std::vector<Edge> edges{};
+      std::vector<int> ids{};
+      std::vector<std::pair<size_t, size_t>> stack{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 64) nowait
+#endif // TTK_ENABLE_OPENMP
+      for(int i = 0; i < n1; ++i) {
+        tree2.getRange(points1[i], std::min(threshold, diag1[i]), ids, stack);
+        for(const auto j : ids) {
+          const auto c{cost(i, j)};
+          if(c <= threshold && c < diag1[i]) {
+            edges.emplace_back(Edge{i, j, c});
+          }
+        }
+      }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 64) nowait
+#endif // TTK_ENABLE_OPENMP
+      for(int j = 0; j < n2; ++j) {
+        tree1.getRange(points2[j], std::min(threshold, diag2[j]), ids, stack);
+        for(const auto i : ids) {
+          const auto c{cost(i, j)};
+          // edges already generated from the first set are skipped
+          if(c <= threshold && c < diag2[j] && c >= diag1[i]) {
+            edges.emplace_back(Edge{i, j, c});
+          }
+        }
+      }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp critical
+#endif // TTK_ENABLE_OPENMP
+      this->edges_.insert(this->edges_.end(), edges.begin(), edges.end());
+    }
+    TTK_PSORT(this->threadNumber_, this->edges_.begin(), this->edges_.end(),
+              [](const Edge &a, const Edge &b) {
+                return std::tie(a.weight, a.v1, a.v2)
+                       < std::tie(b.weight, b.v1, b.v2);
+              });
+  };
+
+  // double the threshold until a matching exists
+  auto threshold{lowerBound};
+  double infeasible{-1.0};
+  while(true) {
+    getEdges(threshold);
+    if(this->isMatchable(threshold, this->edges_.size(), diag1, diag2)) {
+      break;
+    }
+    if(threshold >= upperBound) {
+      this->printErr("Could not find a matching");
+      return -1;
+    }
+    infeasible = threshold;
+    threshold = threshold > 0.0 ? std::min(2.0 * threshold, upperBound)
+                                : std::min(minPositive, upperBound);
+  }
+
+  // binary search over the candidate weights
+  std::vector<double> weights{threshold};
+  for(const auto &e : this->edges_) {
+    if(e.weight > infeasible) {
+      weights.emplace_back(e.weight);
+    }
+  }
+  for(const auto *diag : {&diag1, &diag2}) {
+    for(const auto d : *diag) {
+      if(d > infeasible && d < threshold) {
+        weights.emplace_back(d);
+      }
+    }
+  }
+  TTK_PSORT(this->threadNumber_, weights.begin(), weights.end());
+  weights.erase(std::unique(weights.begin(), weights.end()), weights.end());
+
+  const auto getEdgeNumber = [this](const double w) {
+    return static_cast<size_t>(
+      std::upper_bound(this->edges_.begin(), this->edges_.end(), w,
+                       [](const double v, const Edge &e) {
+                         return v < e.weight;
+                       })
+      - this->edges_.begin());
+  };
+
+  size_t lo{}, hi{weights.size() - 1};
+  while(lo < hi) {
+    const auto mid{(lo + hi) / 2};
+    if(this->isMatchable(weights[mid], getEdgeNumber(weights[mid]), diag1,
+                         diag2)) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  this->distance_ = weights[hi];
+  this->isMatchable(
+    this->distance_, getEdgeNumber(this->distance_), diag1, diag2);
+
+  for(int i = 0; i < n1; ++i) {
+    if(this->mate1_[i] != -1) {
+      matchings.emplace_back(i, this->mate1_[i], cost(i, this->mate1_[i]));
+    } else {
+      matchings.emplace_back(i, n2, diag1[i]);
+    }
+  }
+  for(int j = 0; j < n2; ++j) {
+    if(this->mate2_[j] == -1) {
+      matchings.emplace_back(n1, j, diag2[j]);
+    }
+  }
+
+  this->printMsg("Matched " + std::to_string(n1) + " and "
+                   + std::to_string(n2) + " pairs ("
+                   + std::to_string(this->edges_.size()) + " candidate edges)",
+                 1.0, tm.getElapsedTime(), this->threadNumber_,
+                 debug::LineMode::NEW, debug::Priority::DETAIL);
+
+  return 0;
+}
@@ -0,0 +1,105 @@
+/// \ingroup base
+/// \class ttk::BottleneckMatching
+///
+/// \brief Geometric bottleneck matching between two sets of persistence
+/// pairs.
+///
+/// Instead of sorting the edges of the complete bipartite graph (see
+/// ttk::GabowTarjan), the candidate edges under a threshold are
+/// generated with range queries in a KD-tree of the (birth, death)
+/// plane. The threshold is doubled from a nearest-neighbor lower bound
+/// until a perfect matching exists, then refined by a binary search
+/// over the weights of the candidate edges. Each matching test runs the
+/// Hopcroft-Karp algorithm on the sparse candidate graph, the diagonal
+/// being handled implicitly: only the pairs farther from the diagonal
+/// than the threshold have to be matched to an actual pair.
+///
+/// \sa ttk::BottleneckDistance
+
+#pragma once
+
+#include <Debug.h>
+#include <PersistenceDiagramUtils.h>
+
+#include <array>
+#include <functional>
+#include <vector>
+
+namespace ttk {
+
+  class BottleneckMatching : virtual public Debug {
+
+  public:
+    BottleneckMatching() {
+      this->setDebugMsgPrefix("BottleneckMatching");
+    }
+
+    /**
+     * @brief Cost of matching the i-th pair of the first set with the
+     * j-th pair of the second set
+     */
+    using CostFunction = std::function<double(const int, const int)>;
+
+    /**
+     * @brief Compute a bottleneck matching
+     *
+     * The cost function must be bounded below by the L1 distance
+     * between the pair coordinates. A pair of the first set matched to
+     * the diagonal is reported as (i, points2.size(), cost), a pair of
+     * the second set as (points1.size(), j, cost).
+     *
+     * @param[in] points1 (birth, death) coordinates of the first set
+     * @param[in] diag1 costs of matching the first set to the diagonal
+     * @param[in] points2 (birth, death) coordinates of the second set
+     * @param[in] diag2 costs of matching the second set to the diagonal
+     * @param[in] cost cost of matching two pairs
+     * @param[out] matchings the bottleneck matching
+     * @return 0 in case of success
+     */
+    int run(const std::vector<std::array<double, 2>> &points1,
+            const std::vector<double> &diag1,
+            const std::vector<std::array<double, 2>> &points2,
+            const std::vector<double> &diag2,
+            const CostFunction &cost,
+            std::vector<MatchingType> &matchings);
+
+    inline double getDistance() const {
+      return this->distance_;
+    }
+
+    /**
+     * @brief Candidate edge between two pairs
+     */
+    struct Edge {
+      int v1;
+      int v2;
+      double weight;
+    };
+
+  protected:
+    /**
+     * @brief Check if a matching exists using only the first edgeNumber
+     * edges, store it in mate1_ and mate2_
+     */
+    bool isMatchable(const double threshold,
+                     const size_t edgeNumber,
+                     const std::vector<double> &diag1,
+                     const std::vector<double> &diag2);
+
+    /**
+     * @brief Match every pair of a set farther from the diagonal than
+     * the threshold (Hopcroft-Karp), without unmatching any such pair of
+     * the other set
+     */
+    bool saturate(const std::vector<size_t> &offsets,
+                  const std::vector<int> &neighbors,
+                  const std::vector<bool> &heavy,
+                  std::vector<int> &mate,
+                  std::vector<int> &otherMate);
+
+    double distance_{-1.0};
+    std::vector<Edge> edges_{};
+    std::vector<int> mate1_{}, mate2_{};
+  };
+
+} // namespace ttk
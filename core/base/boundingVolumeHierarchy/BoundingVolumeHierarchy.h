@@ -7,16 +7,26 @@
 /// Based on implementation described in Physically Based Rendering:
 /// From Theory to Implementation by Matt Pharr, Wenzel Jakob and
 /// Greg Humphreys.
+///
+/// The hierarchy is built top-down with a binned surface area
+/// heuristic (SAH), disjoint subtrees being built in parallel with
+/// OpenMP tasks. It is stored as a flat array of nodes in depth-first
+/// order (the first child of an interior node directly follows it)
+/// and the triangles are copied in leaf order with their edges
+/// precomputed, so that a traversal only reads contiguous memory.
+///
+/// Rays can be traced one by one or by packets of coherent rays
+/// sharing the node visits (see ttk::RayPacket).
 
 #pragma once
 
 #include "Ray.h"
-#include <Geometry.h>
+#include <BaseClass.h>
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <limits>
-#include <memory>
-#include <stack>
 #include <vector>
 
 namespace ttk {
@@ -24,355 +34,584 @@ namespace ttk {
   class BoundingVolumeHierarchy {
   protected:
     struct Node {
-      Node() = default;
-      // leaf constructor
-      Node(const std::vector<int> &triangleIndices,
-           const size_t nTriangles,
-           const float *pMin,
-           const float *pMax) {
-        m_minX = pMin[0];
-        m_minY = pMin[1];
-        m_minZ = pMin[2];
-        m_maxX = pMax[0];
-        m_maxY = pMax[1];
-        m_maxZ = pMax[2];
-        indices = triangleIndices;
-        numTriangles = nTriangles;
-      }
-      // interior constructor
-      Node(const int axis,
-           const std::shared_ptr<Node> &left,
-           const std::shared_ptr<Node> &right) {
-        numTriangles = 0;
-        m_left = left;
-        m_right = right;
-        m_splitAxis = axis;
-        m_minX = std::min(left->m_minX, right->m_minX);
-        m_minY = std::min(left->m_minY, right->m_minY);
-        m_minZ = std::min(left->m_minZ, right->m_minZ);
-        m_maxX = std::max(left->m_maxX, right->m_maxX);
-        m_maxY = std::max(left->m_maxY, right->m_maxY);
-        m_maxZ = std::max(left->m_maxZ, right->m_maxZ);
-      }
-
-      ~Node() = default;
-
-      std::vector<int> indices;
-      int numTriangles;
-      float m_minX, m_minY, m_minZ;
-      float m_maxX, m_maxY, m_maxZ;
-      std::shared_ptr<Node> m_left;
-      std::shared_ptr<Node> m_right;
-      int m_splitAxis;
+      float lower[3];
+      // first triangle of a leaf, second child of an interior node
+      int offset;
+      float upper[3];
+      // 0 for interior nodes
+      uint16_t nTriangles;
+      uint8_t axis;
     };
 
+    // first vertex and edges, as used by the Moller-Trumbore test
     struct Triangle {
-      int m_index;
-      float m_centroid_x, m_centroid_y, m_centroid_z;
-      float m_minX, m_minY, m_minZ;
-      float m_maxX, m_maxY, m_maxZ;
-      Triangle() = default;
-
-      void init(const int &index,
-                const float &centroid_x,
-                const float &centroid_y,
-                const float &centroid_z,
-                const float *pMin,
-                const float *pMax) {
-        m_index = index;
-        m_centroid_x = centroid_x;
-        m_centroid_y = centroid_y;
-        m_centroid_z = centroid_z;
-        m_minX = pMin[0];
-        m_minY = pMin[1];
-        m_minZ = pMin[2];
-
-        m_maxX = pMax[0];
-        m_maxY = pMax[1];
-        m_maxZ = pMax[2];
-      }
+      float v0[3];
+      float e1[3];
+      float e2[3];
     };
 
+    // triangle bounds used during the construction
+    struct Primitive {
+      float lower[3];
+      float upper[3];
+      float centroid[3];
+      int index;
+    };
+
+    // SAH parameters
+    static constexpr int nBins_{16};
+    static constexpr int maxLeafSize_{4};
+    static constexpr float traversalCost_{0.125f};
+    // beyond this depth, nodes are split at the median to bound the
+    // depth of the hierarchy (and the size of the traversal stack)
+    static constexpr int maxSahDepth_{64};
+    static constexpr int maxDepth_{maxSahDepth_ + 32};
+    // minimum number of triangles of a subtree built by a task
+    static constexpr int minTaskSize_{4096};
+
   public:
     BoundingVolumeHierarchy(const float *coords,
                             const IT *connectivityList,
-                            const size_t &nTriangles) {
-      std::vector<Triangle> triangles;
-      buildTriangleList(triangles, coords, connectivityList, nTriangles);
-
-      this->nodes = buildTree(triangles, 0, nTriangles);
+                            const size_t &nTriangles,
+                            const int threadNumber = 1) {
+      this->build(coords, connectivityList, nTriangles, threadNumber);
     }
 
     ~BoundingVolumeHierarchy() = default;
 
-    std::shared_ptr<Node>
-      buildTree(std::vector<Triangle> &triangles, size_t start, size_t end) {
-
-      float minX, minY, minZ;
-      float maxX, maxY, maxZ;
-      minX = minY = minZ = std::numeric_limits<float>::max();
-      maxX = maxY = maxZ = std::numeric_limits<float>::min();
-      for(size_t i = start; i < end; i++) {
-        const Triangle &t = triangles[i];
-        minX = std::min(t.m_minX, minX);
-        minY = std::min(t.m_minY, minY);
-        minZ = std::min(t.m_minZ, minZ);
-
-        maxX = std::max(t.m_maxX, maxX);
-        maxY = std::max(t.m_maxY, maxY);
-        maxZ = std::max(t.m_maxZ, maxZ);
+    inline size_t getNumberOfNodes() const {
+      return this->nodes_.size();
+    }
+
+    /**
+     * @brief Find the closest triangle hit by a ray
+     *
+     * Only intersections in front of the ray origin are reported. On
+     * hit, @p r holds the distance and the barycentric coordinates of
+     * the intersection.
+     *
+     * @return true if a triangle was hit
+     */
+    bool intersect(Ray &r, int *triangleIndex, float *distance) const {
+      if(this->nodes_.empty()) {
+        return false;
       }
-      const int numberTriangles = end - start;
-      if(numberTriangles == 1) {
-        const Triangle &t = triangles[start];
-        std::vector<int> const indices = {t.m_index};
-        float pMin[3] = {t.m_minX, t.m_minY, t.m_minZ};
-        float pMax[3] = {t.m_maxX, t.m_maxY, t.m_maxZ};
-        return std::make_shared<Node>(indices, 1, pMin, pMax);
-      } else {
-        // find the bounds of the centroids, figure out what dimension to split
-        // on
-        float cminX, cminY, cminZ;
-        float cmaxX, cmaxY, cmaxZ;
-        cminX = cminY = cminZ = std::numeric_limits<float>::max();
-        cmaxX = cmaxY = cmaxZ = std::numeric_limits<float>::min();
-        for(size_t i = start; i < end; i++) {
-          const Triangle &t = triangles[i];
-          cminX = std::min(t.m_centroid_x, cminX);
-          cminY = std::min(t.m_centroid_y, cminY);
-          cminZ = std::min(t.m_centroid_z, cminZ);
-
-          cmaxX = std::max(t.m_centroid_x, cmaxX);
-          cmaxY = std::max(t.m_centroid_y, cmaxY);
-          cmaxZ = std::max(t.m_centroid_z, cmaxZ);
-        }
-        // figure out the biggest extent, use that dimension
-        const float diffX = std::abs(cmaxX - cminX);
-        const float diffY = std::abs(cmaxY - cminY);
-        const float diffZ = std::abs(cmaxZ - cminZ);
-        const float maximumExtent = std::max({diffX, diffY, diffZ});
-        int axis;
-        float minToCheck, maxToCheck;
-        if(maximumExtent == diffX) {
-          axis = 0;
-          minToCheck = cminX;
-          maxToCheck = cmaxX;
-        } else if(maximumExtent == diffY) {
-          axis = 1;
-          minToCheck = cminY;
-          maxToCheck = cmaxY;
-        } else {
-          axis = 2;
-          minToCheck = cminZ;
-          maxToCheck = cmaxZ;
-        }
-        size_t const half = (start + end) / 2;
-        // partition triangles into two sets and build children
-        if(minToCheck == maxToCheck) {
 
-          std::vector<int> triangleIndices;
-          for(size_t i = start; i < end; i++) {
-            triangleIndices.push_back(triangles[i].m_index);
+      const float *org = r.m_origin;
+      const float *dir = r.m_direction;
+      const float invDir[3]
+        = {1.0f / dir[0], 1.0f / dir[1], 1.0f / dir[2]};
+
+      float tMax = std::numeric_limits<float>::infinity();
+      int hit = -1;
+
+      std::array<int, maxDepth_> stack;
+      int stackSize = 0;
+      int current = 0;
+      while(true) {
+        const Node &node = this->nodes_[current];
+        if(this->boxHit(node, org, invDir, tMax)) {
+          if(node.nTriangles > 0) {
+            for(int i = node.offset; i < node.offset + node.nTriangles;
+                i++) {
+              float t, u, v;
+              if(this->triangleHit(this->triangles_[i], org, dir, t, u, v)
+                 && t < tMax) {
+                tMax = t;
+                hit = i;
+                r.u = u;
+                r.v = v;
+              }
+            }
+          } else {
+            // visit the closest child first
+            if(dir[node.axis] < 0) {
+              stack[stackSize++] = current + 1;
+              current = node.offset;
+            } else {
+              stack[stackSize++] = node.offset;
+              current = current + 1;
+            }
+            continue;
           }
-          float pMin[3] = {minX, minY, minZ};
-          float pMax[3] = {maxX, maxY, maxZ};
-          return std::make_shared<Node>(
-            triangleIndices, triangleIndices.size(), pMin, pMax);
-        } else {
-          // partition triangles into equally sized subsets
-          std::nth_element(&triangles[start], &triangles[half],
-                           &triangles[end - 1] + 1,
-                           [axis](const Triangle &t1, const Triangle &t2) {
-                             switch(axis) {
-                               case 0:
-                               default:
-                                 return t1.m_centroid_x < t2.m_centroid_x;
-                                 break;
-                               case 1:
-                                 return t1.m_centroid_y < t2.m_centroid_y;
-                                 break;
-                               case 2:
-                                 return t1.m_centroid_z < t2.m_centroid_z;
-                                 break;
-                             }
-                           });
-
-          return std::make_shared<Node>(axis, buildTree(triangles, start, half),
-                                        buildTree(triangles, half, end));
         }
+        if(stackSize == 0) {
+          break;
+        }
+        current = stack[--stackSize];
       }
 
-      return nullptr;
-    }
-    int buildTriangleList(std::vector<Triangle> &triangles,
-                          const float *coords,
-                          const IT *connectivityList,
-                          const size_t &nTriangles) {
-      triangles.resize(nTriangles);
-      for(size_t ti = 0; ti < nTriangles; ti++) {
-
-        const IT v1 = connectivityList[ti * 3 + 0] * 3;
-        const IT v2 = connectivityList[ti * 3 + 1] * 3;
-        const IT v3 = connectivityList[ti * 3 + 2] * 3;
-
-        const float &x1 = coords[v1 + 0];
-        const float &x2 = coords[v2 + 0];
-        const float &x3 = coords[v3 + 0];
-
-        const float &y1 = coords[v1 + 1];
-        const float &y2 = coords[v2 + 1];
-        const float &y3 = coords[v3 + 1];
-
-        const float &z1 = coords[v1 + 2];
-        const float &z2 = coords[v2 + 2];
-        const float &z3 = coords[v3 + 2];
-
-        const float pMin[3] = {std::min({x1, x2, x3}), std::min({y1, y2, y3}),
-                               std::min({z1, z2, z3})};
-        const float pMax[3] = {std::max({x1, x2, x3}), std::max({y1, y2, y3}),
-                               std::max({z1, z2, z3})};
-
-        triangles[ti].init(ti, findCentroid(x1, x2, x3),
-                           findCentroid(y1, y2, y3), findCentroid(z1, z2, z3),
-                           pMin, pMax);
+      if(hit == -1) {
+        return false;
       }
-
-      return 1;
+      r.distance = tMax;
+      *triangleIndex = this->triangleIds_[hit];
+      *distance = tMax;
+      return true;
     }
 
-    bool MollerTrumbore(Ray &ray,
-                        const IT v0,
-                        const IT v1,
-                        const IT v2,
-                        const float *vertexCoords) const {
-      constexpr float kEpsilon = 1e-8;
+    /**
+     * @brief Find the closest triangles hit by a packet of rays
+     *
+     * A node is visited if any ray of the packet hits its bounding box,
+     * the children being ordered according to the direction of the
+     * first ray. Per-ray computations are written without branches to
+     * be vectorized.
+     */
+    template <int width>
+    void intersect(RayPacket<width> &packet) const {
+      float invDir[3][width];
+      float tMax[width];
+      int hit[width];
+      for(int l = 0; l < width; l++) {
+        for(int k = 0; k < 3; k++) {
+          invDir[k][l] = 1.0f / packet.direction[k][l];
+        }
+        // inactive rays never hit
+        tMax[l] = l < packet.nRays ? std::numeric_limits<float>::infinity()
+                                   : -1.0f;
+        hit[l] = -1;
+      }
 
-      float v0v1[3], v0v2[3], pvec[3], tvec[3], qvec[3];
-      ttk::Geometry::subtractVectors(
-        &vertexCoords[v0], &vertexCoords[v1], v0v1);
-      ttk::Geometry::subtractVectors(
-        &vertexCoords[v0], &vertexCoords[v2], v0v2);
-      ttk::Geometry::crossProduct(ray.m_direction, v0v2, pvec);
-      const float det = ttk::Geometry::dotProduct(v0v1, pvec);
-      if(det > -kEpsilon && det < kEpsilon)
-        return false;
+      if(!this->nodes_.empty()) {
+        const bool dirIsNeg[3] = {packet.direction[0][0] < 0,
+                                  packet.direction[1][0] < 0,
+                                  packet.direction[2][0] < 0};
+
+        std::array<int, maxDepth_> stack;
+        int stackSize = 0;
+        int current = 0;
+        while(true) {
+          const Node &node = this->nodes_[current];
+          if(this->boxHit(node, packet, invDir, tMax)) {
+            if(node.nTriangles > 0) {
+              for(int i = node.offset; i < node.offset + node.nTriangles;
+                  i++) {
+                this->triangleHit(i, packet, tMax, hit);
+              }
+            } else {
+              if(dirIsNeg[node.axis]) {
+                stack[stackSize++] = current + 1;
+                current = node.offset;
+              } else {
+                stack[stackSize++] = node.offset;
+                current = current + 1;
+              }
+              continue;
+            }
+          }
+          if(stackSize == 0) {
+            break;
+          }
+          current = stack[--stackSize];
+        }
+      }
 
-      const float invDet = 1.0f / det;
+      for(int l = 0; l < width; l++) {
+        if(hit[l] != -1) {
+          packet.distance[l] = tMax[l];
+          packet.primitiveId[l] = this->triangleIds_[hit[l]];
+        } else {
+          packet.primitiveId[l] = -1;
+        }
+      }
+    }
 
-      ttk::Geometry::subtractVectors(&vertexCoords[v0], ray.m_origin, tvec);
-      const float u = ttk::Geometry::dotProduct(tvec, pvec) * invDet;
-      if(u < 0.0 || u > 1.0)
-        return false;
+  protected:
+    int build(const float *coords,
+              const IT *connectivityList,
+              const size_t nTriangles,
+              const int threadNumber) {
+
+      this->nodes_.clear();
+      this->triangles_.clear();
+      this->triangleIds_.clear();
+      if(nTriangles == 0) {
+        return 0;
+      }
 
-      ttk::Geometry::crossProduct(tvec, v0v1, qvec);
-      const float v = ttk::Geometry::dotProduct(ray.m_direction, qvec) * invDet;
-      if(v < 0.0 || u + v > 1.0)
-        return false;
+      std::vector<Primitive> primitives(nTriangles);
+
+      TTK_FORCE_USE(threadNumber);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 0; i < nTriangles; i++) {
+        auto &p = primitives[i];
+        p.index = i;
+        for(int k = 0; k < 3; k++) {
+          const float x0 = coords[connectivityList[i * 3 + 0] * 3 + k];
+          const float x1 = coords[connectivityList[i * 3 + 1] * 3 + k];
+          const float x2 = coords[connectivityList[i * 3 + 2] * 3 + k];
+          p.lower[k] = std::min({x0, x1, x2});
+          p.upper[k] = std::max({x0, x1, x2});
+          p.centroid[k] = (x0 + x1 + x2) / 3;
+        }
+      }
 
-      const float t = ttk::Geometry::dotProduct(v0v2, qvec) * invDet;
-      ray.distance = t;
-      ray.u = u;
-      ray.v = v;
+      // a subtree of n triangles has at most 2n - 1 nodes: the slots
+      // following a node are reserved for its descendants, the left
+      // subtree first (depth-first order with holes, removed after the
+      // build)
+      std::vector<Node> nodes(2 * nTriangles - 1);
+      std::vector<char> isUsed(nodes.size(), 0);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber)
+#pragma omp single nowait
+#endif // TTK_ENABLE_OPENMP
+      this->buildNode(primitives, nodes, isUsed, 0, nTriangles, 0, 0);
+
+      // remove the unused node slots
+      std::vector<int> newIds(nodes.size());
+      int nNodes = 0;
+      for(size_t i = 0; i < nodes.size(); i++) {
+        newIds[i] = nNodes;
+        nNodes += isUsed[i];
+      }
+      this->nodes_.resize(nNodes);
+      for(size_t i = 0; i < nodes.size(); i++) {
+        if(isUsed[i]) {
+          auto &node = this->nodes_[newIds[i]];
+          node = nodes[i];
+          if(node.nTriangles == 0) {
+            node.offset = newIds[node.offset];
+          }
+        }
+      }
 
-      return true;
+      // triangles in leaf order
+      this->triangles_.resize(nTriangles);
+      this->triangleIds_.resize(nTriangles);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 0; i < nTriangles; i++) {
+        const int index = primitives[i].index;
+        const IT v0 = connectivityList[index * 3 + 0] * 3;
+        const IT v1 = connectivityList[index * 3 + 1] * 3;
+        const IT v2 = connectivityList[index * 3 + 2] * 3;
+        auto &t = this->triangles_[i];
+        for(int k = 0; k < 3; k++) {
+          t.v0[k] = coords[v0 + k];
+          t.e1[k] = coords[v1 + k] - coords[v0 + k];
+          t.e2[k] = coords[v2 + k] - coords[v0 + k];
+        }
+        this->triangleIds_[i] = index;
+      }
+
+      return 0;
     }
 
-    bool intersect(Ray &r,
-                   const IT *connectivityList,
-                   const float *vertexCoords,
-                   int *triangleIndex,
-                   float *distance) const {
-      bool wasHit = false;
-      float nearestTriangle = std::numeric_limits<float>::max();
-      std::stack<Node *> stack;
-      Node *node = &nodes.get()[0];
-      if(!wasNodeHit(r, node)) {
-        return false;
+    void buildNode(std::vector<Primitive> &primitives,
+                   std::vector<Node> &nodes,
+                   std::vector<char> &isUsed,
+                   const int start,
+                   const int end,
+                   const int nodeId,
+                   const int depth) const {
+
+      Node &node = nodes[nodeId];
+      isUsed[nodeId] = 1;
+
+      float cLower[3], cUpper[3];
+      for(int k = 0; k < 3; k++) {
+        node.lower[k] = cLower[k] = std::numeric_limits<float>::max();
+        node.upper[k] = cUpper[k] = std::numeric_limits<float>::lowest();
       }
-      stack.push(node);
-      while(stack.size() != 0) {
-        node = stack.top();
-        stack.pop();
-        if(wasNodeHit(r, node)) {
-
-          if(node->numTriangles > 0) {
-
-            for(int i = 0; i < node->numTriangles; i++) {
-              bool hasHit = false;
-              int const triIdx = node->indices[i];
-
-              IT v0 = connectivityList[triIdx * 3 + 0];
-              IT v1 = connectivityList[triIdx * 3 + 1];
-              IT v2 = connectivityList[triIdx * 3 + 2];
-              v0 *= 3;
-              v1 *= 3;
-              v2 *= 3;
-              hasHit = MollerTrumbore(r, v0, v1, v2, vertexCoords);
-              if(hasHit && r.distance < nearestTriangle) {
-                *triangleIndex = triIdx;
-                nearestTriangle = r.distance;
-                wasHit = true;
-                *distance = r.distance;
-              }
+      for(int i = start; i < end; i++) {
+        const auto &p = primitives[i];
+        for(int k = 0; k < 3; k++) {
+          node.lower[k] = std::min(node.lower[k], p.lower[k]);
+          node.upper[k] = std::max(node.upper[k], p.upper[k]);
+          cLower[k] = std::min(cLower[k], p.centroid[k]);
+          cUpper[k] = std::max(cUpper[k], p.centroid[k]);
+        }
+      }
+
+      const int n = end - start;
+      if(n == 1) {
+        node.offset = start;
+        node.nTriangles = 1;
+        node.axis = 0;
+        return;
+      }
+
+      // find the best split among the bins of the three axes
+      int bestAxis = -1;
+      int bestBin = 0;
+      float bestCost = std::numeric_limits<float>::max();
+      if(depth < maxSahDepth_) {
+        for(int k = 0; k < 3; k++) {
+          if(cUpper[k] <= cLower[k]) {
+            continue;
+          }
+          const float scale = nBins_ / (cUpper[k] - cLower[k]);
+          int counts[nBins_]{};
+          float lower[nBins_][3], upper[nBins_][3];
+          for(int b = 0; b < nBins_; b++) {
+            for(int j = 0; j < 3; j++) {
+              lower[b][j] = std::numeric_limits<float>::max();
+              upper[b][j] = std::numeric_limits<float>::lowest();
             }
-          } else {
+          }
+          for(int i = start; i < end; i++) {
+            const auto &p = primitives[i];
+            const int b = this->getBin(p, k, cLower[k], scale);
+            counts[b]++;
+            for(int j = 0; j < 3; j++) {
+              lower[b][j] = std::min(lower[b][j], p.lower[j]);
+              upper[b][j] = std::max(upper[b][j], p.upper[j]);
+            }
+          }
 
-            if(node->m_right != nullptr) {
-              stack.push(node->m_right.get());
+          // sweep from the right to get the costs of the right parts
+          float rightCosts[nBins_];
+          float rLower[3], rUpper[3];
+          int rCount = 0;
+          for(int j = 0; j < 3; j++) {
+            rLower[j] = std::numeric_limits<float>::max();
+            rUpper[j] = std::numeric_limits<float>::lowest();
+          }
+          for(int b = nBins_ - 1; b > 0; b--) {
+            rCount += counts[b];
+            for(int j = 0; j < 3; j++) {
+              rLower[j] = std::min(rLower[j], lower[b][j]);
+              rUpper[j] = std::max(rUpper[j], upper[b][j]);
             }
-            if(node->m_left != nullptr) {
-              stack.push(node->m_left.get());
+            rightCosts[b] = rCount * this->halfArea(rLower, rUpper);
+          }
+
+          // sweep from the left, split between bins b and b + 1
+          float lLower[3], lUpper[3];
+          int lCount = 0;
+          for(int j = 0; j < 3; j++) {
+            lLower[j] = std::numeric_limits<float>::max();
+            lUpper[j] = std::numeric_limits<float>::lowest();
+          }
+          for(int b = 0; b < nBins_ - 1; b++) {
+            lCount += counts[b];
+            for(int j = 0; j < 3; j++) {
+              lLower[j] = std::min(lLower[j], lower[b][j]);
+              lUpper[j] = std::max(lUpper[j], upper[b][j]);
+            }
+            if(lCount == 0 || lCount == n) {
+              continue;
+            }
+            const float cost
+              = lCount * this->halfArea(lLower, lUpper) + rightCosts[b + 1];
+            if(cost < bestCost) {
+              bestCost = cost;
+              bestAxis = k;
+              bestBin = b;
             }
           }
         }
       }
-      return wasHit;
-    }
 
-    bool wasNodeHit(const Ray &r, Node *n) const {
-      float tmin = (n->m_minX - r.m_origin[0]) / r.m_direction[0];
-      float tmax = (n->m_maxX - r.m_origin[0]) / r.m_direction[0];
+      int mid = start;
+      if(bestAxis != -1) {
+        const float nodeArea = this->halfArea(node.lower, node.upper);
+        const float splitCost
+          = nodeArea > 0 ? traversalCost_ + bestCost / nodeArea : n;
+        if(n <= maxLeafSize_ && n <= splitCost) {
+          node.offset = start;
+          node.nTriangles = n;
+          node.axis = 0;
+          return;
+        }
+        const float scale = nBins_ / (cUpper[bestAxis] - cLower[bestAxis]);
+        mid = std::partition(primitives.begin() + start,
+                             primitives.begin() + end,
+                             [&](const Primitive &p) {
+                               return this->getBin(
+                                        p, bestAxis, cLower[bestAxis], scale)
+                                      <= bestBin;
+                             })
+              - primitives.begin();
+        node.axis = bestAxis;
+      } else if(n <= maxLeafSize_) {
+        node.offset = start;
+        node.nTriangles = n;
+        node.axis = 0;
+        return;
+      }
+
+      if(mid == start || mid == end) {
+        // coincident centroids or maximal depth: median split on the
+        // largest extent
+        int axis = 0;
+        for(int k = 1; k < 3; k++) {
+          if(cUpper[k] - cLower[k] > cUpper[axis] - cLower[axis]) {
+            axis = k;
+          }
+        }
+        mid = (start + end) / 2;
+        std::nth_element(primitives.begin() + start, primitives.begin() + mid,
+                         primitives.begin() + end,
+                         [axis](const Primitive &a, const Primitive &b) {
+                           return a.centroid[axis] < b.centroid[axis];
+                         });
+        node.axis = axis;
+      }
 
-      if(tmin > tmax)
-        std::swap(tmin, tmax);
+      node.nTriangles = 0;
+      const int leftId = nodeId + 1;
+      const int rightId = nodeId + 2 * (mid - start);
+      node.offset = rightId;
+
+      if(n > minTaskSize_) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp task shared(primitives, nodes, isUsed)
+#endif // TTK_ENABLE_OPENMP
+        this->buildNode(
+          primitives, nodes, isUsed, start, mid, leftId, depth + 1);
+        this->buildNode(
+          primitives, nodes, isUsed, mid, end, rightId, depth + 1);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp taskwait
+#endif // TTK_ENABLE_OPENMP
+      } else {
+        this->buildNode(
+          primitives, nodes, isUsed, start, mid, leftId, depth + 1);
+        this->buildNode(
+          primitives, nodes, isUsed, mid, end, rightId, depth + 1);
+      }
+    }
 
-      float tymin = (n->m_minY - r.m_origin[1]) / r.m_direction[1];
-      float tymax = (n->m_maxY - r.m_origin[1]) / r.m_direction[1];
+    inline int getBin(const Primitive &p,
+                      const int axis,
+                      const float origin,
+                      const float scale) const {
+      const int b = (p.centroid[axis] - origin) * scale;
+      return std::min(b, nBins_ - 1);
+    }
 
-      if(tymin > tymax)
-        std::swap(tymin, tymax);
+    inline float halfArea(const float *lower, const float *upper) const {
+      const float dx = upper[0] - lower[0];
+      const float dy = upper[1] - lower[1];
+      const float dz = upper[2] - lower[2];
+      return dx * dy + dy * dz + dz * dx;
+    }
 
-      if((tmin > tymax) || (tymin > tmax))
-        return false;
+    inline bool boxHit(const Node &n,
+                       const float *org,
+                       const float *invDir,
+                       const float tMax) const {
+      float tNear = 0;
+      float tFar = tMax;
+      for(int k = 0; k < 3; k++) {
+        const float t0 = (n.lower[k] - org[k]) * invDir[k];
+        const float t1 = (n.upper[k] - org[k]) * invDir[k];
+        tNear = std::max(tNear, std::min(t0, t1));
+        tFar = std::min(tFar, std::max(t0, t1));
+      }
+      return tNear <= tFar;
+    }
 
-      if(tymin > tmin)
-        tmin = tymin;
+    template <int width>
+    inline bool boxHit(const Node &n,
+                       const RayPacket<width> &packet,
+                       const float invDir[3][width],
+                       const float tMax[width]) const {
+      int isHit = 0;
+      for(int l = 0; l < width; l++) {
+        float tNear = 0;
+        float tFar = tMax[l];
+        for(int k = 0; k < 3; k++) {
+          const float t0 = (n.lower[k] - packet.origin[k][l]) * invDir[k][l];
+          const float t1 = (n.upper[k] - packet.origin[k][l]) * invDir[k][l];
+          tNear = std::max(tNear, std::min(t0, t1));
+          tFar = std::min(tFar, std::max(t0, t1));
+        }
+        isHit |= tNear <= tFar;
+      }
+      return isHit;
+    }
 
-      if(tymax < tmax)
-        tmax = tymax;
+    // Moller-Trumbore ray-triangle intersection
+    inline bool triangleHit(const Triangle &tri,
+                            const float *org,
+                            const float *dir,
+                            float &t,
+                            float &u,
+                            float &v) const {
+      constexpr float kEpsilon = 1e-8;
 
-      float tzmin = (n->m_minZ - r.m_origin[2]) / r.m_direction[2];
-      float tzmax = (n->m_maxZ - r.m_origin[2]) / r.m_direction[2];
+      const float pvec[3] = {dir[1] * tri.e2[2] - dir[2] * tri.e2[1],
+                             dir[2] * tri.e2[0] - dir[0] * tri.e2[2],
+                             dir[0] * tri.e2[1] - dir[1] * tri.e2[0]};
+      const float det
+        = tri.e1[0] * pvec[0] + tri.e1[1] * pvec[1] + tri.e1[2] * pvec[2];
+      if(det > -kEpsilon && det < kEpsilon)
+        return false;
 
-      if(tzmin > tzmax)
-        std::swap(tzmin, tzmax);
+      const float invDet = 1.0f / det;
 
-      if((tmin > tzmax) || (tzmin > tmax))
+      const float tvec[3]
+        = {org[0] - tri.v0[0], org[1] - tri.v0[1], org[2] - tri.v0[2]};
+      u = (tvec[0] * pvec[0] + tvec[1] * pvec[1] + tvec[2] * pvec[2]) * invDet;
+      if(u < 0.0 || u > 1.0)
         return false;
 
-      if(tzmin > tmin)
-        tmin = tzmin;
+      const float qvec[3] = {tvec[1] * tri.e1[2] - tvec[2] * tri.e1[1],
+                             tvec[2] * tri.e1[0] - tvec[0] * tri.e1[2],
+                             tvec[0] * tri.e1[1] - tvec[1] * tri.e1[0]};
+      v = (dir[0] * qvec[0] + dir[1] * qvec[1] + dir[2] * qvec[2]) * invDet;
+      if(v < 0.0 || u + v > 1.0)
+        return false;
 
-      if(tzmax < tmax)
-        tmax = tzmax;
+      t = (tri.e2[0] * qvec[0] + tri.e2[1] * qvec[1] + tri.e2[2] * qvec[2])
+          * invDet;
+      return t > 0;
+    }
 
-      return true;
+    template <int width>
+    inline void triangleHit(const int triangleId,
+                            RayPacket<width> &packet,
+                            float tMax[width],
+                            int hit[width]) const {
+      constexpr float kEpsilon = 1e-8;
+      const Triangle &tri = this->triangles_[triangleId];
+
+      for(int l = 0; l < width; l++) {
+        const float dx = packet.direction[0][l];
+        const float dy = packet.direction[1][l];
+        const float dz = packet.direction[2][l];
+
+        const float px = dy * tri.e2[2] - dz * tri.e2[1];
+        const float py = dz * tri.e2[0] - dx * tri.e2[2];
+        const float pz = dx * tri.e2[1] - dy * tri.e2[0];
+        const float det = tri.e1[0] * px + tri.e1[1] * py + tri.e1[2] * pz;
+        const float invDet = 1.0f / det;
+
+        const float tx = packet.origin[0][l] - tri.v0[0];
+        const float ty = packet.origin[1][l] - tri.v0[1];
+        const float tz = packet.origin[2][l] - tri.v0[2];
+        const float u = (tx * px + ty * py + tz * pz) * invDet;
+
+        const float qx = ty * tri.e1[2] - tz * tri.e1[1];
+        const float qy = tz * tri.e1[0] - tx * tri.e1[2];
+        const float qz = tx * tri.e1[1] - ty * tri.e1[0];
+        const float v = (dx * qx + dy * qy + dz * qz) * invDet;
+        const float t
+          = (tri.e2[0] * qx + tri.e2[1] * qy + tri.e2[2] * qz) * invDet;
+
+        const bool isHit = (det <= -kEpsilon || det >= kEpsilon) && u >= 0
+                           && u <= 1 && v >= 0 && u + v <= 1 && t > 0
+                           && t < tMax[l];
+        tMax[l] = isHit ? t : tMax[l];
+        hit[l] = isHit ? triangleId : hit[l];
+        packet.u[l] = isHit ? u : packet.u[l];
+        packet.v[l] = isHit ? v : packet.v[l];
+      }
     }
 
   private:
-    std::shared_ptr<Node> nodes;
-    float findCentroid(const float &v1, const float &v2, const float &v3) {
-      return (v1 + v2 + v3) / 3;
-    }
+    std::vector<Node> nodes_{};
+    std::vector<Triangle> triangles_{};
+    // triangle ids in the input connectivity list
+    std::vector<int> triangleIds_{};
   };
 } // namespace ttk
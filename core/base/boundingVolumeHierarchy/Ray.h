@@ -23,4 +23,29 @@ namespace ttk {
     float u;
     float v;
   };
-} // namespace ttk
\ No newline at end of file
+
+  /**
+   * @brief Packet of rays traced together through a
+   * ttk::BoundingVolumeHierarchy
+   *
+   * Rays are stored as a structure of arrays so that the computations
+   * on the whole packet are vectorized. Only the first nRays rays are
+   * traced. Packets are meant for coherent rays (e.g. neighboring
+   * pixels), which visit the same nodes of the hierarchy.
+   */
+  template <int width>
+  struct RayPacket {
+    static constexpr int size{width};
+
+    // input
+    float origin[3][width];
+    float direction[3][width];
+    int nRays{width};
+
+    // output, primitiveId is -1 for rays that hit nothing
+    float distance[width];
+    float u[width];
+    float v[width];
+    int primitiveId[width];
+  };
+} // namespace ttk
@@ -50,9 +50,9 @@ int ttk::CinemaImagingNative::renderImage(
   unsigned int *primitiveIds,
   float *barycentricCoordinates,
   const size_t &ttkNotUsed(nVertices),
-  const float *vertexCoords,
+  const float *ttkNotUsed(vertexCoords),
   const size_t &ttkNotUsed(nTriangles),
-  const IT *connectivityList,
+  const IT *ttkNotUsed(connectivityList),
   const BoundingVolumeHierarchy<IT> &bvh,
   const double resolution[2],
   const double camPos[3],
@@ -116,6 +116,28 @@ int ttk::CinemaImagingNative::renderImage(
                                     - camUpTrue[2] * camHeightWorldHalf};
 
   float const nan = std::numeric_limits<float>::quiet_NaN();
+
+  // trace the rays of a row by packets of adjacent pixels, which are
+  // coherent enough to share the traversal of the hierarchy
+  constexpr int packetWidth = 8;
+  const auto storePacket = [&](const RayPacket<packetWidth> &packet,
+                               const size_t pixelIndex) {
+    for(int l = 0; l < packet.nRays; l++) {
+      const size_t p = pixelIndex + l;
+      if(packet.primitiveId[l] != -1) {
+        depthBuffer[p] = packet.distance[l];
+        primitiveIds[p] = packet.primitiveId[l];
+        barycentricCoordinates[2 * p] = packet.u[l];
+        barycentricCoordinates[2 * p + 1] = packet.v[l];
+      } else {
+        depthBuffer[p] = nan;
+        primitiveIds[p] = CinemaImaging::INVALID_ID;
+        barycentricCoordinates[2 * p] = nan;
+        barycentricCoordinates[2 * p + 1] = nan;
+      }
+    }
+  };
+
   if(orthographicProjection) {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(this->threadNumber_)
@@ -123,48 +145,30 @@ int ttk::CinemaImagingNative::renderImage(
     for(int y = 0; y < resY; y++) {
       double const v = ((double)y) * pixelHeightWorld;
 
-      size_t pixelIndex = y * resX;
-      size_t bcIndex = 2 * pixelIndex;
-
-      for(int x = 0; x < resX; x++) {
-        double const u = ((double)x) * pixelWidthWorld;
-
-        depthBuffer[pixelIndex] = nan;
-        primitiveIds[pixelIndex] = CinemaImaging::INVALID_ID;
-        barycentricCoordinates[bcIndex] = nan;
-        barycentricCoordinates[bcIndex + 1] = nan;
-
-        // set origin
-        float const org_x
-          = camPosCorner[0] + u * camRight[0] + v * camUpTrue[0];
-        float const org_y
-          = camPosCorner[1] + u * camRight[1] + v * camUpTrue[1];
-        float const org_z
-          = camPosCorner[2] + u * camRight[2] + v * camUpTrue[2];
-
-        float ray_origin[3] = {org_x, org_y, org_z};
-
+      RayPacket<packetWidth> packet;
+      for(int l = 0; l < packetWidth; l++) {
         // set dir
-        float const dir_x = camDir[0];
-        float const dir_y = camDir[1];
-        float const dir_z = camDir[2];
-
-        float ray_dir[3] = {dir_x, dir_y, dir_z};
-
-        Ray ray(ray_dir, ray_origin);
-        bool wasHit = false;
-        int triIdx;
-        float distance;
-        wasHit = bvh.intersect(
-          ray, connectivityList, vertexCoords, &triIdx, &distance);
-        if(wasHit) {
-          depthBuffer[pixelIndex] = distance;
-          primitiveIds[pixelIndex] = triIdx;
-          barycentricCoordinates[bcIndex] = ray.u;
-          barycentricCoordinates[bcIndex + 1] = ray.v;
+        packet.direction[0][l] = camDir[0];
+        packet.direction[1][l] = camDir[1];
+        packet.direction[2][l] = camDir[2];
+      }
+
+      for(int x0 = 0; x0 < resX; x0 += packetWidth) {
+        packet.nRays = std::min(packetWidth, resX - x0);
+        for(int l = 0; l < packetWidth; l++) {
+          double const u = ((double)(x0 + l)) * pixelWidthWorld;
+
+          // set origin
+          packet.origin[0][l]
+            = camPosCorner[0] + u * camRight[0] + v * camUpTrue[0];
+          packet.origin[1][l]
+            = camPosCorner[1] + u * camRight[1] + v * camUpTrue[1];
+          packet.origin[2][l]
+            = camPosCorner[2] + u * camRight[2] + v * camUpTrue[2];
         }
-        pixelIndex++;
-        bcIndex += 2;
+
+        bvh.intersect(packet);
+        storePacket(packet, (size_t)y * resX + x0);
       }
     }
   } else {
@@ -176,44 +180,31 @@ int ttk::CinemaImagingNative::renderImage(
 #endif
     for(int y = 0; y < resY; y++) {
       double const v = (y - resY * 0.5) * factor;
-      size_t pixelIndex = y * resX;
-      size_t bcIndex = 2 * pixelIndex;
-
-      for(int x = 0; x < resX; x++) {
-        double const u = (x - resX * 0.5) * factor;
-
-        depthBuffer[pixelIndex] = nan;
-        primitiveIds[pixelIndex] = CinemaImaging::INVALID_ID;
-        barycentricCoordinates[bcIndex] = nan;
-        barycentricCoordinates[bcIndex + 1] = nan;
 
+      RayPacket<packetWidth> packet;
+      for(int l = 0; l < packetWidth; l++) {
         // set origin
-        float const org_x = camPos[0];
-        float const org_y = camPos[1];
-        float const org_z = camPos[2];
+        packet.origin[0][l] = camPos[0];
+        packet.origin[1][l] = camPos[1];
+        packet.origin[2][l] = camPos[2];
+      }
 
-        float ray_origin[3] = {org_x, org_y, org_z};
-        // set dir
-        float const dir_x = camDir[0] + u * camRight[0] + v * camUpTrue[0];
-        float const dir_y = camDir[1] + u * camRight[1] + v * camUpTrue[1];
-        float const dir_z = camDir[2] + u * camRight[2] + v * camUpTrue[2];
-
-        float ray_dir[3] = {dir_x, dir_y, dir_z};
-
-        Ray ray(ray_dir, ray_origin);
-        bool wasHit = false;
-        int triIdx;
-        float distance;
-        wasHit = bvh.intersect(
-          ray, connectivityList, vertexCoords, &triIdx, &distance);
-        if(wasHit) {
-          depthBuffer[pixelIndex] = distance;
-          primitiveIds[pixelIndex] = triIdx;
-          barycentricCoordinates[bcIndex] = ray.u;
-          barycentricCoordinates[bcIndex + 1] = ray.v;
+      for(int x0 = 0; x0 < resX; x0 += packetWidth) {
+        packet.nRays = std::min(packetWidth, resX - x0);
+        for(int l = 0; l < packetWidth; l++) {
+          double const u = (x0 + l - resX * 0.5) * factor;
+
+          // set dir
+          packet.direction[0][l]
+            = camDir[0] + u * camRight[0] + v * camUpTrue[0];
+          packet.direction[1][l]
+            = camDir[1] + u * camRight[1] + v * camUpTrue[1];
+          packet.direction[2][l]
+            = camDir[2] + u * camRight[2] + v * camUpTrue[2];
         }
-        pixelIndex++;
-        bcIndex += 2;
+
+        bvh.intersect(packet);
+        storePacket(packet, (size_t)y * resX + x0);
       }
     }
   }
@@ -2,100 +2,255 @@
 
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 
 namespace ttk {
   /**
-   * @brief LRU cache implementation
+   * @brief Thread-safe LRU cache implementation
+   *
+   * Values are handled through shared pointers: an evicted value
+   * remains valid as long as a caller holds a reference on it. Every
+   * entry has a cost (e.g. its memory footprint in bytes) and the cache
+   * capacity is bounded both by a number of entries and by a total
+   * cost (the memory budget). All methods can be called concurrently.
    *
    * Adapted from boost/compute/details/lru_cache.hpp
    */
   template <class KeyType, class ValueType>
   class LRUCache {
   public:
+    /**
+     * @brief Cache usage counters
+     */
+    struct Statistics {
+      std::size_t hits{};
+      std::size_t misses{};
+      std::size_t evictions{};
+      std::size_t size{};
+      std::size_t footprint{};
+    };
+
     // default cache with at most 8 entries
     LRUCache() : capacity_{8} {
     }
 
-    LRUCache(const std::size_t capacity) : capacity_(capacity) {
+    LRUCache(const std::size_t capacity, const std::size_t memoryBudget = 0)
+      : capacity_(capacity), memoryBudget_{memoryBudget} {
+    }
+
+    LRUCache(const LRUCache &other) {
+      *this = other;
+    }
+
+    LRUCache(LRUCache &&other) noexcept {
+      *this = std::move(other);
+    }
+
+    LRUCache &operator=(const LRUCache &other) {
+      if(this == &other) {
+        return *this;
+      }
+      std::lock(this->mutex_, other.mutex_);
+      std::lock_guard<std::mutex> lock0{this->mutex_, std::adopt_lock};
+      std::lock_guard<std::mutex> lock1{other.mutex_, std::adopt_lock};
+      // the list iterators stored in the map cannot be copied
+      this->map_.clear();
+      this->queue_.clear();
+      for(auto it = other.queue_.rbegin(); it != other.queue_.rend(); ++it) {
+        const auto &entry = other.map_.at(*it);
+        this->queue_.push_front(*it);
+        this->map_.emplace(
+          *it, Entry{entry.value, entry.cost, this->queue_.begin()});
+      }
+      this->capacity_ = other.capacity_;
+      this->memoryBudget_ = other.memoryBudget_;
+      this->footprint_ = other.footprint_;
+      this->stats_ = other.stats_;
+      return *this;
+    }
+
+    LRUCache &operator=(LRUCache &&other) noexcept {
+      if(this == &other) {
+        return *this;
+      }
+      std::lock(this->mutex_, other.mutex_);
+      std::lock_guard<std::mutex> lock0{this->mutex_, std::adopt_lock};
+      std::lock_guard<std::mutex> lock1{other.mutex_, std::adopt_lock};
+      // std::list iterators remain valid after a move
+      this->map_ = std::move(other.map_);
+      this->queue_ = std::move(other.queue_);
+      this->capacity_ = other.capacity_;
+      this->memoryBudget_ = other.memoryBudget_;
+      this->footprint_ = other.footprint_;
+      this->stats_ = other.stats_;
+      other.map_.clear();
+      other.queue_.clear();
+      other.footprint_ = 0;
+      return *this;
     }
 
     inline bool empty() const {
+      std::lock_guard<std::mutex> lock{this->mutex_};
       return this->map_.empty();
     }
 
     inline std::size_t capacity() const {
+      std::lock_guard<std::mutex> lock{this->mutex_};
       return this->capacity_;
     }
 
     inline std::size_t size() const {
+      std::lock_guard<std::mutex> lock{this->mutex_};
       return this->map_.size();
     }
 
+    /**
+     * @brief Maximum total cost of the entries (0: no limit)
+     */
+    inline std::size_t memoryBudget() const {
+      std::lock_guard<std::mutex> lock{this->mutex_};
+      return this->memoryBudget_;
+    }
+
+    /**
+     * @brief Total cost of the entries
+     */
+    inline std::size_t footprint() const {
+      std::lock_guard<std::mutex> lock{this->mutex_};
+      return this->footprint_;
+    }
+
     inline bool contains(const KeyType &key) const {
+      std::lock_guard<std::mutex> lock{this->mutex_};
       return this->map_.find(key) != this->map_.end();
     }
 
     inline void clear() {
+      std::lock_guard<std::mutex> lock{this->mutex_};
       this->map_.clear();
       this->queue_.clear();
+      this->footprint_ = 0;
+    }
+
+    /**
+     * @brief Set the maximum number of entries, evict if needed
+     */
+    inline void setCapacity(const std::size_t capacity) {
+      std::lock_guard<std::mutex> lock{this->mutex_};
+      this->capacity_ = capacity;
+      this->evict(0);
+    }
+
+    /**
+     * @brief Set the maximum total cost of the entries, evict if needed
+     *
+     * The most recently used entry is never evicted, even if its cost
+     * exceeds the budget. A zero budget disables this limit.
+     */
+    inline void setMemoryBudget(const std::size_t memoryBudget) {
+      std::lock_guard<std::mutex> lock{this->mutex_};
+      this->memoryBudget_ = memoryBudget;
+      this->evict(1);
+    }
+
+    inline Statistics getStatistics() const {
+      std::lock_guard<std::mutex> lock{this->mutex_};
+      auto res{this->stats_};
+      res.size = this->map_.size();
+      res.footprint = this->footprint_;
+      return res;
     }
 
     /**
      * @brief Insert new (key, value) entry
      *
-     * Do nothing if key already in use
+     * Do nothing if key already in use.
+     *
+     * @return The value stored in the cache for this key (either @p
+     * value or the one previously inserted by a concurrent caller)
      */
-    inline void insert(const KeyType &key, const ValueType &value) {
-      if(this->contains(key)) {
-        return; // key already in use
-      }
+    inline std::shared_ptr<ValueType>
+      insert(const KeyType &key,
+             const std::shared_ptr<ValueType> &value,
+             const std::size_t cost = 0) {
+      std::lock_guard<std::mutex> lock{this->mutex_};
 
-      if(this->size() >= this->capacity_) {
-        // cache is full, evict the least recently used entry
-        this->map_.erase(this->queue_.back());
-        this->queue_.pop_back();
+      const auto it = this->map_.find(key);
+      if(it != this->map_.end()) {
+        return it->second.value; // key already in use
       }
 
       // insert new entry
       this->queue_.push_front(key);
-      this->map_.emplace(key, std::make_pair(value, this->queue_.begin()));
+      this->map_.emplace(key, Entry{value, cost, this->queue_.begin()});
+      this->footprint_ += cost;
+
+      // evict the least recently used entries if the cache is full
+      this->evict(1);
+
+      return value;
     }
 
     /**
-     * @brief Get value pointer from key
+     * @brief Get value from key
      *
      * @return nullptr if cache miss
      */
-    inline ValueType *get(const KeyType &key) {
+    inline std::shared_ptr<ValueType> get(const KeyType &key) {
+      std::lock_guard<std::mutex> lock{this->mutex_};
+
       const auto i = this->map_.find(key);
       if(i == this->map_.end()) {
         // cache miss, nullptr
+        this->stats_.misses++;
         return {};
       }
+      this->stats_.hits++;
 
       // iterator to entry in LRU list
-      const auto oldIt = i->second.second;
+      const auto oldIt = i->second.it;
       if(oldIt != this->queue_.begin()) {
         // update entry, now first in the LRU list
-        this->queue_.erase(oldIt);
-        this->queue_.push_front(key);
-
-        // update queue position in map
-        this->map_[key].second = this->queue_.begin();
+        this->queue_.splice(this->queue_.begin(), this->queue_, oldIt);
       }
 
-      // return value address
-      return &i->second.first;
+      return i->second.value;
     }
 
   private:
+    // evict least recently used entries until the capacity and the
+    // memory budget are respected, keeping at least minSize entries
+    inline void evict(const std::size_t minSize) {
+      while(this->map_.size() > minSize
+            && (this->map_.size() > this->capacity_
+                || (this->memoryBudget_ > 0
+                    && this->footprint_ > this->memoryBudget_))) {
+        const auto it = this->map_.find(this->queue_.back());
+        this->footprint_ -= it->second.cost;
+        this->map_.erase(it);
+        this->queue_.pop_back();
+        this->stats_.evictions++;
+      }
+    }
+
     using ListType = std::list<KeyType>;
-    using MapType
-      = std::map<KeyType, std::pair<ValueType, typename ListType::iterator>>;
 
-    MapType map_;
-    ListType queue_;
-    std::size_t capacity_;
+    struct Entry {
+      std::shared_ptr<ValueType> value;
+      std::size_t cost;
+      typename ListType::iterator it;
+    };
+
+    using MapType = std::map<KeyType, Entry>;
+
+    MapType map_{};
+    ListType queue_{};
+    std::size_t capacity_{8};
+    std::size_t memoryBudget_{};
+    std::size_t footprint_{};
+    Statistics stats_{};
+    mutable std::mutex mutex_{};
   };
 
 } // namespace ttk
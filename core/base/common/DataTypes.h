@@ -75,6 +75,8 @@ namespace ttk {
 
   // default name for compact triangulation index
   const char compactTriangulationIndex[] = "ttkCompactTriangulationIndex";
+  // default name for the compact triangulation cluster file (field data)
+  const char compactTriangulationFile[] = "ttkCompactTriangulationFile";
 
   /// default value for critical index
   enum class CriticalType {
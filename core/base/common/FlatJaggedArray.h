@@ -15,7 +15,66 @@ namespace ttk {
     // offset for every sub-vector
     std::vector<SimplexId> offsets_;
 
+    // read-only views over the data & offsets buffers, either on the
+    // vectors above or on external memory (e.g. a memory-mapped file)
+    const SimplexId *dataPtr_{};
+    const SimplexId *offsetsPtr_{};
+    size_t dataSize_{};
+    size_t offsetsSize_{};
+    // true if the views point to external memory
+    bool external_{false};
+
+    inline void bindToVectors() {
+      this->dataPtr_ = this->data_.data();
+      this->offsetsPtr_ = this->offsets_.data();
+      this->dataSize_ = this->data_.size();
+      this->offsetsSize_ = this->offsets_.size();
+      this->external_ = false;
+    }
+
+    inline void copyViews(const FlatJaggedArray &other) {
+      if(other.external_) {
+        this->dataPtr_ = other.dataPtr_;
+        this->offsetsPtr_ = other.offsetsPtr_;
+        this->dataSize_ = other.dataSize_;
+        this->offsetsSize_ = other.offsetsSize_;
+        this->external_ = true;
+      } else {
+        this->bindToVectors();
+      }
+    }
+
   public:
+    FlatJaggedArray() = default;
+    ~FlatJaggedArray() = default;
+
+    FlatJaggedArray(const FlatJaggedArray &other)
+      : data_{other.data_}, offsets_{other.offsets_} {
+      this->copyViews(other);
+    }
+    FlatJaggedArray(FlatJaggedArray &&other) noexcept
+      : data_{std::move(other.data_)}, offsets_{std::move(other.offsets_)} {
+      this->copyViews(other);
+      other.clear();
+    }
+    FlatJaggedArray &operator=(const FlatJaggedArray &other) {
+      if(this != &other) {
+        this->data_ = other.data_;
+        this->offsets_ = other.offsets_;
+        this->copyViews(other);
+      }
+      return *this;
+    }
+    FlatJaggedArray &operator=(FlatJaggedArray &&other) noexcept {
+      if(this != &other) {
+        this->data_ = std::move(other.data_);
+        this->offsets_ = std::move(other.offsets_);
+        this->copyViews(other);
+        other.clear();
+      }
+      return *this;
+    }
+
     // ############## //
     // Initialization //
     // ############## //
@@ -27,6 +86,27 @@ namespace ttk {
                         std::vector<SimplexId> &&offsets) {
       this->data_ = std::move(data);
       this->offsets_ = std::move(offsets);
+      this->bindToVectors();
+    }
+
+    /**
+     * @brief Use external buffers without copying them
+     *
+     * The caller is responsible for keeping the buffers alive (and
+     * unmodified) as long as this object is used. @p offsets should
+     * hold @p nItems + 1 elements, the last one being the size of @p
+     * data.
+     */
+    inline void setExternalData(const SimplexId *const data,
+                                const SimplexId *const offsets,
+                                const size_t nItems) {
+      this->data_.clear();
+      this->offsets_.clear();
+      this->dataPtr_ = data;
+      this->offsetsPtr_ = offsets;
+      this->offsetsSize_ = nItems + 1;
+      this->dataSize_ = offsets[nItems];
+      this->external_ = true;
     }
 
     /**
@@ -35,6 +115,14 @@ namespace ttk {
     inline void clear() {
       this->data_.clear();
       this->offsets_.clear();
+      this->bindToVectors();
+    }
+
+    /**
+     * @brief If the buffers are owned by another object
+     */
+    inline bool isExternal() const {
+      return this->external_;
     }
 
     // ############################## //
@@ -46,11 +134,11 @@ namespace ttk {
      */
     inline SimplexId size(SimplexId id) const {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if(id < 0 || id > (SimplexId)offsets_.size() - 1) {
+      if(id < 0 || id > (SimplexId)offsetsSize_ - 1) {
         return -1;
       }
 #endif
-      return this->offsets_[id + 1] - this->offsets_[id];
+      return this->offsetsPtr_[id + 1] - this->offsetsPtr_[id];
     }
 
     /**
@@ -58,11 +146,11 @@ namespace ttk {
      */
     inline SimplexId offset(SimplexId id) const {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if(id < 0 || id > (SimplexId)offsets_.size()) {
+      if(id < 0 || id > (SimplexId)offsetsSize_) {
         return -1;
       }
 #endif
-      return this->offsets_[id];
+      return this->offsetsPtr_[id];
     }
 
     struct Slice {
@@ -113,7 +201,7 @@ namespace ttk {
 
     inline Slice operator[](const size_t id) const {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if(id >= this->offsets_.size()) {
+      if(id >= this->offsetsSize_) {
         return {0, nullptr};
       }
 #endif
@@ -125,14 +213,14 @@ namespace ttk {
      */
     inline SimplexId get(SimplexId id, SimplexId local) const {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if(id < 0 || id > (SimplexId)offsets_.size() - 1) {
+      if(id < 0 || id > (SimplexId)offsetsSize_ - 1) {
         return -1;
       }
       if(local < 0 || local >= this->size(id)) {
         return -2;
       }
 #endif
-      return this->data_[this->offsets_[id] + local];
+      return this->dataPtr_[this->offsetsPtr_[id] + local];
     }
 
     /**
@@ -140,21 +228,28 @@ namespace ttk {
      */
     inline const SimplexId *get_ptr(SimplexId id, SimplexId local) const {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if(id < 0 || id > (SimplexId)offsets_.size() - 1) {
+      if(id < 0 || id > (SimplexId)offsetsSize_ - 1) {
         return {};
       }
       if(local < 0 || local >= this->size(id)) {
         return {};
       }
 #endif
-      return &this->data_[this->offsets_[id] + local];
+      return &this->dataPtr_[this->offsetsPtr_[id] + local];
     }
 
     /**
      * @brief Returns a const pointer to the offset member
      */
     inline const SimplexId *offset_ptr() const {
-      return offsets_.data();
+      return this->offsetsPtr_;
+    }
+
+    /**
+     * @brief Returns a const pointer to the flattened data
+     */
+    inline const SimplexId *data_ptr() const {
+      return this->dataPtr_;
     }
 
     /**
@@ -164,25 +259,27 @@ namespace ttk {
       if(this->empty()) {
         return 0;
       }
-      return this->offsets_.size() - 1;
+      return this->offsetsSize_ - 1;
     }
 
     /**
      * @brief Returns the size of the data_ member
      */
     inline size_t dataSize() const {
-      return this->data_.size();
+      return this->dataSize_;
     }
 
     /**
      * @brief If the underlying buffers are empty
      */
     inline bool empty() const {
-      return this->data_.empty() || this->offsets_.empty();
+      return this->dataSize_ == 0 || this->offsetsSize_ == 0;
     }
 
     /**
      * @brief Computes the memory footprint of the array
+     *
+     * External buffers are not accounted for.
      */
     inline size_t footprint() const {
       return (this->data_.size() + this->offsets_.size()) * sizeof(SimplexId);
@@ -204,6 +301,7 @@ namespace ttk {
         this->offsets_[i + 1] = this->offsets_[i] + src[i].size();
       }
       this->data_.resize(this->offsets_.back());
+      this->bindToVectors();
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber)
 #endif // TTK_ENABLE_OPENMP
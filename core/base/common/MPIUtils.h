@@ -14,8 +14,12 @@
 #include <algorithm>
 #include <array>
 #include <limits>
+#include <memory>
+#include <typeindex>
+#include <typeinfo>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #ifdef TTK_ENABLE_MPI
@@ -473,8 +477,494 @@ namespace ttk {
   }
 
   /**
-   * @brief exchange all ghost cell information by calling getGhostCellScalars
-   * for every rank
+   * @brief Communication plan of a ghost exchange
+   *
+   * For each neighbor rank, the plan stores the local ids of the
+   * simplices whose values are sent to this neighbor and the local ids of
+   * the ghost simplices whose values are received from it. It is computed
+   * once and can be reused by every exchange on the same simplices.
+   */
+  struct GhostExchangePlan {
+    std::vector<int> neighbors{};
+    std::vector<std::vector<SimplexId>> sendIds{};
+    std::vector<std::vector<SimplexId>> recvIds{};
+  };
+
+  /**
+   * @brief Fill a ghost exchange plan from the ghost simplices per owner
+   * and the remote ghost simplices (global ids indexed by rank) of a
+   * triangulation
+   */
+  template <typename GLID>
+  void buildGhostExchangePlan(
+    GhostExchangePlan &plan,
+    const std::vector<int> &neighbors,
+    const std::vector<std::vector<SimplexId>> &ghostsPerOwner,
+    const std::vector<std::vector<SimplexId>> &remoteGhosts,
+    const GLID &getLocalId) {
+    const size_t neighborNumber = neighbors.size();
+    plan.neighbors = neighbors;
+    plan.sendIds.resize(neighborNumber);
+    plan.recvIds.resize(neighborNumber);
+    for(size_t r = 0; r < neighborNumber; r++) {
+      const auto &recvGids = ghostsPerOwner[neighbors[r]];
+      const auto &sendGids = remoteGhosts[neighbors[r]];
+      plan.recvIds[r].resize(recvGids.size());
+      for(size_t i = 0; i < recvGids.size(); i++) {
+        plan.recvIds[r][i] = getLocalId(recvGids[i]);
+      }
+      plan.sendIds[r].resize(sendGids.size());
+      for(size_t i = 0; i < sendGids.size(); i++) {
+        plan.sendIds[r][i] = getLocalId(sendGids[i]);
+      }
+    }
+  }
+
+  /**
+   * @brief Compute the plan of the ghost cell exchanges of a triangulation
+   *
+   * @param[out] plan the ghost exchange plan
+   * @param[in] triangulation the triangulation for the data
+   * @return 0 in case of success
+   */
+  template <typename triangulationType>
+  int buildGhostCellsExchangePlan(GhostExchangePlan &plan,
+                                  const triangulationType *triangulation) {
+    if(!triangulation->hasPreconditionedDistributedCells()) {
+      return -1;
+    }
+    buildGhostExchangePlan(
+      plan, triangulation->getNeighborRanks(),
+      triangulation->getGhostCellsPerOwner(),
+      triangulation->getRemoteGhostCells(),
+      [triangulation](const SimplexId gid) {
+        return triangulation->getCellLocalId(gid);
+      });
+    return 0;
+  }
+
+  /**
+   * @brief Compute the plan of the ghost vertex exchanges of a
+   * triangulation
+   *
+   * @param[out] plan the ghost exchange plan
+   * @param[in] triangulation the triangulation for the data
+   * @return 0 in case of success
+   */
+  template <typename triangulationType>
+  int buildGhostVerticesExchangePlan(GhostExchangePlan &plan,
+                                     const triangulationType *triangulation) {
+    if(!triangulation->hasPreconditionedDistributedVertices()) {
+      return -1;
+    }
+    buildGhostExchangePlan(
+      plan, triangulation->getNeighborRanks(),
+      triangulation->getGhostVerticesPerOwner(),
+      triangulation->getRemoteGhostVertices(),
+      [triangulation](const SimplexId gid) {
+        return triangulation->getVertexLocalId(gid);
+      });
+    return 0;
+  }
+
+  /**
+   * @brief Compute the plan of a ghost exchange without a triangulation
+   *
+   * Every rank sends the global ids of its ghost simplices to their
+   * owners, which translate them into local ids. The messages are
+   * non-blocking and all the neighbors are served at the same time.
+   *
+   * @param[out] plan the ghost exchange plan
+   * @param[in] getVertexRank lambda to get rank from vertex
+   * @param[in] getVertexGlobalId lambda to get global id from local id
+   * @param[in] getVertexLocalId lambda to get local id from global id
+   * @param[in] neighbors the rank neighbors of this rank
+   * @param[in] nVerts number of vertices in the arrays
+   * @param[in] communicator the communicator over which the ranks are connected
+   * (most likely ttk::MPIcomm_)
+   * @return 0 in case of success
+   */
+  template <typename IT, typename GVGID, typename GVR, typename GVLID>
+  int buildGhostExchangePlanWithoutTriangulation(
+    GhostExchangePlan &plan,
+    const GVR &getVertexRank,
+    const GVGID &getVertexGlobalId,
+    const GVLID &getVertexLocalId,
+    const std::vector<int> &neighbors,
+    const IT nVerts,
+    MPI_Comm communicator) {
+    if(!ttk::isRunningWithMPI()) {
+      return -1;
+    }
+    using globalIdType = decltype(getVertexGlobalId(0));
+    MPI_Datatype MPI_GIT = getMPIType(static_cast<globalIdType>(0));
+    MPI_Datatype MPI_SI = getMPIType(static_cast<SimplexId>(0));
+    const int amountTag = 104;
+    const int idsTag = 105;
+    const int neighborNumber = neighbors.size();
+
+    std::vector<int> neighborIndex(ttk::MPIsize_, -1);
+    for(int r = 0; r < neighborNumber; r++) {
+      neighborIndex[neighbors[r]] = r;
+    }
+    plan.neighbors = neighbors;
+    plan.recvIds.assign(neighborNumber, {});
+    plan.sendIds.assign(neighborNumber, {});
+
+    // ghost simplices, grouped by owner
+    std::vector<std::vector<globalIdType>> requestedGids(neighborNumber);
+    for(IT i = 0; i < nVerts; i++) {
+      const int rank = getVertexRank(i);
+      if(rank != ttk::MPIrank_ && neighborIndex[rank] != -1) {
+        plan.recvIds[neighborIndex[rank]].emplace_back(i);
+        requestedGids[neighborIndex[rank]].emplace_back(getVertexGlobalId(i));
+      }
+    }
+
+    // exchange the amounts of requested ids
+    std::vector<SimplexId> nRequested(neighborNumber), nToSend(neighborNumber);
+    std::vector<MPI_Request> requests{};
+    requests.reserve(2 * neighborNumber);
+    for(int r = 0; r < neighborNumber; r++) {
+      nRequested[r] = requestedGids[r].size();
+      requests.emplace_back();
+      MPI_Irecv(&nToSend[r], 1, MPI_SI, neighbors[r], amountTag, communicator,
+                &requests.back());
+      requests.emplace_back();
+      MPI_Isend(&nRequested[r], 1, MPI_SI, neighbors[r], amountTag,
+                communicator, &requests.back());
+    }
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+    // exchange the requested ids themselves
+    std::vector<std::vector<globalIdType>> sendGids(neighborNumber);
+    requests.clear();
+    for(int r = 0; r < neighborNumber; r++) {
+      if(nToSend[r] > 0) {
+        sendGids[r].resize(nToSend[r]);
+        requests.emplace_back();
+        MPI_Irecv(sendGids[r].data(), nToSend[r], MPI_GIT, neighbors[r],
+                  idsTag, communicator, &requests.back());
+      }
+      if(nRequested[r] > 0) {
+        requests.emplace_back();
+        MPI_Isend(requestedGids[r].data(), nRequested[r], MPI_GIT,
+                  neighbors[r], idsTag, communicator, &requests.back());
+      }
+    }
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+    for(int r = 0; r < neighborNumber; r++) {
+      plan.sendIds[r].resize(sendGids[r].size());
+      for(size_t i = 0; i < sendGids[r].size(); i++) {
+        plan.sendIds[r][i] = getVertexLocalId(sendGids[r][i]);
+      }
+    }
+
+    return 0;
+  }
+
+  /**
+   * @brief Non-blocking ghost exchange following a GhostExchangePlan
+   *
+   * The MPI requests are persistent: they are created by init() and
+   * restarted by every exchange. start() packs the values sent to each
+   * neighbor and returns as soon as the communication is posted, so that
+   * the caller can process the interior of its block before wait() copies
+   * the received values to the ghost simplices. The send and receive
+   * arrays may differ, for instance when the sent values are the next
+   * iterate of a computation.
+   *
+   * Exchanges using the same tag on the same communicator have to be
+   * started in the same order on every rank.
+   */
+  template <typename DT>
+  class GhostExchange {
+  public:
+    GhostExchange() = default;
+    GhostExchange(const GhostExchange &) = delete;
+    GhostExchange &operator=(const GhostExchange &) = delete;
+
+    ~GhostExchange() {
+      this->freeRequests();
+    }
+
+    /**
+     * @brief Allocate the buffers and create the persistent requests
+     *
+     * @param[in] plan the ghost exchange plan
+     * @param[in] communicator the communicator over which the ranks are
+     * connected (most likely ttk::MPIcomm_)
+     * @param[in] dimensionNumber number of components of the values
+     * @param[in] tag the tag of the exchanged messages
+     * @return 0 in case of success
+     */
+    int init(GhostExchangePlan plan,
+             MPI_Comm communicator,
+             const int dimensionNumber = 1,
+             const int tag = 106) {
+      this->freeRequests();
+      this->plan_ = std::move(plan);
+      this->dimensionNumber_ = dimensionNumber;
+
+      const size_t neighborNumber = this->plan_.neighbors.size();
+      size_t nSend{}, nRecv{};
+      for(size_t r = 0; r < neighborNumber; r++) {
+        nSend += this->plan_.sendIds[r].size();
+        nRecv += this->plan_.recvIds[r].size();
+      }
+      this->sendBuffer_.resize(nSend * dimensionNumber);
+      this->recvBuffer_.resize(nRecv * dimensionNumber);
+
+      MPI_Datatype MPI_DT = getMPIType(static_cast<DT>(0));
+      DT *sendPtr = this->sendBuffer_.data();
+      DT *recvPtr = this->recvBuffer_.data();
+      for(size_t r = 0; r < neighborNumber; r++) {
+        const int nRecvValues = this->plan_.recvIds[r].size() * dimensionNumber;
+        const int nSendValues = this->plan_.sendIds[r].size() * dimensionNumber;
+        if(nRecvValues > 0) {
+          this->requests_.emplace_back();
+          MPI_Recv_init(recvPtr, nRecvValues, MPI_DT, this->plan_.neighbors[r],
+                        tag, communicator, &this->requests_.back());
+          recvPtr += nRecvValues;
+        }
+        if(nSendValues > 0) {
+          this->requests_.emplace_back();
+          MPI_Send_init(sendPtr, nSendValues, MPI_DT, this->plan_.neighbors[r],
+                        tag, communicator, &this->requests_.back());
+          sendPtr += nSendValues;
+        }
+      }
+      return 0;
+    }
+
+    /**
+     * @brief Pack the values sent to the neighbors and start the exchange
+     *
+     * @param[in] scalarArray the array of the sent values
+     * @return 0 in case of success
+     */
+    int start(const DT *scalarArray) {
+      if(this->started_) {
+        return -1;
+      }
+      const int dim = this->dimensionNumber_;
+      size_t pos{};
+      for(const auto &ids : this->plan_.sendIds) {
+        for(const auto id : ids) {
+          for(int j = 0; j < dim; j++) {
+            this->sendBuffer_[pos++] = scalarArray[id * dim + j];
+          }
+        }
+      }
+      if(!this->requests_.empty()) {
+        MPI_Startall(this->requests_.size(), this->requests_.data());
+      }
+      this->started_ = true;
+      return 0;
+    }
+
+    /**
+     * @brief Complete the exchange and fill the ghost values
+     *
+     * @param[out] scalarArray the array of the received ghost values
+     * @return 0 in case of success
+     */
+    int wait(DT *scalarArray) {
+      if(!this->started_) {
+        return -1;
+      }
+      if(!this->requests_.empty()) {
+        MPI_Waitall(
+          this->requests_.size(), this->requests_.data(), MPI_STATUSES_IGNORE);
+      }
+      const int dim = this->dimensionNumber_;
+      size_t pos{};
+      for(const auto &ids : this->plan_.recvIds) {
+        for(const auto id : ids) {
+          for(int j = 0; j < dim; j++) {
+            scalarArray[id * dim + j] = this->recvBuffer_[pos++];
+          }
+        }
+      }
+      this->started_ = false;
+      return 0;
+    }
+
+    inline const GhostExchangePlan &getPlan() const {
+      return this->plan_;
+    }
+
+  private:
+    void freeRequests() {
+      int finalized{};
+      MPI_Finalized(&finalized);
+      if(!finalized) {
+        if(this->started_) {
+          MPI_Waitall(this->requests_.size(), this->requests_.data(),
+                      MPI_STATUSES_IGNORE);
+        }
+        for(auto &request : this->requests_) {
+          MPI_Request_free(&request);
+        }
+      }
+      this->requests_.clear();
+      this->started_ = false;
+    }
+
+    GhostExchangePlan plan_{};
+    int dimensionNumber_{1};
+    bool started_{false};
+    std::vector<DT> sendBuffer_{};
+    std::vector<DT> recvBuffer_{};
+    std::vector<MPI_Request> requests_{};
+  };
+
+  /**
+   * @brief Ghost exchanges of a triangulation, reused across calls
+   *
+   * The plans of the ghost cell and ghost vertex exchanges are computed on
+   * the first request, as well as one GhostExchange (buffers and persistent
+   * requests) per value type, number of components and communicator. Every
+   * triangulation holds such a cache (see
+   * AbstractTriangulation::getGhostExchangeCache()). Like the other MPI
+   * calls, it should only be used by the master thread.
+   */
+  class GhostExchangeCache {
+  public:
+    GhostExchangeCache() = default;
+    // a copied triangulation builds its own exchanges
+    GhostExchangeCache(const GhostExchangeCache &) {
+    }
+    GhostExchangeCache &operator=(const GhostExchangeCache &other) {
+      if(this != &other) {
+        this->clear();
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Get the exchange of the ghost cells or vertices of a
+     * triangulation, created on the first call
+     *
+     * @return nullptr if the triangulation is not preconditioned for the
+     * distributed simplices
+     */
+    template <typename DT, typename triangulationType>
+    GhostExchange<DT> *get(const triangulationType *triangulation,
+                           const bool cells,
+                           MPI_Comm communicator,
+                           const int dimensionNumber) {
+      for(const auto &entry : this->entries_) {
+        if(entry.type == std::type_index{typeid(DT)} && entry.cells == cells
+           && entry.dimensionNumber == dimensionNumber
+           && entry.communicator == communicator) {
+          return static_cast<GhostExchange<DT> *>(entry.exchange.get());
+        }
+      }
+
+      auto &plan = cells ? this->cellsPlan_ : this->verticesPlan_;
+      auto &hasPlan = cells ? this->hasCellsPlan_ : this->hasVerticesPlan_;
+      if(!hasPlan) {
+        const int status
+          = cells ? buildGhostCellsExchangePlan(plan, triangulation)
+                  : buildGhostVerticesExchangePlan(plan, triangulation);
+        if(status != 0) {
+          return nullptr;
+        }
+        hasPlan = true;
+      }
+
+      const auto exchange = std::make_shared<GhostExchange<DT>>();
+      exchange->init(plan, communicator, dimensionNumber);
+      this->entries_.emplace_back(Entry{std::type_index{typeid(DT)}, cells,
+                                        dimensionNumber, communicator,
+                                        exchange});
+      return exchange.get();
+    }
+
+    inline void clear() {
+      this->entries_.clear();
+      this->cellsPlan_ = {};
+      this->verticesPlan_ = {};
+      this->hasCellsPlan_ = false;
+      this->hasVerticesPlan_ = false;
+    }
+
+  private:
+    struct Entry {
+      std::type_index type;
+      bool cells;
+      int dimensionNumber;
+      MPI_Comm communicator;
+      std::shared_ptr<void> exchange;
+    };
+
+    GhostExchangePlan cellsPlan_{}, verticesPlan_{};
+    bool hasCellsPlan_{false}, hasVerticesPlan_{false};
+    std::vector<Entry> entries_{};
+  };
+
+  /**
+   * @brief Get the persistent exchange of the ghost cells of a
+   * triangulation
+   *
+   * The exchange is created on the first call and then reused: the caller
+   * can overlap its computations with the communications between start()
+   * and wait(). It should not be started again before wait() returns.
+   *
+   * @param[in] triangulation the triangulation for the data
+   * @param[in] communicator the communicator over which the ranks are connected
+   * (most likely ttk::MPIcomm_)
+   * @param[in] dimensionNumber number of components of the values
+   * @return the exchange, nullptr if the ghost cells are not preconditioned
+   */
+  template <typename DT, typename triangulationType>
+  GhostExchange<DT> *
+    getGhostCellsExchange(const triangulationType *triangulation,
+                          MPI_Comm communicator,
+                          const int dimensionNumber = 1) {
+    return triangulation->getGhostExchangeCache().template get<DT>(
+      triangulation, true, communicator, dimensionNumber);
+  }
+
+  /**
+   * @brief Get the persistent exchange of the ghost vertices of a
+   * triangulation (see getGhostCellsExchange())
+   */
+  template <typename DT, typename triangulationType>
+  GhostExchange<DT> *
+    getGhostVerticesExchange(const triangulationType *triangulation,
+                             MPI_Comm communicator,
+                             const int dimensionNumber = 1) {
+    return triangulation->getGhostExchangeCache().template get<DT>(
+      triangulation, false, communicator, dimensionNumber);
+  }
+
+  /**
+   * @brief Blocking exchange with a cached GhostExchange, or with a
+   * temporary one if the cached exchange is already started
+   */
+  template <typename DT>
+  int exchangeGhosts(DT *scalarArray,
+                     GhostExchange<DT> *exchange,
+                     MPI_Comm communicator,
+                     const int dimensionNumber) {
+    if(exchange == nullptr) {
+      return -1;
+    }
+    if(exchange->start(scalarArray) != 0) {
+      GhostExchange<DT> tmpExchange{};
+      tmpExchange.init(exchange->getPlan(), communicator, dimensionNumber);
+      tmpExchange.start(scalarArray);
+      return tmpExchange.wait(scalarArray);
+    }
+    return exchange->wait(scalarArray);
+  }
+
+  /**
+   * @brief exchange all ghost cell information with the persistent
+   * GhostExchange of the triangulation
    *
    * @param[out] scalarArray the scalar array which we want to fill and which is
    * filled on the other ranks
@@ -491,15 +981,10 @@ namespace ttk {
     if(!ttk::isRunningWithMPI()) {
       return -1;
     }
-    if(!triangulation->hasPreconditionedDistributedCells()) {
-      return -1;
-    }
-    for(int r = 0; r < ttk::MPIsize_; r++) {
-      getGhostCellScalars<DT, triangulationType>(
-        scalarArray, triangulation, r, communicator, dimensionNumber);
-      MPI_Barrier(communicator);
-    }
-    return 0;
+    return exchangeGhosts(
+      scalarArray,
+      getGhostCellsExchange<DT>(triangulation, communicator, dimensionNumber),
+      communicator, dimensionNumber);
   }
 
   template <typename DT, typename triangulationType>
@@ -510,38 +995,89 @@ namespace ttk {
     if(!ttk::isRunningWithMPI()) {
       return -1;
     }
-    if(!triangulation->hasPreconditionedDistributedVertices()) {
-      return -1;
+    return exchangeGhosts(scalarArray,
+                          getGhostVerticesExchange<DT>(
+                            triangulation, communicator, dimensionNumber),
+                          communicator, dimensionNumber);
+  }
+
+  /**
+   * @brief Check that an order field is a global order of the distributed
+   * vertices (as computed by ttk::ArrayPreconditioning)
+   *
+   * The orders of the owned vertices should range from 0 to the global
+   * number of vertices minus one, and every ghost vertex should have the
+   * order of its owner. A rank-local order fails these tests. This is a
+   * collective operation: every rank gets the same answer.
+   *
+   * @param[in] offsets the order field
+   * @param[in] triangulation the distributed triangulation
+   * @param[in] communicator the communicator over which the ranks are connected
+   * (most likely ttk::MPIcomm_)
+   * @return true if the order is global
+   */
+  template <typename triangulationType>
+  bool isGlobalOrder(const SimplexId *const offsets,
+                     const triangulationType *triangulation,
+                     MPI_Comm communicator) {
+    const SimplexId nVerts = triangulation->getNumberOfVertices();
+
+    // ghost vertices hold the order of their owner: the exchange overlaps
+    // with the scan of the owned vertices
+    std::vector<SimplexId> ghostOffsets(offsets, offsets + nVerts);
+    auto exchange
+      = getGhostVerticesExchange<SimplexId>(triangulation, communicator);
+    const bool started{exchange != nullptr && exchange->start(offsets) == 0};
+
+    // number of owned vertices, number of inconsistent ghosts, -(min order)
+    // and max order of the owned vertices
+    std::array<SimplexId, 4> local{
+      0, 0, std::numeric_limits<SimplexId>::lowest(), -1};
+    for(SimplexId i = 0; i < nVerts; i++) {
+      if(triangulation->getVertexRank(i) == ttk::MPIrank_) {
+        local[0]++;
+        local[2] = std::max(local[2], -offsets[i]);
+        local[3] = std::max(local[3], offsets[i]);
+      }
     }
-    for(int r = 0; r < ttk::MPIsize_; r++) {
-      getGhostVertexScalars<DT, triangulationType>(
-        scalarArray, triangulation, r, communicator, dimensionNumber);
-      MPI_Barrier(communicator);
+    if(started) {
+      exchange->wait(ghostOffsets.data());
+    } else if(exchangeGhosts(ghostOffsets.data(), exchange, communicator, 1)
+              != 0) {
+      local[1]++;
     }
-    return 0;
+    for(SimplexId i = 0; i < nVerts; i++) {
+      if(ghostOffsets[i] != offsets[i]) {
+        local[1]++;
+      }
+    }
+    std::array<SimplexId, 4> global{};
+    MPI_Datatype MPI_SI = getMPIType(static_cast<SimplexId>(0));
+    MPI_Allreduce(
+      local.data(), global.data(), 2, MPI_SI, MPI_SUM, communicator);
+    MPI_Allreduce(&local[2], &global[2], 2, MPI_SI, MPI_MAX, communicator);
+
+    return global[1] == 0 && global[2] == 0 && global[3] == global[0] - 1;
   }
 
   /**
-     * @brief exchange all ghost cell information by calling getGhostCellScalars
-     * for every rank
-     * this method is for usage without a triangulation, if a triangulation is
-     available,
-     * use exchangeGhostCells(), it is more performant when used multiple
-     times
-
-     * @param[out] scalarArray the scalar array which we want to fill and which
-     is
-     * filled on the other ranks
-     * @param[in] getVertexRank lambda to get rank from vertex
-     * @param[in] globalIds the global id array for the scalar data
-     * @param[in] gidToLidMap a map which translates global ids to local,
-     * rank-based ids
-     * @param[in] nVerts number of vertices in the arrays
-     * @param[in] communicator the communicator over which the ranks are
-     connected
-     * (most likely ttk::MPIcomm_)
-     * @return 0 in case of success
-     */
+   * @brief exchange all ghost information with a non-blocking
+   * GhostExchange
+   * this method is for usage without a triangulation, if a triangulation is
+   * available, use exchangeGhostCells(), it is more performant when used
+   * multiple times
+   *
+   * @param[out] scalarArray the scalar array which we want to fill and which is
+   * filled on the other ranks
+   * @param[in] getVertexRank lambda to get rank from vertex
+   * @param[in] getVertexGlobalId lambda to get global id from local id
+   * @param[in] getVertexLocalId lambda to get local id from global id
+   * @param[in] nVerts number of vertices in the arrays
+   * @param[in] communicator the communicator over which the ranks are connected
+   * (most likely ttk::MPIcomm_)
+   * @param[in] neighbors the rank neighbors of this rank
+   * @return 0 in case of success
+   */
   template <typename DT,
             typename IT,
             typename GVGID,
@@ -558,13 +1094,14 @@ namespace ttk {
     if(!ttk::isRunningWithMPI()) {
       return -1;
     }
-    for(int r = 0; r < ttk::MPIsize_; r++) {
-      getGhostDataScalarsWithoutTriangulation(
-        scalarArray, getVertexRank, getVertexGlobalId, getVertexLocalId,
-        neighbors, r, nVerts, communicator, dimensionNumber);
-      MPI_Barrier(communicator);
-    }
-    return 0;
+    GhostExchangePlan plan{};
+    buildGhostExchangePlanWithoutTriangulation(
+      plan, getVertexRank, getVertexGlobalId, getVertexLocalId, neighbors,
+      nVerts, communicator);
+    GhostExchange<DT> exchange{};
+    exchange.init(std::move(plan), communicator, dimensionNumber);
+    exchange.start(scalarArray);
+    return exchange.wait(scalarArray);
   }
 
   // returns true if bounding boxes intersect, false if not
@@ -1073,6 +1610,97 @@ namespace ttk {
              neighbor, ttk::MPIcomm_, MPI_STATUS_IGNORE);
   }
 
+  /**
+   * @brief Gather the content of a vector from every rank on the root rank.
+   *
+   * The vectors are concatenated by increasing rank. Their sizes may
+   * differ between the ranks.
+   *
+   * @tparam dataType data type of the vector
+   * @param sendBuffer vector to send
+   * @param recvBuffer concatenated vectors (only filled on @p root)
+   * @param root rank of the process gathering the vectors
+   */
+
+  template <typename dataType>
+  void gatherVector(const std::vector<dataType> &sendBuffer,
+                    std::vector<dataType> &recvBuffer,
+                    const int root = 0) {
+    const int sendSize = sendBuffer.size();
+    std::vector<int> recvSizes{}, displacements{};
+    if(ttk::MPIrank_ == root) {
+      recvSizes.resize(ttk::MPIsize_);
+      displacements.resize(ttk::MPIsize_);
+    }
+    MPI_Gather(&sendSize, 1, getMPIType(sendSize), recvSizes.data(), 1,
+               getMPIType(sendSize), root, ttk::MPIcomm_);
+    if(ttk::MPIrank_ == root) {
+      for(int i = 1; i < ttk::MPIsize_; ++i) {
+        displacements[i] = displacements[i - 1] + recvSizes[i - 1];
+      }
+      recvBuffer.resize(displacements.back() + recvSizes.back());
+    }
+    const auto messageType{getMPIType(dataType{})};
+    MPI_Gatherv(sendBuffer.data(), sendSize, messageType, recvBuffer.data(),
+                recvSizes.data(), displacements.data(), messageType, root,
+                ttk::MPIcomm_);
+  }
+
+  /**
+   * @brief Scatter the content of a vector from the root rank, inverse
+   * of @ref gatherVector.
+   *
+   * Every rank receives a contiguous part of the vector, by increasing
+   * rank. The size of this part is given by the size of @p recvBuffer,
+   * which should be set on every rank before the call.
+   *
+   * @tparam dataType data type of the vector
+   * @param sendBuffer vector to scatter (only read on @p root)
+   * @param recvBuffer part of the vector received by the current rank
+   * @param root rank of the process scattering the vector
+   */
+
+  template <typename dataType>
+  void scatterVector(const std::vector<dataType> &sendBuffer,
+                     std::vector<dataType> &recvBuffer,
+                     const int root = 0) {
+    const int recvSize = recvBuffer.size();
+    std::vector<int> sendSizes{}, displacements{};
+    if(ttk::MPIrank_ == root) {
+      sendSizes.resize(ttk::MPIsize_);
+      displacements.resize(ttk::MPIsize_);
+    }
+    MPI_Gather(&recvSize, 1, getMPIType(recvSize), sendSizes.data(), 1,
+               getMPIType(recvSize), root, ttk::MPIcomm_);
+    if(ttk::MPIrank_ == root) {
+      for(int i = 1; i < ttk::MPIsize_; ++i) {
+        displacements[i] = displacements[i - 1] + sendSizes[i - 1];
+      }
+    }
+    const auto messageType{getMPIType(dataType{})};
+    MPI_Scatterv(sendBuffer.data(), sendSizes.data(), displacements.data(),
+                 messageType, recvBuffer.data(), recvSize, messageType, root,
+                 ttk::MPIcomm_);
+  }
+
+  /**
+   * @brief Broadcast the content of a vector from the root rank.
+   *
+   * @tparam dataType data type of the vector
+   * @param buffer vector to send (on @p root) or to receive (on the
+   * other ranks, resized)
+   * @param root rank of the process broadcasting the vector
+   */
+
+  template <typename dataType>
+  void broadcastVector(std::vector<dataType> &buffer, const int root = 0) {
+    ttk::SimplexId dataSize = buffer.size();
+    MPI_Bcast(&dataSize, 1, getMPIType(dataSize), root, ttk::MPIcomm_);
+    buffer.resize(dataSize);
+    MPI_Bcast(buffer.data(), dataSize, getMPIType(dataType{}), root,
+              ttk::MPIcomm_);
+  }
+
 } // namespace ttk
 
 #endif // TTK_ENABLE_MPI
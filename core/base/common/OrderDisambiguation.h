@@ -1,15 +1,101 @@
 #pragma once
 
 #include <BaseClass.h>
+#include <RadixSort.h>
 
 #include <algorithm>
+#include <type_traits>
 #include <vector>
 
 namespace ttk {
 
+  /**
+   * @brief Comparison-based sort of vertices according to scalars
+   * disambiguated by offsets (scalar types without radix key)
+   */
+  template <typename scalarType, typename idType>
+  void sortVertices(const scalarType *const scalars,
+                    const idType *const offsets,
+                    std::vector<SimplexId> &sortedVertices,
+                    const int nThreads,
+                    std::false_type /* radix sortable */) {
+
+    TTK_FORCE_USE(nThreads);
+
+    if(offsets != nullptr) {
+      TTK_PSORT(
+        nThreads, sortedVertices.begin(), sortedVertices.end(),
+        [&](const SimplexId a, const SimplexId b) {
+          return (scalars[a] < scalars[b])
+                 || (scalars[a] == scalars[b] && offsets[a] < offsets[b]);
+        });
+    } else {
+      TTK_PSORT(nThreads, sortedVertices.begin(), sortedVertices.end(),
+                [&](const SimplexId a, const SimplexId b) {
+                  return (scalars[a] < scalars[b])
+                         || (scalars[a] == scalars[b] && a < b);
+                });
+    }
+  }
+
+  /**
+   * @brief Radix sort of vertices according to scalars disambiguated by
+   * offsets
+   *
+   * The radix sort being stable, the vertices are first sorted by
+   * offsets then by scalars. Scalars and offsets are mapped to
+   * order-preserving unsigned integers so that no indirect access is
+   * needed during the sort passes.
+   */
+  template <typename scalarType, typename idType>
+  void sortVertices(const scalarType *const scalars,
+                    const idType *const offsets,
+                    std::vector<SimplexId> &sortedVertices,
+                    const int nThreads,
+                    std::true_type /* radix sortable */) {
+
+    const size_t nVerts = sortedVertices.size();
+
+    // increasing offsets disambiguate plateaux as vertex ids do
+    bool isIdOrder{offsets == nullptr};
+    if(offsets != nullptr) {
+      isIdOrder = true;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads) reduction(&& : isIdOrder)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 1; i < nVerts; ++i) {
+        isIdOrder = isIdOrder && offsets[i - 1] < offsets[i];
+      }
+    }
+
+    if(!isIdOrder) {
+      std::vector<radix::KeyType<idType>> keys(nVerts);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 0; i < nVerts; ++i) {
+        keys[i] = radix::toKey(offsets[i]);
+      }
+      radixSort(keys, sortedVertices, nThreads);
+    }
+
+    // otherwise, ties are ordered by vertex id (stable sort)
+    std::vector<radix::KeyType<scalarType>> keys(nVerts);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < nVerts; ++i) {
+      keys[i] = radix::toKey(scalars[sortedVertices[i]]);
+    }
+    radixSort(keys, sortedVertices, nThreads);
+  }
+
   /**
    * @brief Sort vertices according to scalars disambiguated by offsets
    *
+   * Integer and single or double precision scalars are sorted with a
+   * parallel radix sort, other types with a comparison sort.
+   *
    * @param[in] nVerts number of vertices
    * @param[in] scalars array of size nVerts, main vertex comparator
    * @param[in] offsets array of size nVerts, disambiguate scalars on plateaux
@@ -35,20 +121,10 @@ namespace ttk {
       sortedVertices[i] = i;
     }
 
-    if(offsets != nullptr) {
-      TTK_PSORT(
-        nThreads, sortedVertices.begin(), sortedVertices.end(),
-        [&](const SimplexId a, const SimplexId b) {
-          return (scalars[a] < scalars[b])
-                 || (scalars[a] == scalars[b] && offsets[a] < offsets[b]);
-        });
-    } else {
-      TTK_PSORT(nThreads, sortedVertices.begin(), sortedVertices.end(),
-                [&](const SimplexId a, const SimplexId b) {
-                  return (scalars[a] < scalars[b])
-                         || (scalars[a] == scalars[b] && a < b);
-                });
-    }
+    sortVertices(
+      scalars, offsets, sortedVertices, nThreads,
+      std::integral_constant<bool, radix::IsSortable<scalarType>::value
+                                     && radix::IsSortable<idType>::value>{});
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(nThreads)
@@ -75,4 +151,109 @@ namespace ttk {
     ttk::sortVertices(
       nVerts, scalars, static_cast<int *>(nullptr), order, nThreads);
   }
+
+  /**
+   * @brief Update an order array after a small change of the scalar field
+   *
+   * Incremental alternative to preconditionOrderArray for time-varying
+   * scalar fields. The vertices sorted by their previous order are
+   * scanned for adjacent pairs that are no longer ordered with the new
+   * scalars. The vertices of these pairs are moved aside so that the
+   * remaining sequence stays sorted, then sorted and merged back from
+   * the lowest affected rank. The order array is fully recomputed if
+   * too many vertices are displaced.
+   *
+   * The result is identical to the one of preconditionOrderArray.
+   *
+   * @param[in] nVerts number of vertices
+   * @param[in] scalars pointer to the new scalar field buffer of size @p
+   * nVerts
+   * @param[in,out] order pointer to the order buffer of size @p nVerts,
+   * holding a valid order of the previous scalar field
+   * @param[in] nThreads number of threads to be used
+   * @param[in] maxDisplacedRatio ratio of displaced vertices above which
+   * the order is recomputed from scratch
+   * @return 0 if the order was updated, 1 if it was recomputed
+   */
+  template <typename scalarType>
+  int updateOrderArray(const size_t nVerts,
+                       const scalarType *const scalars,
+                       SimplexId *const order,
+                       const int nThreads = ttk::globalThreadNumber_,
+                       const double maxDisplacedRatio = 0.05) {
+
+    const size_t maxDisplaced = maxDisplacedRatio * nVerts;
+
+    // (scalar, vertex) pairs sorted by previous order, so that the
+    // following passes are sequential
+    struct Item {
+      scalarType scalar;
+      SimplexId vertex;
+    };
+    const auto lower = [](const Item &a, const Item &b) {
+      return (a.scalar < b.scalar)
+             || (a.scalar == b.scalar && a.vertex < b.vertex);
+    };
+    std::vector<Item> items(nVerts, Item{scalarType{}, -1});
+    bool isValid{true};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads) reduction(&& : isValid)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < nVerts; ++i) {
+      if(order[i] < 0 || static_cast<size_t>(order[i]) >= nVerts) {
+        isValid = false;
+      } else {
+        items[order[i]] = {scalars[i], static_cast<SimplexId>(i)};
+      }
+    }
+
+    // move aside both items of every unordered adjacent pair, the kept
+    // items being compacted at the beginning of the vector (always
+    // sorted)
+    std::vector<Item> displaced{};
+    size_t nKept{};
+    for(size_t i = 0; i < nVerts && isValid; ++i) {
+      if(items[i].vertex == -1) {
+        // the previous order is not a permutation
+        isValid = false;
+      } else if(nKept == 0 || lower(items[nKept - 1], items[i])) {
+        items[nKept++] = items[i];
+      } else {
+        displaced.emplace_back(items[--nKept]);
+        displaced.emplace_back(items[i]);
+        isValid = displaced.size() <= maxDisplaced;
+      }
+    }
+    if(!isValid) {
+      preconditionOrderArray(nVerts, scalars, order, nThreads);
+      return 1;
+    }
+    if(displaced.empty()) {
+      return 0;
+    }
+
+    TTK_PSORT(nThreads, displaced.begin(), displaced.end(), lower);
+
+    // merge the displaced items back: the ranks below the previous and
+    // the new ranks of every displaced item are unchanged
+    size_t rank = std::lower_bound(items.begin(), items.begin() + nKept,
+                                   displaced[0], lower)
+                  - items.begin();
+    for(const auto &item : displaced) {
+      rank = std::min<size_t>(rank, order[item.vertex]);
+    }
+    auto kept = items.begin() + rank;
+    const auto keptEnd = items.begin() + nKept;
+    auto moved = displaced.begin();
+    while(kept != keptEnd || moved != displaced.end()) {
+      if(moved == displaced.end()
+         || (kept != keptEnd && lower(*kept, *moved))) {
+        order[(kept++)->vertex] = rank++;
+      } else {
+        order[(moved++)->vertex] = rank++;
+      }
+    }
+
+    return 0;
+  }
 } // namespace ttk
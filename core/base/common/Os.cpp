@@ -19,6 +19,8 @@
 #elif defined(__unix__) || defined(__APPLE__)
 
 #include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/resource.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -26,6 +28,7 @@
 #endif
 
 #include <algorithm>
+#include <cstdio>
 #include <iostream>
 #include <sstream>
 
@@ -231,4 +234,154 @@ namespace ttk {
     return std::remove(fileName.c_str());
   }
 
+  int OsCall::replaceFile(const std::string &source,
+                          const std::string &destination) {
+#ifdef _WIN32
+    // std::rename fails on Windows when the destination exists
+    return MoveFileExA(source.data(), destination.data(),
+                       MOVEFILE_REPLACE_EXISTING)
+             ? 0
+             : -1;
+#else
+    return std::rename(source.data(), destination.data());
+#endif // _WIN32
+  }
+
+  MemoryMappedFile::~MemoryMappedFile() {
+    this->close();
+  }
+
+  int MemoryMappedFile::open(const std::string &fileName) {
+
+    this->close();
+
+#ifdef _WIN32
+    // let other processes append to or replace the mapped file
+    HANDLE file = CreateFileA(
+      fileName.data(), GENERIC_READ,
+      FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL,
+      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(file == INVALID_HANDLE_VALUE) {
+      return -1;
+    }
+    LARGE_INTEGER fileSize{};
+    if(!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+      CloseHandle(file);
+      return -2;
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if(mapping == NULL) {
+      CloseHandle(file);
+      return -3;
+    }
+    const auto addr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if(addr == NULL) {
+      CloseHandle(mapping);
+      CloseHandle(file);
+      return -4;
+    }
+    this->fileHandle_ = file;
+    this->mappingHandle_ = mapping;
+    this->data_ = static_cast<const char *>(addr);
+    this->size_ = static_cast<size_t>(fileSize.QuadPart);
+#else
+    const int fd = ::open(fileName.data(), O_RDONLY);
+    if(fd < 0) {
+      return -1;
+    }
+    struct stat st {};
+    if(fstat(fd, &st) != 0 || st.st_size == 0) {
+      ::close(fd);
+      return -2;
+    }
+    const auto fileSize = static_cast<size_t>(st.st_size);
+    void *addr = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+    // the mapping stays valid after the file descriptor is closed
+    ::close(fd);
+    if(addr == MAP_FAILED) {
+      return -3;
+    }
+    this->data_ = static_cast<const char *>(addr);
+    this->size_ = fileSize;
+#endif // _WIN32
+
+    return 0;
+  }
+
+  void MemoryMappedFile::close() {
+    if(this->data_ == nullptr) {
+      return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(this->data_);
+    CloseHandle(this->mappingHandle_);
+    CloseHandle(this->fileHandle_);
+    this->mappingHandle_ = nullptr;
+    this->fileHandle_ = nullptr;
+#else
+    munmap(const_cast<char *>(this->data_), this->size_);
+#endif // _WIN32
+    this->data_ = nullptr;
+    this->size_ = 0;
+  }
+
+  FileLock::~FileLock() {
+    this->unlock();
+  }
+
+  int FileLock::tryLock(const std::string &fileName) {
+
+    this->unlock();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(fileName.data(), GENERIC_READ | GENERIC_WRITE,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                              OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(file == INVALID_HANDLE_VALUE) {
+      return -1;
+    }
+    OVERLAPPED overlapped{};
+    if(!LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY,
+                   0, 1, 0, &overlapped)) {
+      CloseHandle(file);
+      return -2;
+    }
+    this->fileHandle_ = file;
+#else
+    const int fd = ::open(fileName.data(), O_RDWR | O_CREAT, 0644);
+    if(fd < 0) {
+      return -1;
+    }
+    struct flock lock {};
+    lock.l_type = F_WRLCK;
+    lock.l_whence = SEEK_SET;
+    if(fcntl(fd, F_SETLK, &lock) != 0) {
+      ::close(fd);
+      return -2;
+    }
+    this->fd_ = fd;
+#endif // _WIN32
+
+    return 0;
+  }
+
+  void FileLock::unlock() {
+#ifdef _WIN32
+    if(this->fileHandle_ == nullptr) {
+      return;
+    }
+    OVERLAPPED overlapped{};
+    UnlockFileEx(this->fileHandle_, 0, 1, 0, &overlapped);
+    CloseHandle(this->fileHandle_);
+    this->fileHandle_ = nullptr;
+#else
+    if(this->fd_ < 0) {
+      return;
+    }
+    // closing the descriptor releases the lock
+    ::close(this->fd_);
+    this->fd_ = -1;
+#endif // _WIN32
+  }
+
 } // namespace ttk
@@ -80,9 +80,100 @@ namespace ttk {
 
     static int rmFile(const std::string &fileName);
 
+    /**
+     * @brief Rename a file, replacing the destination if it exists
+     *
+     * @return 0 in case of success
+     */
+    static int replaceFile(const std::string &source,
+                           const std::string &destination);
+
     int static roundToNearestInt(const double &val);
   };
 
+  /**
+   * @brief Read-only memory mapping of a whole file.
+   *
+   * The file content is paged in on demand by the operating system
+   * and the physical pages are shared between processes mapping the
+   * same file. The mapping is released on destruction.
+   */
+  class MemoryMappedFile {
+  public:
+    MemoryMappedFile() = default;
+    ~MemoryMappedFile();
+
+    MemoryMappedFile(const MemoryMappedFile &) = delete;
+    MemoryMappedFile &operator=(const MemoryMappedFile &) = delete;
+
+    /**
+     * @brief Map the given file in memory
+     *
+     * @return 0 in case of success
+     */
+    int open(const std::string &fileName);
+
+    /**
+     * @brief Release the mapping
+     */
+    void close();
+
+    inline const char *data() const {
+      return this->data_;
+    }
+
+    inline size_t size() const {
+      return this->size_;
+    }
+
+    inline bool isOpen() const {
+      return this->data_ != nullptr;
+    }
+
+  private:
+    const char *data_{};
+    size_t size_{};
+#ifdef _WIN32
+    void *fileHandle_{};
+    void *mappingHandle_{};
+#endif // _WIN32
+  };
+
+  /**
+   * @brief Exclusive advisory lock between processes.
+   *
+   * The lock is held on a dedicated file (created if needed) and is
+   * released on unlock, on destruction, or by the operating system
+   * when the process terminates.
+   */
+  class FileLock {
+  public:
+    FileLock() = default;
+    ~FileLock();
+
+    FileLock(const FileLock &) = delete;
+    FileLock &operator=(const FileLock &) = delete;
+
+    /**
+     * @brief Try to acquire the lock without waiting
+     *
+     * @return 0 in case of success
+     */
+    int tryLock(const std::string &fileName);
+
+    /**
+     * @brief Release the lock
+     */
+    void unlock();
+
+  private:
+#ifdef _WIN32
+    void *fileHandle_{};
+#else
+    int fd_{-1};
+#endif // _WIN32
+  };
+
   inline int OsCall::roundToNearestInt(const double &val) {
     const double upperBound = ceil(val);
     const double lowerBound = floor(val);
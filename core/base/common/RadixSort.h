@@ -0,0 +1,182 @@
+#pragma once
+
+#include <BaseClass.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace ttk {
+
+  namespace radix {
+
+    /**
+     * @brief Unsigned integer type of the same size as T
+     */
+    template <size_t size>
+    struct UnsignedOfSize {};
+    template <>
+    struct UnsignedOfSize<1> {
+      using type = uint8_t;
+    };
+    template <>
+    struct UnsignedOfSize<2> {
+      using type = uint16_t;
+    };
+    template <>
+    struct UnsignedOfSize<4> {
+      using type = uint32_t;
+    };
+    template <>
+    struct UnsignedOfSize<8> {
+      using type = uint64_t;
+    };
+
+    /**
+     * @brief Types that can be mapped to an order-preserving unsigned
+     * integer key (integers and IEEE-754 single and double precision)
+     */
+    template <typename T>
+    struct IsSortable
+      : std::integral_constant<
+          bool,
+          !std::is_same<T, bool>::value
+            && (std::is_integral<T>::value
+                || (std::is_floating_point<T>::value
+                    && (sizeof(T) == 4 || sizeof(T) == 8)))> {};
+
+    template <typename T>
+    using KeyType = typename UnsignedOfSize<sizeof(T)>::type;
+
+    /**
+     * @brief Map an integer to an unsigned integer with the same order
+     */
+    template <typename T>
+    inline typename std::enable_if<std::is_integral<T>::value,
+                                   KeyType<T>>::type
+      toKey(const T value) {
+      using U = KeyType<T>;
+      if(std::is_signed<T>::value) {
+        // flip the sign bit
+        return static_cast<U>(static_cast<U>(value)
+                              ^ (U{1} << (sizeof(U) * 8 - 1)));
+      }
+      return static_cast<U>(value);
+    }
+
+    /**
+     * @brief Map a floating-point number to an unsigned integer with
+     * the same order (NaNs excluded)
+     */
+    template <typename T>
+    inline typename std::enable_if<std::is_floating_point<T>::value,
+                                   KeyType<T>>::type
+      toKey(const T value) {
+      using U = KeyType<T>;
+      // -0.0 and +0.0 compare equal
+      const T val = value == T{} ? T{} : value;
+      U bits;
+      std::memcpy(&bits, &val, sizeof(U));
+      constexpr U signBit = U{1} << (sizeof(U) * 8 - 1);
+      // negative numbers: flip all the bits, positive ones: set the
+      // sign bit
+      return (bits & signBit) ? ~bits : (bits | signBit);
+    }
+
+  } // namespace radix
+
+  /**
+   * @brief Stable parallel LSD radix sort of (key, value) pairs
+   *
+   * Sort by increasing unsigned key one byte at a time. Each pass builds
+   * one histogram per thread on a contiguous chunk then scatters the
+   * pairs, so that the sort is stable and its result does not depend
+   * on the number of threads. Passes on a byte shared by all the keys
+   * are skipped.
+   *
+   * @param[in,out] keys Unsigned integer keys
+   * @param[in,out] values Values attached to the keys
+   * @param[in] nThreads Number of threads
+   */
+  template <typename keyType, typename valueType>
+  void radixSort(std::vector<keyType> &keys,
+                 std::vector<valueType> &values,
+                 const int nThreads) {
+
+    static_assert(std::is_unsigned<keyType>::value,
+                  "Radix sort keys should be unsigned integers");
+
+    constexpr size_t radixBits{8};
+    constexpr size_t nBuckets{size_t{1} << radixBits};
+    const size_t n = keys.size();
+
+    // avoid spawning threads on small arrays
+    const size_t minChunkSize{1 << 14};
+    const size_t nChunks = std::max<size_t>(
+      1, std::min<size_t>(std::max(nThreads, 1), n / minChunkSize));
+    const auto chunkBegin
+      = [n, nChunks](const size_t c) { return c * n / nChunks; };
+
+    std::vector<keyType> keysTmp(n);
+    std::vector<valueType> valuesTmp(n);
+    // bucket offsets of each chunk
+    std::vector<size_t> histograms(nChunks * nBuckets);
+
+    TTK_FORCE_USE(nThreads);
+
+    for(size_t shift = 0; shift < sizeof(keyType) * 8; shift += radixBits) {
+
+      std::fill(histograms.begin(), histograms.end(), 0);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nChunks) schedule(static, 1)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t c = 0; c < nChunks; ++c) {
+        auto hist = &histograms[c * nBuckets];
+        const size_t end = chunkBegin(c + 1);
+        for(size_t i = chunkBegin(c); i < end; ++i) {
+          hist[(keys[i] >> shift) & (nBuckets - 1)]++;
+        }
+      }
+
+      // exclusive prefix sum, bucket-major so that chunk order is kept
+      bool skipPass{false};
+      size_t sum{};
+      for(size_t b = 0; b < nBuckets; ++b) {
+        const size_t bucketStart = sum;
+        for(size_t c = 0; c < nChunks; ++c) {
+          const auto count = histograms[c * nBuckets + b];
+          histograms[c * nBuckets + b] = sum;
+          sum += count;
+        }
+        if(sum - bucketStart == n) {
+          // every key has the same byte
+          skipPass = true;
+          break;
+        }
+      }
+      if(skipPass) {
+        continue;
+      }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nChunks) schedule(static, 1)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t c = 0; c < nChunks; ++c) {
+        auto hist = &histograms[c * nBuckets];
+        const size_t end = chunkBegin(c + 1);
+        for(size_t i = chunkBegin(c); i < end; ++i) {
+          const auto pos = hist[(keys[i] >> shift) & (nBuckets - 1)]++;
+          keysTmp[pos] = keys[i];
+          valuesTmp[pos] = values[i];
+        }
+      }
+
+      std::swap(keys, keysTmp);
+      std::swap(values, valuesTmp);
+    }
+  }
+
+} // namespace ttk
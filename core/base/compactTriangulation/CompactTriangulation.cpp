@@ -1,5 +1,8 @@
 #include <CompactTriangulation.h>
 
+#include <atomic>
+#include <cstring>
+
 using namespace ttk;
 
 CompactTriangulation::CompactTriangulation() {
@@ -17,7 +20,9 @@ CompactTriangulation::CompactTriangulation(const CompactTriangulation &rhs)
     vertexIntervals_(rhs.vertexIntervals_), edgeIntervals_(rhs.edgeIntervals_),
     triangleIntervals_(rhs.triangleIntervals_),
     cellIntervals_(rhs.cellIntervals_), cellArray_(rhs.cellArray_),
-    externalCells_(rhs.externalCells_) {
+    externalCells_(rhs.externalCells_), verticesPerCell_(rhs.verticesPerCell_),
+    clusterFileName_(rhs.clusterFileName_),
+    payloadOffset_(rhs.payloadOffset_), payloadSerial_(rhs.payloadSerial_) {
 }
 
 CompactTriangulation &
@@ -36,6 +41,15 @@ CompactTriangulation &
     cellIntervals_ = rhs.cellIntervals_;
     cellArray_ = rhs.cellArray_;
     externalCells_ = rhs.externalCells_;
+    verticesPerCell_ = rhs.verticesPerCell_;
+    clusterFileName_ = rhs.clusterFileName_;
+    payloadOffset_ = rhs.payloadOffset_;
+    // same file, same payloads
+    payloadSerial_ = rhs.payloadSerial_;
+    {
+      std::lock_guard<std::mutex> lock{clusterFilesMutex_};
+      clusterFiles_.clear();
+    }
     // cache system is not copied
   }
   return *this;
@@ -47,14 +61,14 @@ int CompactTriangulation::reorderVertices(std::vector<SimplexId> &vertexMap) {
   // get the number of nodes (the max value in the array)
   nodeNumber_ = 0;
   for(SimplexId vid = 0; vid < vertexNumber_; vid++) {
-    if(vertexIndices_[vid] > nodeNumber_) {
-      nodeNumber_ = vertexIndices_[vid];
+    if(readVertexNodeId(vid) > nodeNumber_) {
+      nodeNumber_ = readVertexNodeId(vid);
     }
   }
   nodeNumber_++; // since the index starts from 0
   std::vector<std::vector<SimplexId>> nodeVertices(nodeNumber_);
   for(SimplexId vid = 0; vid < vertexNumber_; vid++) {
-    nodeVertices[vertexIndices_[vid]].push_back(vid);
+    nodeVertices[readVertexNodeId(vid)].push_back(vid);
   }
 
   // update the vertex intervals
@@ -125,7 +139,7 @@ int CompactTriangulation::reorderCells(const std::vector<SimplexId> &vertexMap,
       cellArr[cellId + j] = vertexMap[cellArr[cellId + j]];
     }
     std::sort(cellArr + cellId, cellArr + cellId + verticesPerCell);
-    nodeCells[vertexIndices_[cellArr[cellId]]].push_back(cid);
+    nodeCells[readVertexNodeId(cellArr[cellId])].push_back(cid);
   }
 
   // rearange the cell array
@@ -140,7 +154,8 @@ int CompactTriangulation::reorderCells(const std::vector<SimplexId> &vertexMap,
       for(int j = 0; j < verticesPerCell; j++) {
         newCellArray[newCellId + j] = connectivity[cellId + j];
         if(newCellArray[newCellId + j] > vertexIntervals_[nid]) {
-          SimplexId const nodeNum = vertexIndices_[newCellArray[newCellId + j]];
+          SimplexId const nodeNum
+            = readVertexNodeId(newCellArray[newCellId + j]);
           if(externalCells_[nodeNum].empty()
              || externalCells_[nodeNum].back() != cid) {
             externalCells_[nodeNum].push_back(cid);
@@ -173,7 +188,7 @@ int CompactTriangulation::reorderCells(const std::vector<SimplexId> &vertexMap,
       cellArr[cellId + j] = vertexMap[cellArr[cellId + j]];
     }
     std::sort(cellArr + cellId + 1, cellArr + cellId + 1 + verticesPerCell);
-    nodeCells[vertexIndices_[cellArr[cellId + 1]]].push_back(cid);
+    nodeCells[readVertexNodeId(cellArr[cellId + 1])].push_back(cid);
   }
 
   // rearange the cell array
@@ -189,7 +204,8 @@ int CompactTriangulation::reorderCells(const std::vector<SimplexId> &vertexMap,
       for(int j = 1; j <= verticesPerCell; j++) {
         newCellArray[newCellId + j] = cellArray[cellId + j];
         if(newCellArray[newCellId + j] > vertexIntervals_[nid]) {
-          SimplexId const nodeNum = vertexIndices_[newCellArray[newCellId + j]];
+          SimplexId const nodeNum
+            = readVertexNodeId(newCellArray[newCellId + j]);
           if(externalCells_[nodeNum].empty()
              || externalCells_[nodeNum].back() != cid) {
             externalCells_[nodeNum].push_back(cid);
@@ -219,7 +235,7 @@ int CompactTriangulation::buildInternalEdgeMap(
     return -1;
 #endif
 
-  SimplexId edgeCount = 0, verticesPerCell = cellArray_->getCellVertexNumber(0);
+  SimplexId edgeCount = 0, verticesPerCell = verticesPerCell_;
 
   if(!nodePtr->internalEdgeMap_.empty()) {
     // if the edge map has been computed and only request the edge list
@@ -241,13 +257,13 @@ int CompactTriangulation::buildInternalEdgeMap(
 
     // loop through each edge of the cell
     for(SimplexId j = 0; j < verticesPerCell - 1; j++) {
-      edgeIds[0] = cellArray_->getCellVertex(cid, j);
+      edgeIds[0] = readCellVertex(cid, j);
       // the edge does not belong to the current node
       if(edgeIds[0] > vertexIntervals_[nodePtr->nid]) {
         break;
       }
       for(SimplexId k = j + 1; k < verticesPerCell; k++) {
-        edgeIds[1] = cellArray_->getCellVertex(cid, k);
+        edgeIds[1] = readCellVertex(cid, k);
 
         // not found in the edge map - assign new edge id
         if(nodePtr->internalEdgeMap_.find(edgeIds)
@@ -266,8 +282,8 @@ int CompactTriangulation::buildInternalEdgeMap(
     // loop through each edge of the cell
     for(SimplexId j = 0; j < verticesPerCell - 1; j++) {
       for(SimplexId k = j + 1; k < verticesPerCell; k++) {
-        edgeIds[0] = cellArray_->getCellVertex(cid, j);
-        edgeIds[1] = cellArray_->getCellVertex(cid, k);
+        edgeIds[0] = readCellVertex(cid, j);
+        edgeIds[1] = readCellVertex(cid, k);
 
         // the edge is in the current node
         if(edgeIds[0] > vertexIntervals_[nodePtr->nid - 1]
@@ -306,7 +322,7 @@ int CompactTriangulation::buildExternalEdgeMap(
     return -1;
 #endif
 
-  SimplexId const verticesPerCell = cellArray_->getCellVertexNumber(0);
+  SimplexId const verticesPerCell = verticesPerCell_;
   boost::unordered_map<SimplexId, std::vector<std::array<SimplexId, 2>>>
     edgeNodes;
 
@@ -318,14 +334,14 @@ int CompactTriangulation::buildExternalEdgeMap(
     // loop through each edge of the cell
     for(SimplexId j = 0; j < verticesPerCell - 1; j++) {
       for(SimplexId k = j + 1; k < verticesPerCell; k++) {
-        edgeIds[0] = cellArray_->getCellVertex(cellId, j);
-        edgeIds[1] = cellArray_->getCellVertex(cellId, k);
+        edgeIds[0] = readCellVertex(cellId, j);
+        edgeIds[1] = readCellVertex(cellId, k);
 
         // check if the edge is an external edge
         if(edgeIds[0] <= vertexIntervals_[nodePtr->nid - 1]
            && edgeIds[1] > vertexIntervals_[nodePtr->nid - 1]
            && edgeIds[1] <= vertexIntervals_[nodePtr->nid]) {
-          SimplexId const nid = vertexIndices_[edgeIds[0]];
+          SimplexId const nid = readVertexNodeId(edgeIds[0]);
           edgeNodes[nid].push_back(edgeIds);
         }
       }
@@ -390,15 +406,15 @@ int CompactTriangulation::buildInternalTriangleMap(
 
     // loop through each triangle of the cell
     for(SimplexId j = 0; j < verticesPerCell - 2; j++) {
-      triangleIds[0] = cellArray_->getCellVertex(cid, j);
+      triangleIds[0] = readCellVertex(cid, j);
       // the triangle does not belong to the current node
       if(triangleIds[0] > vertexIntervals_[nodePtr->nid]) {
         break;
       }
       for(SimplexId k = j + 1; k < verticesPerCell - 1; k++) {
         for(SimplexId l = k + 1; l < verticesPerCell; l++) {
-          triangleIds[1] = cellArray_->getCellVertex(cid, k);
-          triangleIds[2] = cellArray_->getCellVertex(cid, l);
+          triangleIds[1] = readCellVertex(cid, k);
+          triangleIds[2] = readCellVertex(cid, l);
 
           if(nodePtr->internalTriangleMap_.find(triangleIds)
              == nodePtr->internalTriangleMap_.end()) {
@@ -416,13 +432,13 @@ int CompactTriangulation::buildInternalTriangleMap(
 
     // loop through each triangle of the cell
     for(SimplexId j = 0; j < verticesPerCell - 2; j++) {
-      triangleIds[0] = cellArray_->getCellVertex(cid, j);
+      triangleIds[0] = readCellVertex(cid, j);
       if(triangleIds[0] > vertexIntervals_[nodePtr->nid - 1]
          && triangleIds[0] <= vertexIntervals_[nodePtr->nid]) {
         for(SimplexId k = j + 1; k < verticesPerCell - 1; k++) {
           for(SimplexId l = k + 1; l < verticesPerCell; l++) {
-            triangleIds[1] = cellArray_->getCellVertex(cid, k);
-            triangleIds[2] = cellArray_->getCellVertex(cid, l);
+            triangleIds[1] = readCellVertex(cid, k);
+            triangleIds[2] = readCellVertex(cid, l);
 
             if(nodePtr->internalTriangleMap_.find(triangleIds)
                == nodePtr->internalTriangleMap_.end()) {
@@ -459,7 +475,7 @@ int CompactTriangulation::buildExternalTriangleMap(
     return -1;
 #endif
 
-  SimplexId const verticesPerCell = cellArray_->getCellVertexNumber(0);
+  SimplexId const verticesPerCell = verticesPerCell_;
   boost::unordered_map<SimplexId, std::vector<std::array<SimplexId, 3>>>
     nodeTriangles;
 
@@ -469,20 +485,20 @@ int CompactTriangulation::buildExternalTriangleMap(
 
     // loop through each triangle of the cell
     for(SimplexId j = 0; j < verticesPerCell - 2; j++) {
-      triangleIds[0] = cellArray_->getCellVertex(cid, j);
+      triangleIds[0] = readCellVertex(cid, j);
       if(triangleIds[0] <= vertexIntervals_[nodePtr->nid - 1]) {
         for(SimplexId k = j + 1; k < verticesPerCell - 1; k++) {
           for(SimplexId l = k + 1; l < verticesPerCell; l++) {
-            triangleIds[1] = cellArray_->getCellVertex(cid, k);
-            triangleIds[2] = cellArray_->getCellVertex(cid, l);
+            triangleIds[1] = readCellVertex(cid, k);
+            triangleIds[2] = readCellVertex(cid, l);
 
             if(triangleIds[1] > vertexIntervals_[nodePtr->nid - 1]
                && triangleIds[1] <= vertexIntervals_[nodePtr->nid]) {
-              SimplexId const nodeNum = vertexIndices_[triangleIds[0]];
+              SimplexId const nodeNum = readVertexNodeId(triangleIds[0]);
               nodeTriangles[nodeNum].push_back(triangleIds);
             } else if(triangleIds[2] > vertexIntervals_[nodePtr->nid - 1]
                       && triangleIds[2] <= vertexIntervals_[nodePtr->nid]) {
-              SimplexId const nodeNum = vertexIndices_[triangleIds[0]];
+              SimplexId const nodeNum = readVertexNodeId(triangleIds[0]);
               nodeTriangles[nodeNum].push_back(triangleIds);
             }
           }
@@ -524,7 +540,7 @@ SimplexId CompactTriangulation::countInternalEdges(SimplexId nodeId) const {
     return -1;
 #endif
 
-  SimplexId edgeCount = 0, verticesPerCell = cellArray_->getCellVertexNumber(0);
+  SimplexId edgeCount = 0, verticesPerCell = verticesPerCell_;
   boost::unordered_set<std::array<SimplexId, 2>,
                        boost::hash<std::array<SimplexId, 2>>>
     edgeSet;
@@ -536,13 +552,13 @@ SimplexId CompactTriangulation::countInternalEdges(SimplexId nodeId) const {
 
     // loop through each edge of the cell
     for(SimplexId j = 0; j < verticesPerCell - 1; j++) {
-      edgeIds[0] = cellArray_->getCellVertex(cid, j);
+      edgeIds[0] = readCellVertex(cid, j);
       // the edge does not belong to the current node
       if(edgeIds[0] > vertexIntervals_[nodeId]) {
         break;
       }
       for(SimplexId k = j + 1; k < verticesPerCell; k++) {
-        edgeIds[1] = cellArray_->getCellVertex(cid, k);
+        edgeIds[1] = readCellVertex(cid, k);
 
         // not found in the edge map - assign new edge id
         if(edgeSet.find(edgeIds) == edgeSet.end()) {
@@ -560,8 +576,8 @@ SimplexId CompactTriangulation::countInternalEdges(SimplexId nodeId) const {
     // loop through each edge of the cell
     for(SimplexId j = 0; j < verticesPerCell - 1; j++) {
       for(SimplexId k = j + 1; k < verticesPerCell; k++) {
-        edgeIds[0] = cellArray_->getCellVertex(cid, j);
-        edgeIds[1] = cellArray_->getCellVertex(cid, k);
+        edgeIds[0] = readCellVertex(cid, j);
+        edgeIds[1] = readCellVertex(cid, k);
 
         // the edge is in the current node
         if(edgeIds[0] > vertexIntervals_[nodeId - 1]
@@ -586,7 +602,7 @@ int CompactTriangulation::countInternalTriangles(SimplexId nodeId) const {
 #endif
 
   SimplexId triangleCount = 0,
-            verticesPerCell = cellArray_->getCellVertexNumber(0);
+            verticesPerCell = verticesPerCell_;
   boost::unordered_set<std::array<SimplexId, 3>> triangleSet;
 
   // loop through the internal cell list
@@ -596,15 +612,15 @@ int CompactTriangulation::countInternalTriangles(SimplexId nodeId) const {
 
     // loop through each triangle of the cell
     for(SimplexId j = 0; j < verticesPerCell - 2; j++) {
-      triangleIds[0] = cellArray_->getCellVertex(cid, j);
+      triangleIds[0] = readCellVertex(cid, j);
       // the triangle does not belong to the current node
       if(triangleIds[0] > vertexIntervals_[nodeId]) {
         break;
       }
       for(SimplexId k = j + 1; k < verticesPerCell - 1; k++) {
         for(SimplexId l = k + 1; l < verticesPerCell; l++) {
-          triangleIds[1] = cellArray_->getCellVertex(cid, k);
-          triangleIds[2] = cellArray_->getCellVertex(cid, l);
+          triangleIds[1] = readCellVertex(cid, k);
+          triangleIds[2] = readCellVertex(cid, l);
 
           if(triangleSet.find(triangleIds) == triangleSet.end()) {
             triangleCount++;
@@ -621,13 +637,13 @@ int CompactTriangulation::countInternalTriangles(SimplexId nodeId) const {
 
     // loop through each triangle of the cell
     for(SimplexId j = 0; j < verticesPerCell - 2; j++) {
-      triangleIds[0] = cellArray_->getCellVertex(cid, j);
+      triangleIds[0] = readCellVertex(cid, j);
       if(triangleIds[0] > vertexIntervals_[nodeId - 1]
          && triangleIds[0] <= vertexIntervals_[nodeId]) {
         for(SimplexId k = j + 1; k < verticesPerCell - 1; k++) {
           for(SimplexId l = k + 1; l < verticesPerCell; l++) {
-            triangleIds[1] = cellArray_->getCellVertex(cid, k);
-            triangleIds[2] = cellArray_->getCellVertex(cid, l);
+            triangleIds[1] = readCellVertex(cid, k);
+            triangleIds[2] = readCellVertex(cid, l);
 
             if(triangleSet.find(triangleIds) == triangleSet.end()) {
               triangleCount++;
@@ -652,7 +668,7 @@ int CompactTriangulation::getClusterCellNeighbors(
 
   std::vector<std::vector<SimplexId>> localCellNeighbors(
     cellIntervals_[nodePtr->nid] - cellIntervals_[nodePtr->nid - 1]);
-  SimplexId const verticesPerCell = cellArray_->getCellVertexNumber(0);
+  SimplexId const verticesPerCell = verticesPerCell_;
   std::vector<std::vector<SimplexId>> localVertexStars;
 
   if(nodePtr->vertexStars_.empty()) {
@@ -668,9 +684,9 @@ int CompactTriangulation::getClusterCellNeighbors(
   for(SimplexId cid = cellIntervals_[nodePtr->nid - 1] + 1;
       cid <= cellIntervals_[nodePtr->nid]; cid++) {
     for(SimplexId j = 1; j < verticesPerCell; j++) {
-      if(cellArray_->getCellVertex(cid, j) > vertexIntervals_[nodePtr->nid]) {
+      if(readCellVertex(cid, j) > vertexIntervals_[nodePtr->nid]) {
         SimplexId const nodeId
-          = vertexIndices_[cellArray_->getCellVertex(cid, j)];
+          = readVertexNodeId(readCellVertex(cid, j));
         if(nodeMaps.find(nodeId) == nodeMaps.end()) {
           ImplicitCluster newNode(nodeId);
           getClusterVertexStars(&newNode);
@@ -691,8 +707,8 @@ int CompactTriangulation::getClusterCellNeighbors(
         cid <= cellIntervals_[nodePtr->nid]; cid++) {
       for(SimplexId j = 0; j < 3; j++) {
 
-        SimplexId const v0 = cellArray_->getCellVertex(cid, j);
-        SimplexId const v1 = cellArray_->getCellVertex(cid, (j + 1) % 3);
+        SimplexId const v0 = readCellVertex(cid, j);
+        SimplexId const v1 = readCellVertex(cid, (j + 1) % 3);
         SimplexId localV0 = v0 - vertexIntervals_[nodePtr->nid - 1] - 1;
         SimplexId localV1 = v1 - vertexIntervals_[nodePtr->nid - 1] - 1;
 
@@ -700,14 +716,14 @@ int CompactTriangulation::getClusterCellNeighbors(
         if(v0 <= vertexIntervals_[nodePtr->nid]) {
           stars0 = localVertexStars[localV0];
         } else {
-          localV0 = v0 - vertexIntervals_[vertexIndices_[v0] - 1] - 1;
-          stars0 = nodeMaps[vertexIndices_[v0]][localV0];
+          localV0 = v0 - vertexIntervals_[readVertexNodeId(v0) - 1] - 1;
+          stars0 = nodeMaps[readVertexNodeId(v0)][localV0];
         }
         if(v1 <= vertexIntervals_[nodePtr->nid]) {
           stars1 = localVertexStars[localV1];
         } else {
-          localV1 = v1 - vertexIntervals_[vertexIndices_[v1] - 1] - 1;
-          stars1 = nodeMaps[vertexIndices_[v1]][localV1];
+          localV1 = v1 - vertexIntervals_[readVertexNodeId(v1) - 1] - 1;
+          stars1 = nodeMaps[readVertexNodeId(v1)][localV1];
         }
 
         // perform an intersection of the 2 sorted star lists
@@ -764,9 +780,9 @@ int CompactTriangulation::getClusterCellNeighbors(
       // go triangle by triangle
       for(SimplexId j = 0; j < 4; j++) {
 
-        SimplexId const v0 = cellArray_->getCellVertex(cid, j % 4);
-        SimplexId const v1 = cellArray_->getCellVertex(cid, (j + 1) % 4);
-        SimplexId const v2 = cellArray_->getCellVertex(cid, (j + 2) % 4);
+        SimplexId const v0 = readCellVertex(cid, j % 4);
+        SimplexId const v1 = readCellVertex(cid, (j + 1) % 4);
+        SimplexId const v2 = readCellVertex(cid, (j + 2) % 4);
 
         SimplexId localV0 = v0 - vertexIntervals_[nodePtr->nid - 1] - 1;
         SimplexId localV1 = v1 - vertexIntervals_[nodePtr->nid - 1] - 1;
@@ -776,20 +792,20 @@ int CompactTriangulation::getClusterCellNeighbors(
         if(v0 <= vertexIntervals_[nodePtr->nid]) {
           stars0 = localVertexStars[localV0];
         } else {
-          localV0 = v0 - vertexIntervals_[vertexIndices_[v0] - 1] - 1;
-          stars0 = nodeMaps[vertexIndices_[v0]][localV0];
+          localV0 = v0 - vertexIntervals_[readVertexNodeId(v0) - 1] - 1;
+          stars0 = nodeMaps[readVertexNodeId(v0)][localV0];
         }
         if(v1 <= vertexIntervals_[nodePtr->nid]) {
           stars1 = localVertexStars[localV1];
         } else {
-          localV1 = v1 - vertexIntervals_[vertexIndices_[v1] - 1] - 1;
-          stars1 = nodeMaps[vertexIndices_[v1]][localV1];
+          localV1 = v1 - vertexIntervals_[readVertexNodeId(v1) - 1] - 1;
+          stars1 = nodeMaps[readVertexNodeId(v1)][localV1];
         }
         if(v2 <= vertexIntervals_[nodePtr->nid]) {
           stars2 = localVertexStars[localV2];
         } else {
-          localV2 = v2 - vertexIntervals_[vertexIndices_[v2] - 1] - 1;
-          stars2 = nodeMaps[vertexIndices_[v2]][localV2];
+          localV2 = v2 - vertexIntervals_[readVertexNodeId(v2) - 1] - 1;
+          stars2 = nodeMaps[readVertexNodeId(v2)][localV2];
         }
 
         // perform an intersection of the 3 (sorted) star lists
@@ -881,11 +897,11 @@ int CompactTriangulation::getClusterCellTriangles(
       i <= cellIntervals_[nodePtr->nid]; i++) {
     std::array<SimplexId, 3> triangleVec;
     // get the internal triangle from the map
-    triangleVec[0] = cellArray_->getCellVertex(i, 0);
+    triangleVec[0] = readCellVertex(i, 0);
     for(SimplexId k = 1; k < verticesPerCell - 1; k++) {
-      triangleVec[1] = cellArray_->getCellVertex(i, k);
+      triangleVec[1] = readCellVertex(i, k);
       for(SimplexId l = k + 1; l < verticesPerCell; l++) {
-        triangleVec[2] = cellArray_->getCellVertex(i, l);
+        triangleVec[2] = readCellVertex(i, l);
         (nodePtr->tetraTriangles_)[i - cellIntervals_[nodePtr->nid - 1] - 1]
                                   [k + l - 3]
           = nodePtr->internalTriangleMap_.at(triangleVec)
@@ -893,9 +909,9 @@ int CompactTriangulation::getClusterCellTriangles(
       }
     }
     // group the external triangles by node id
-    triangleVec[0] = cellArray_->getCellVertex(i, 1);
-    triangleVec[1] = cellArray_->getCellVertex(i, 2);
-    triangleVec[2] = cellArray_->getCellVertex(i, 3);
+    triangleVec[0] = readCellVertex(i, 1);
+    triangleVec[1] = readCellVertex(i, 2);
+    triangleVec[2] = readCellVertex(i, 3);
     if(triangleVec[0] <= vertexIntervals_[nodePtr->nid]) {
       (nodePtr->tetraTriangles_)[i - cellIntervals_[nodePtr->nid - 1] - 1]
         .back()
@@ -904,7 +920,7 @@ int CompactTriangulation::getClusterCellTriangles(
     } else {
       std::vector<SimplexId> const triangleTuple
         = {i, triangleVec[0], triangleVec[1], triangleVec[2]};
-      SimplexId const nodeNum = vertexIndices_[triangleVec[0]];
+      SimplexId const nodeNum = readVertexNodeId(triangleVec[0]);
       nodeTriangles[nodeNum].push_back(triangleTuple);
     }
   }
@@ -967,7 +983,7 @@ int CompactTriangulation::getClusterEdgeLinks(
           j++) {
         SimplexId const cellId = nodePtr->edgeStars_.get(iter->second - 1, j);
         for(int k = 0; k < 3; k++) {
-          SimplexId const vertexId = cellArray_->getCellVertex(cellId, k);
+          SimplexId const vertexId = readCellVertex(cellId, k);
           if((vertexId != iter->first[0]) && (vertexId != iter->first[1])) {
             offsets[iter->second]++;
             break;
@@ -991,7 +1007,7 @@ int CompactTriangulation::getClusterEdgeLinks(
           j++) {
         SimplexId const cellId = nodePtr->edgeStars_.get(iter->second - 1, j);
         for(int k = 0; k < 3; k++) {
-          SimplexId const vertexId = cellArray_->getCellVertex(cellId, k);
+          SimplexId const vertexId = readCellVertex(cellId, k);
           if((vertexId != iter->first[0]) && (vertexId != iter->first[1])) {
             SimplexId const localEdgeId = iter->second - 1;
             edgeLinkData[offsets[localEdgeId] + linksCount[localEdgeId]]
@@ -1019,10 +1035,10 @@ int CompactTriangulation::getClusterEdgeLinks(
     for(SimplexId cid = 0; cid < localCellNum; cid++) {
       SimplexId const cellId = cid + cellIntervals_[nodePtr->nid - 1] + 1;
       std::array<SimplexId, 4> vertexIds
-        = {(SimplexId)cellArray_->getCellVertex(cellId, 0),
-           (SimplexId)cellArray_->getCellVertex(cellId, 1),
-           (SimplexId)cellArray_->getCellVertex(cellId, 2),
-           (SimplexId)cellArray_->getCellVertex(cellId, 3)};
+        = {(SimplexId)readCellVertex(cellId, 0),
+           (SimplexId)readCellVertex(cellId, 1),
+           (SimplexId)readCellVertex(cellId, 2),
+           (SimplexId)readCellVertex(cellId, 3)};
       std::array<SimplexId, 2> edgePair;
       edgePair[0] = vertexIds[0];
       for(SimplexId j = 1; j < 4; j++) {
@@ -1046,10 +1062,10 @@ int CompactTriangulation::getClusterEdgeLinks(
     for(SimplexId const cid : externalCells_[nodePtr->nid]) {
       std::array<SimplexId, 2> edgeIds;
       std::array<SimplexId, 4> vertexIds
-        = {(SimplexId)cellArray_->getCellVertex(cid, 0),
-           (SimplexId)cellArray_->getCellVertex(cid, 1),
-           (SimplexId)cellArray_->getCellVertex(cid, 2),
-           (SimplexId)cellArray_->getCellVertex(cid, 3)};
+        = {(SimplexId)readCellVertex(cid, 0),
+           (SimplexId)readCellVertex(cid, 1),
+           (SimplexId)readCellVertex(cid, 2),
+           (SimplexId)readCellVertex(cid, 3)};
 
       // loop through each edge of the cell
       for(SimplexId j = 0; j < 3; j++) {
@@ -1078,10 +1094,10 @@ int CompactTriangulation::getClusterEdgeLinks(
     for(SimplexId cid = 0; cid < localCellNum; cid++) {
       SimplexId const cellId = cid + cellIntervals_[nodePtr->nid - 1] + 1;
       std::array<SimplexId, 4> vertexIds
-        = {(SimplexId)cellArray_->getCellVertex(cellId, 0),
-           (SimplexId)cellArray_->getCellVertex(cellId, 1),
-           (SimplexId)cellArray_->getCellVertex(cellId, 2),
-           (SimplexId)cellArray_->getCellVertex(cellId, 3)};
+        = {(SimplexId)readCellVertex(cellId, 0),
+           (SimplexId)readCellVertex(cellId, 1),
+           (SimplexId)readCellVertex(cellId, 2),
+           (SimplexId)readCellVertex(cellId, 3)};
       std::array<SimplexId, 2> edgePair;
       edgePair[0] = vertexIds[0];
       for(SimplexId j = 1; j < 4; j++) {
@@ -1117,10 +1133,10 @@ int CompactTriangulation::getClusterEdgeLinks(
     boost::unordered_map<SimplexId, ImplicitCluster> nodeMaps;
     for(SimplexId const cid : externalCells_[nodePtr->nid]) {
       std::array<SimplexId, 4> vertexIds
-        = {(SimplexId)cellArray_->getCellVertex(cid, 0),
-           (SimplexId)cellArray_->getCellVertex(cid, 1),
-           (SimplexId)cellArray_->getCellVertex(cid, 2),
-           (SimplexId)cellArray_->getCellVertex(cid, 3)};
+        = {(SimplexId)readCellVertex(cid, 0),
+           (SimplexId)readCellVertex(cid, 1),
+           (SimplexId)readCellVertex(cid, 2),
+           (SimplexId)readCellVertex(cid, 3)};
 
       std::array<SimplexId, 2> edgeIds;
       // loop through each edge of the cell
@@ -1146,7 +1162,7 @@ int CompactTriangulation::getClusterEdgeLinks(
                 }
               }
             }
-            SimplexId const nodeId = vertexIndices_[otherEdge[0]];
+            SimplexId const nodeId = readVertexNodeId(otherEdge[0]);
             if(nodeMaps.find(nodeId) == nodeMaps.end()) {
               nodeMaps[nodeId] = ImplicitCluster(nodeId);
               buildInternalEdgeMap(&nodeMaps[nodeId], false, true);
@@ -1176,7 +1192,7 @@ int CompactTriangulation::getClusterEdgeStars(
     return -1;
 #endif
 
-  SimplexId const verticesPerCell = cellArray_->getCellVertexNumber(0);
+  SimplexId const verticesPerCell = verticesPerCell_;
   SimplexId const localEdgeNum
     = edgeIntervals_[nodePtr->nid] - edgeIntervals_[nodePtr->nid - 1];
   std::vector<SimplexId> offsets(localEdgeNum + 1, 0), starsCount(localEdgeNum);
@@ -1191,13 +1207,13 @@ int CompactTriangulation::getClusterEdgeStars(
       cid <= cellIntervals_[nodePtr->nid]; cid++) {
     std::array<SimplexId, 2> edgeIds;
     for(SimplexId j = 0; j < verticesPerCell - 1; j++) {
-      edgeIds[0] = cellArray_->getCellVertex(cid, j);
+      edgeIds[0] = readCellVertex(cid, j);
       // the edge does not belong to the current node
       if(edgeIds[0] > vertexIntervals_[nodePtr->nid]) {
         break;
       }
       for(SimplexId k = j + 1; k < verticesPerCell; k++) {
-        edgeIds[1] = cellArray_->getCellVertex(cid, k);
+        edgeIds[1] = readCellVertex(cid, k);
         offsets[nodePtr->internalEdgeMap_.at(edgeIds)]++;
       }
     }
@@ -1207,8 +1223,8 @@ int CompactTriangulation::getClusterEdgeStars(
     std::array<SimplexId, 2> edgeIds;
     for(SimplexId j = 0; j < verticesPerCell - 1; j++) {
       for(SimplexId k = j + 1; k < verticesPerCell; k++) {
-        edgeIds[0] = cellArray_->getCellVertex(cid, j);
-        edgeIds[1] = cellArray_->getCellVertex(cid, k);
+        edgeIds[0] = readCellVertex(cid, j);
+        edgeIds[1] = readCellVertex(cid, k);
         if(edgeIds[0] > vertexIntervals_[nodePtr->nid - 1]
            && edgeIds[0] <= vertexIntervals_[nodePtr->nid]) {
           offsets[nodePtr->internalEdgeMap_.at(edgeIds)]++;
@@ -1231,13 +1247,13 @@ int CompactTriangulation::getClusterEdgeStars(
       cid <= cellIntervals_[nodePtr->nid]; cid++) {
     std::array<SimplexId, 2> edgeIds;
     for(SimplexId j = 0; j < verticesPerCell - 1; j++) {
-      edgeIds[0] = cellArray_->getCellVertex(cid, j);
+      edgeIds[0] = readCellVertex(cid, j);
       // the edge does not belong to the current node
       if(edgeIds[0] > vertexIntervals_[nodePtr->nid]) {
         break;
       }
       for(SimplexId k = j + 1; k < verticesPerCell; k++) {
-        edgeIds[1] = cellArray_->getCellVertex(cid, k);
+        edgeIds[1] = readCellVertex(cid, k);
         SimplexId const localEdgeId = nodePtr->internalEdgeMap_.at(edgeIds) - 1;
         edgeStarData[offsets[localEdgeId] + starsCount[localEdgeId]] = cid;
         starsCount[localEdgeId]++;
@@ -1249,8 +1265,8 @@ int CompactTriangulation::getClusterEdgeStars(
     std::array<SimplexId, 2> edgeIds;
     for(SimplexId j = 0; j < verticesPerCell - 1; j++) {
       for(SimplexId k = j + 1; k < verticesPerCell; k++) {
-        edgeIds[0] = cellArray_->getCellVertex(cid, j);
-        edgeIds[1] = cellArray_->getCellVertex(cid, k);
+        edgeIds[0] = readCellVertex(cid, j);
+        edgeIds[1] = readCellVertex(cid, k);
         if(edgeIds[0] > vertexIntervals_[nodePtr->nid - 1]
            && edgeIds[0] <= vertexIntervals_[nodePtr->nid]) {
           SimplexId const localEdgeId
@@ -1388,8 +1404,8 @@ int CompactTriangulation::getClusterTetraEdges(
     // get the internal edge id from the map
     for(SimplexId k = 1; k < verticesPerCell; k++) {
       std::array<SimplexId, 2> const edgePair
-        = {(SimplexId)cellArray_->getCellVertex(i, 0),
-           (SimplexId)cellArray_->getCellVertex(i, k)};
+        = {(SimplexId)readCellVertex(i, 0),
+           (SimplexId)readCellVertex(i, k)};
       (nodePtr->tetraEdges_)[i - cellIntervals_[nodePtr->nid - 1] - 1][cnt++]
         = nodePtr->internalEdgeMap_.at(edgePair)
           + edgeIntervals_[nodePtr->nid - 1];
@@ -1397,8 +1413,8 @@ int CompactTriangulation::getClusterTetraEdges(
     for(SimplexId j = 1; j < verticesPerCell - 1; j++) {
       for(SimplexId k = j + 1; k < verticesPerCell; k++) {
         std::array<SimplexId, 2> edgePair
-          = {(SimplexId)cellArray_->getCellVertex(i, j),
-             (SimplexId)cellArray_->getCellVertex(i, k)};
+          = {(SimplexId)readCellVertex(i, j),
+             (SimplexId)readCellVertex(i, k)};
         if(edgePair[0] <= vertexIntervals_[nodePtr->nid]) {
           (nodePtr
              ->tetraEdges_)[i - cellIntervals_[nodePtr->nid - 1] - 1][cnt++]
@@ -1409,7 +1425,7 @@ int CompactTriangulation::getClusterTetraEdges(
         else {
           std::vector<SimplexId> const edgeTuple{
             i, cnt++, edgePair[0], edgePair[1]};
-          SimplexId const nodeNum = vertexIndices_[edgePair[0]];
+          SimplexId const nodeNum = readVertexNodeId(edgePair[0]);
           edgeNodes[nodeNum].push_back(edgeTuple);
         }
       }
@@ -1465,18 +1481,18 @@ int CompactTriangulation::getClusterTriangleEdges(
         i <= cellIntervals_[nodePtr->nid]; i++) {
       // {v0, v1}
       std::array<SimplexId, 2> edgePair
-        = {(SimplexId)cellArray_->getCellVertex(i, 0),
-           (SimplexId)cellArray_->getCellVertex(i, 1)};
+        = {(SimplexId)readCellVertex(i, 0),
+           (SimplexId)readCellVertex(i, 1)};
       (nodePtr->triangleEdges_)[i - cellIntervals_[nodePtr->nid - 1] - 1][0]
         = nodePtr->internalEdgeMap_.at(edgePair)
           + edgeIntervals_[nodePtr->nid - 1];
       // {v0, v2};
-      edgePair[1] = cellArray_->getCellVertex(i, 2);
+      edgePair[1] = readCellVertex(i, 2);
       (nodePtr->triangleEdges_)[i - cellIntervals_[nodePtr->nid - 1] - 1][1]
         = nodePtr->internalEdgeMap_.at(edgePair)
           + edgeIntervals_[nodePtr->nid - 1];
       // {v1, v2}
-      edgePair[0] = cellArray_->getCellVertex(i, 1);
+      edgePair[0] = readCellVertex(i, 1);
       if(edgePair[0] <= vertexIntervals_[nodePtr->nid]) {
         (nodePtr->triangleEdges_)[i - cellIntervals_[nodePtr->nid - 1] - 1][2]
           = nodePtr->internalEdgeMap_.at(edgePair)
@@ -1485,7 +1501,7 @@ int CompactTriangulation::getClusterTriangleEdges(
       // group the external edges by node id
       else {
         std::vector<SimplexId> const edgeTuple{i, edgePair[0], edgePair[1]};
-        SimplexId const nodeNum = vertexIndices_[edgePair[0]];
+        SimplexId const nodeNum = readVertexNodeId(edgePair[0]);
         edgeNodes[nodeNum].push_back(edgeTuple);
       }
     }
@@ -1541,7 +1557,7 @@ int CompactTriangulation::getClusterTriangleEdges(
       } else {
         std::vector<SimplexId> const edgeTuple{
           iter->second - 1, edgePair[0], edgePair[1]};
-        SimplexId const nodeNum = vertexIndices_[edgePair[0]];
+        SimplexId const nodeNum = readVertexNodeId(edgePair[0]);
         edgeNodes[nodeNum].push_back(edgeTuple);
       }
     }
@@ -1601,7 +1617,7 @@ int CompactTriangulation::getClusterTriangleLinks(
         i++) {
       SimplexId const cellId = nodePtr->triangleStars_.get(iter->second - 1, i);
       for(int j = 0; j < 4; j++) {
-        SimplexId const vertexId = cellArray_->getCellVertex(cellId, j);
+        SimplexId const vertexId = readCellVertex(cellId, j);
         if((vertexId != iter->first[0]) && (vertexId != iter->first[1])
            && (vertexId != iter->first[2])) {
           offsets[iter->second]++;
@@ -1626,7 +1642,7 @@ int CompactTriangulation::getClusterTriangleLinks(
         i++) {
       SimplexId const cellId = nodePtr->triangleStars_.get(iter->second - 1, i);
       for(int j = 0; j < 4; j++) {
-        SimplexId const vertexId = cellArray_->getCellVertex(cellId, j);
+        SimplexId const vertexId = readCellVertex(cellId, j);
         if((vertexId != iter->first[0]) && (vertexId != iter->first[1])
            && (vertexId != iter->first[2])) {
           triangleLinkData[offsets[iter->second - 1]
@@ -1654,7 +1670,7 @@ int CompactTriangulation::getClusterTriangleStars(
     return -1;
 #endif
 
-  SimplexId const verticesPerCell = cellArray_->getCellVertexNumber(0);
+  SimplexId const verticesPerCell = verticesPerCell_;
   SimplexId const localTriangleNum
     = triangleIntervals_[nodePtr->nid] - triangleIntervals_[nodePtr->nid - 1];
   std::vector<SimplexId> offsets(localTriangleNum + 1, 0),
@@ -1670,14 +1686,14 @@ int CompactTriangulation::getClusterTriangleStars(
       cid <= cellIntervals_[nodePtr->nid]; cid++) {
     std::array<SimplexId, 3> triangleIds;
     for(SimplexId j = 0; j < verticesPerCell - 2; j++) {
-      triangleIds[0] = cellArray_->getCellVertex(cid, j);
+      triangleIds[0] = readCellVertex(cid, j);
       if(triangleIds[0] > vertexIntervals_[nodePtr->nid]) {
         break;
       }
       for(SimplexId k = j + 1; k < verticesPerCell - 1; k++) {
         for(SimplexId l = k + 1; l < verticesPerCell; l++) {
-          triangleIds[1] = cellArray_->getCellVertex(cid, k);
-          triangleIds[2] = cellArray_->getCellVertex(cid, l);
+          triangleIds[1] = readCellVertex(cid, k);
+          triangleIds[2] = readCellVertex(cid, l);
           offsets[nodePtr->internalTriangleMap_.at(triangleIds)]++;
         }
       }
@@ -1687,13 +1703,13 @@ int CompactTriangulation::getClusterTriangleStars(
   for(SimplexId const cid : externalCells_[nodePtr->nid]) {
     std::array<SimplexId, 3> triangleIds;
     for(SimplexId j = 0; j < verticesPerCell - 2; j++) {
-      triangleIds[0] = cellArray_->getCellVertex(cid, j);
+      triangleIds[0] = readCellVertex(cid, j);
       if(triangleIds[0] > vertexIntervals_[nodePtr->nid - 1]
          && triangleIds[0] <= vertexIntervals_[nodePtr->nid]) {
         for(SimplexId k = j + 1; k < verticesPerCell - 1; k++) {
           for(SimplexId l = k + 1; l < verticesPerCell; l++) {
-            triangleIds[1] = cellArray_->getCellVertex(cid, k);
-            triangleIds[2] = cellArray_->getCellVertex(cid, l);
+            triangleIds[1] = readCellVertex(cid, k);
+            triangleIds[2] = readCellVertex(cid, l);
             offsets[nodePtr->internalTriangleMap_.at(triangleIds)]++;
           }
         }
@@ -1715,15 +1731,15 @@ int CompactTriangulation::getClusterTriangleStars(
       cid <= cellIntervals_[nodePtr->nid]; cid++) {
     std::array<SimplexId, 3> triangleIds;
     for(SimplexId j = 0; j < verticesPerCell - 2; j++) {
-      triangleIds[0] = cellArray_->getCellVertex(cid, j);
+      triangleIds[0] = readCellVertex(cid, j);
       // the triangle does not belong to the current node
       if(triangleIds[0] > vertexIntervals_[nodePtr->nid]) {
         break;
       }
       for(SimplexId k = j + 1; k < verticesPerCell - 1; k++) {
         for(SimplexId l = k + 1; l < verticesPerCell; l++) {
-          triangleIds[1] = cellArray_->getCellVertex(cid, k);
-          triangleIds[2] = cellArray_->getCellVertex(cid, l);
+          triangleIds[1] = readCellVertex(cid, k);
+          triangleIds[2] = readCellVertex(cid, l);
           SimplexId const localTriangleId
             = nodePtr->internalTriangleMap_.at(triangleIds) - 1;
           triangleStarData[offsets[localTriangleId]
@@ -1740,13 +1756,13 @@ int CompactTriangulation::getClusterTriangleStars(
 
     // loop through each triangle of the cell
     for(SimplexId j = 0; j < verticesPerCell - 2; j++) {
-      triangleIds[0] = cellArray_->getCellVertex(cid, j);
+      triangleIds[0] = readCellVertex(cid, j);
       if(triangleIds[0] > vertexIntervals_[nodePtr->nid - 1]
          && triangleIds[0] <= vertexIntervals_[nodePtr->nid]) {
         for(SimplexId k = j + 1; k < verticesPerCell - 1; k++) {
           for(SimplexId l = k + 1; l < verticesPerCell; l++) {
-            triangleIds[1] = cellArray_->getCellVertex(cid, k);
-            triangleIds[2] = cellArray_->getCellVertex(cid, l);
+            triangleIds[1] = readCellVertex(cid, k);
+            triangleIds[2] = readCellVertex(cid, l);
             SimplexId const localTriangleId
               = nodePtr->internalTriangleMap_.at(triangleIds) - 1;
             triangleStarData[offsets[localTriangleId]
@@ -1859,19 +1875,19 @@ int CompactTriangulation::getClusterVertexLinks(
     // set the offsets vector
     for(SimplexId cid = cellIntervals_[nodePtr->nid - 1] + 1;
         cid <= cellIntervals_[nodePtr->nid]; cid++) {
-      offsets[cellArray_->getCellVertex(cid, 0)
+      offsets[readCellVertex(cid, 0)
               - vertexIntervals_[nodePtr->nid - 1]]++;
       for(SimplexId j = 1; j < 3; j++) {
-        if(cellArray_->getCellVertex(cid, j)
+        if(readCellVertex(cid, j)
            <= vertexIntervals_[nodePtr->nid]) {
-          offsets[cellArray_->getCellVertex(cid, j)
+          offsets[readCellVertex(cid, j)
                   - vertexIntervals_[nodePtr->nid - 1]]++;
         }
       }
     }
     for(SimplexId const cid : externalCells_[nodePtr->nid]) {
       for(SimplexId j = 1; j < 3; j++) {
-        SimplexId const vertexId = cellArray_->getCellVertex(cid, j);
+        SimplexId const vertexId = readCellVertex(cid, j);
         if(vertexId > vertexIntervals_[nodePtr->nid - 1]
            && vertexId <= vertexIntervals_[nodePtr->nid]) {
           offsets[vertexId - vertexIntervals_[nodePtr->nid - 1]]++;
@@ -1891,12 +1907,12 @@ int CompactTriangulation::getClusterVertexLinks(
     for(SimplexId cid = cellIntervals_[nodePtr->nid - 1] + 1;
         cid <= cellIntervals_[nodePtr->nid]; cid++) {
       std::array<SimplexId, 3> vertexIds
-        = {(SimplexId)cellArray_->getCellVertex(cid, 0),
-           (SimplexId)cellArray_->getCellVertex(cid, 1),
-           (SimplexId)cellArray_->getCellVertex(cid, 2)};
+        = {(SimplexId)readCellVertex(cid, 0),
+           (SimplexId)readCellVertex(cid, 1),
+           (SimplexId)readCellVertex(cid, 2)};
       // the first vertex of the cell must be in the cluster
       std::array<SimplexId, 2> edgePair = {vertexIds[1], vertexIds[2]};
-      SimplexId const nodeId = vertexIndices_[vertexIds[1]];
+      SimplexId const nodeId = readVertexNodeId(vertexIds[1]);
       if(nodeMaps.find(nodeId) == nodeMaps.end()) {
         nodeMaps[nodeId] = ImplicitCluster(nodeId);
         buildInternalEdgeMap(&nodeMaps[nodeId], false, true);
@@ -1927,11 +1943,11 @@ int CompactTriangulation::getClusterVertexLinks(
     }
     for(SimplexId const cid : externalCells_[nodePtr->nid]) {
       std::array<SimplexId, 3> vertexIds
-        = {(SimplexId)cellArray_->getCellVertex(cid, 0),
-           (SimplexId)cellArray_->getCellVertex(cid, 1),
-           (SimplexId)cellArray_->getCellVertex(cid, 2)};
+        = {(SimplexId)readCellVertex(cid, 0),
+           (SimplexId)readCellVertex(cid, 1),
+           (SimplexId)readCellVertex(cid, 2)};
       std::array<SimplexId, 2> edgePair = {vertexIds[0], vertexIds[2]};
-      SimplexId const nodeId = vertexIndices_[edgePair[0]];
+      SimplexId const nodeId = readVertexNodeId(edgePair[0]);
       if(nodeMaps.find(nodeId) == nodeMaps.end()) {
         nodeMaps[nodeId] = ImplicitCluster(nodeId);
         buildInternalEdgeMap(&nodeMaps[nodeId], false, true);
@@ -1970,19 +1986,19 @@ int CompactTriangulation::getClusterVertexLinks(
     // set the offsets vector
     for(SimplexId cid = cellIntervals_[nodePtr->nid - 1] + 1;
         cid <= cellIntervals_[nodePtr->nid]; cid++) {
-      offsets[cellArray_->getCellVertex(cid, 0)
+      offsets[readCellVertex(cid, 0)
               - vertexIntervals_[nodePtr->nid - 1]]++;
       for(SimplexId j = 1; j < 4; j++) {
-        if(cellArray_->getCellVertex(cid, j)
+        if(readCellVertex(cid, j)
            <= vertexIntervals_[nodePtr->nid]) {
-          offsets[cellArray_->getCellVertex(cid, j)
+          offsets[readCellVertex(cid, j)
                   - vertexIntervals_[nodePtr->nid - 1]]++;
         }
       }
     }
     for(SimplexId const cid : externalCells_[nodePtr->nid]) {
       for(SimplexId j = 1; j < 4; j++) {
-        SimplexId const vertexId = cellArray_->getCellVertex(cid, j);
+        SimplexId const vertexId = readCellVertex(cid, j);
         if(vertexId > vertexIntervals_[nodePtr->nid - 1]
            && vertexId <= vertexIntervals_[nodePtr->nid]) {
           offsets[vertexId - vertexIntervals_[nodePtr->nid - 1]]++;
@@ -2002,15 +2018,15 @@ int CompactTriangulation::getClusterVertexLinks(
     for(SimplexId cid = cellIntervals_[nodePtr->nid - 1] + 1;
         cid <= cellIntervals_[nodePtr->nid]; cid++) {
       std::array<SimplexId, 4> vertexIds
-        = {(SimplexId)cellArray_->getCellVertex(cid, 0),
-           (SimplexId)cellArray_->getCellVertex(cid, 1),
-           (SimplexId)cellArray_->getCellVertex(cid, 2),
-           (SimplexId)cellArray_->getCellVertex(cid, 3)};
+        = {(SimplexId)readCellVertex(cid, 0),
+           (SimplexId)readCellVertex(cid, 1),
+           (SimplexId)readCellVertex(cid, 2),
+           (SimplexId)readCellVertex(cid, 3)};
 
       // v1: (v2, v3, v4)
       std::array<SimplexId, 3> triangleVec
         = {vertexIds[1], vertexIds[2], vertexIds[3]};
-      SimplexId const nodeId = vertexIndices_[vertexIds[1]];
+      SimplexId const nodeId = readVertexNodeId(vertexIds[1]);
       if(nodeMaps.find(nodeId) == nodeMaps.end()) {
         nodeMaps[nodeId] = ImplicitCluster(nodeId);
         buildInternalTriangleMap(&nodeMaps[nodeId], false, true);
@@ -2053,14 +2069,14 @@ int CompactTriangulation::getClusterVertexLinks(
     // loop through the external cell list
     for(SimplexId const cid : externalCells_[nodePtr->nid]) {
       std::array<SimplexId, 4> vertexIds
-        = {(SimplexId)cellArray_->getCellVertex(cid, 0),
-           (SimplexId)cellArray_->getCellVertex(cid, 1),
-           (SimplexId)cellArray_->getCellVertex(cid, 2),
-           (SimplexId)cellArray_->getCellVertex(cid, 3)};
+        = {(SimplexId)readCellVertex(cid, 0),
+           (SimplexId)readCellVertex(cid, 1),
+           (SimplexId)readCellVertex(cid, 2),
+           (SimplexId)readCellVertex(cid, 3)};
       // start from v2
       std::array<SimplexId, 3> triangleVec
         = {vertexIds[0], vertexIds[2], vertexIds[3]};
-      SimplexId const nodeId = vertexIndices_[vertexIds[0]];
+      SimplexId const nodeId = readVertexNodeId(vertexIds[0]);
       if(nodeMaps.find(nodeId) == nodeMaps.end()) {
         nodeMaps[nodeId] = ImplicitCluster(nodeId);
         buildInternalTriangleMap(&nodeMaps[nodeId], false, true);
@@ -2111,7 +2127,7 @@ int CompactTriangulation::getClusterVertexNeighbors(
     return -1;
 #endif
 
-  SimplexId const verticesPerCell = cellArray_->getCellVertexNumber(0);
+  SimplexId const verticesPerCell = verticesPerCell_;
   SimplexId const localVertexNum
     = vertexIntervals_[nodePtr->nid] - vertexIntervals_[nodePtr->nid - 1];
   std::vector<SimplexId> vertexNeighborData, offsets(localVertexNum + 1, 0);
@@ -2124,10 +2140,10 @@ int CompactTriangulation::getClusterVertexNeighbors(
   for(SimplexId cid = cellIntervals_[nodePtr->nid - 1] + 1;
       cid <= cellIntervals_[nodePtr->nid]; cid++) {
     for(SimplexId j = 0; j < verticesPerCell - 1; j++) {
-      v1 = cellArray_->getCellVertex(cid, j);
+      v1 = readCellVertex(cid, j);
       if(v1 <= vertexIntervals_[nodePtr->nid]) {
         for(SimplexId k = j + 1; k < verticesPerCell; k++) {
-          v2 = cellArray_->getCellVertex(cid, k);
+          v2 = readCellVertex(cid, k);
           vertexNeighborSet[v1 - vertexIntervals_[nodePtr->nid - 1] - 1].insert(
             v2);
           if(v2 <= vertexIntervals_[nodePtr->nid]) {
@@ -2143,8 +2159,8 @@ int CompactTriangulation::getClusterVertexNeighbors(
   for(SimplexId const cid : externalCells_[nodePtr->nid]) {
     for(SimplexId j = 0; j < verticesPerCell - 1; j++) {
       for(SimplexId k = j + 1; k < verticesPerCell; k++) {
-        v1 = cellArray_->getCellVertex(cid, j);
-        v2 = cellArray_->getCellVertex(cid, k);
+        v1 = readCellVertex(cid, j);
+        v2 = readCellVertex(cid, k);
         if(v1 > vertexIntervals_[nodePtr->nid - 1]
            && v1 <= vertexIntervals_[nodePtr->nid])
           vertexNeighborSet[v1 - vertexIntervals_[nodePtr->nid - 1] - 1].insert(
@@ -2177,7 +2193,7 @@ int CompactTriangulation::getClusterVertexStars(
     return -1;
 #endif
 
-  SimplexId const verticesPerCell = cellArray_->getCellVertexNumber(0);
+  SimplexId const verticesPerCell = verticesPerCell_;
   SimplexId const localVertexNum
     = vertexIntervals_[nodePtr->nid] - vertexIntervals_[nodePtr->nid - 1];
   std::vector<SimplexId> offsets(localVertexNum + 1, 0),
@@ -2186,10 +2202,10 @@ int CompactTriangulation::getClusterVertexStars(
   // set the offsets vector
   for(SimplexId cid = cellIntervals_[nodePtr->nid - 1] + 1;
       cid <= cellIntervals_[nodePtr->nid]; cid++) {
-    SimplexId vertexId = cellArray_->getCellVertex(cid, 0);
+    SimplexId vertexId = readCellVertex(cid, 0);
     offsets[vertexId - vertexIntervals_[nodePtr->nid - 1]]++;
     for(SimplexId j = 1; j < verticesPerCell; j++) {
-      vertexId = cellArray_->getCellVertex(cid, j);
+      vertexId = readCellVertex(cid, j);
       if(vertexId > vertexIntervals_[nodePtr->nid - 1]
          && vertexId <= vertexIntervals_[nodePtr->nid]) {
         offsets[vertexId - vertexIntervals_[nodePtr->nid - 1]]++;
@@ -2198,7 +2214,7 @@ int CompactTriangulation::getClusterVertexStars(
   }
   for(SimplexId const cid : externalCells_[nodePtr->nid]) {
     for(SimplexId j = 1; j < verticesPerCell; j++) {
-      SimplexId const vertexId = cellArray_->getCellVertex(cid, j);
+      SimplexId const vertexId = readCellVertex(cid, j);
       if(vertexId > vertexIntervals_[nodePtr->nid - 1]
          && vertexId <= vertexIntervals_[nodePtr->nid]) {
         offsets[vertexId - vertexIntervals_[nodePtr->nid - 1]]++;
@@ -2217,12 +2233,12 @@ int CompactTriangulation::getClusterVertexStars(
   // fill the flat vector using offsets and count vectors
   for(SimplexId cid = cellIntervals_[nodePtr->nid - 1] + 1;
       cid <= cellIntervals_[nodePtr->nid]; cid++) {
-    SimplexId localVertexId = cellArray_->getCellVertex(cid, 0)
+    SimplexId localVertexId = readCellVertex(cid, 0)
                               - vertexIntervals_[nodePtr->nid - 1] - 1;
     vertexStarData[offsets[localVertexId] + starsCount[localVertexId]] = cid;
     starsCount[localVertexId]++;
     for(SimplexId j = 1; j < verticesPerCell; j++) {
-      SimplexId const vertexId = cellArray_->getCellVertex(cid, j);
+      SimplexId const vertexId = readCellVertex(cid, j);
       // see if it is in the current node
       if(vertexId > vertexIntervals_[nodePtr->nid - 1]
          && vertexId <= vertexIntervals_[nodePtr->nid]) {
@@ -2236,7 +2252,7 @@ int CompactTriangulation::getClusterVertexStars(
   for(SimplexId const cid : externalCells_[nodePtr->nid]) {
     for(SimplexId j = 0; j < verticesPerCell; j++) {
       // see if it is in the current node
-      SimplexId const vertexId = cellArray_->getCellVertex(cid, j);
+      SimplexId const vertexId = readCellVertex(cid, j);
       if(vertexId > vertexIntervals_[nodePtr->nid - 1]
          && vertexId <= vertexIntervals_[nodePtr->nid]) {
         SimplexId const localVertexId
@@ -2387,7 +2403,7 @@ int CompactTriangulation::getBoundaryCells(ImplicitCluster *const nodePtr,
       boost::unordered_map<SimplexId, ImplicitCluster> nodeMaps;
       for(auto iter = nodePtr->externalEdgeMap_.begin();
           iter != nodePtr->externalEdgeMap_.end(); iter++) {
-        SimplexId const nodeId = vertexIndices_[iter->first[0]];
+        SimplexId const nodeId = readVertexNodeId(iter->first[0]);
         if(nodeMaps.find(nodeId) == nodeMaps.end()) {
           nodeMaps[nodeId] = ImplicitCluster(nodeId);
           getBoundaryCells(&nodeMaps[nodeId]);
@@ -2447,7 +2463,7 @@ int CompactTriangulation::getBoundaryCells(ImplicitCluster *const nodePtr,
       boost::unordered_map<SimplexId, ImplicitCluster> nodeMaps;
       for(auto iter = nodePtr->externalTriangleMap_.begin();
           iter != nodePtr->externalTriangleMap_.end(); iter++) {
-        SimplexId const nodeId = vertexIndices_[iter->first[0]];
+        SimplexId const nodeId = readVertexNodeId(iter->first[0]);
         if(nodeMaps.find(nodeId) == nodeMaps.end()) {
           nodeMaps[nodeId] = ImplicitCluster(nodeId);
           getBoundaryCells(&nodeMaps[nodeId]);
@@ -2494,7 +2510,7 @@ int CompactTriangulation::getBoundaryCells(ImplicitCluster *const nodePtr,
       boost::unordered_map<SimplexId, ImplicitCluster> nodeMaps;
       for(auto iter = nodePtr->externalTriangleMap_.begin();
           iter != nodePtr->externalTriangleMap_.end(); iter++) {
-        SimplexId const nodeId = vertexIndices_[iter->first[0]];
+        SimplexId const nodeId = readVertexNodeId(iter->first[0]);
         if(nodeMaps.find(nodeId) == nodeMaps.end()) {
           nodeMaps[nodeId] = ImplicitCluster(nodeId);
           ;
@@ -2526,3 +2542,288 @@ int CompactTriangulation::getBoundaryCells(ImplicitCluster *const nodePtr,
 
   return 0;
 }
+
+// initialize static member variables
+const char *CompactTriangulation::clusterFileMagicBytes_
+  = "TTKCompactTriangulationClusterFile";
+const unsigned long CompactTriangulation::clusterFileFormatVersion_ = 1;
+
+namespace {
+  template <typename T>
+  void writeBin(std::ofstream &stream, const T var) {
+    stream.write(reinterpret_cast<const char *>(&var), sizeof(var));
+  }
+
+  template <typename T>
+  void writeBinArray(std::ofstream &stream,
+                     const T *const buff,
+                     const size_t size) {
+    stream.write(reinterpret_cast<const char *>(buff), size * sizeof(T));
+  }
+
+  template <typename T>
+  void readBin(std::ifstream &stream, T &res) {
+    stream.read(reinterpret_cast<char *>(&res), sizeof(res));
+  }
+
+  template <typename T>
+  void readBinArray(std::ifstream &stream, T *const res, const size_t size) {
+    stream.read(reinterpret_cast<char *>(res), size * sizeof(T));
+  }
+} // namespace
+
+int CompactTriangulation::writeToFile(const std::string &fileName) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(vertexNumber_ <= 0 || cellNumber_ <= 0 || nodeNumber_ <= 0) {
+    this->printErr("Empty triangulation, no cluster file written");
+    return -1;
+  }
+#endif
+
+  std::ofstream stream(fileName, std::ios::out | std::ios::binary);
+  if(!stream.is_open()) {
+    this->printErr("Could not open `" + fileName + "' for writing");
+    return -2;
+  }
+
+  Timer tm{};
+
+  // 1. magic bytes (char *)
+  stream.write(clusterFileMagicBytes_, std::strlen(clusterFileMagicBytes_));
+  // 2. format version (unsigned long)
+  writeBin(stream, clusterFileFormatVersion_);
+  // 3. size of the identifiers (int)
+  writeBin(stream, static_cast<int>(sizeof(SimplexId)));
+  // 4. size of the coordinates (int)
+  const size_t pointSize = doublePrecision_ ? sizeof(double) : sizeof(float);
+  writeBin(stream, static_cast<int>(pointSize));
+  // 5. number of vertices, cells and clusters (SimplexId)
+  writeBin(stream, vertexNumber_);
+  writeBin(stream, cellNumber_);
+  writeBin(stream, nodeNumber_);
+  // 6. number of vertices per cell (SimplexId)
+  writeBin(stream, verticesPerCell_);
+  // 7. vertex intervals (SimplexId, nodeNumber_ + 1)
+  writeBinArray(stream, vertexIntervals_.data(), vertexIntervals_.size());
+  // 8. cell intervals (SimplexId, nodeNumber_ + 1)
+  writeBinArray(stream, cellIntervals_.data(), cellIntervals_.size());
+  // 9. external cells of each cluster (SimplexId size, then SimplexId cells)
+  for(SimplexId nid = 0; nid <= nodeNumber_; nid++) {
+    const auto &cells = externalCells_[nid];
+    writeBin(stream, static_cast<SimplexId>(cells.size()));
+    writeBinArray(stream, cells.data(), cells.size());
+  }
+  // 10. cluster payloads, in cluster order: coordinates of the cluster
+  // vertices (float or double), then vertices of the cluster cells
+  // (SimplexId)
+  for(SimplexId nid = 1; nid <= nodeNumber_; nid++) {
+    if(isOutOfCore()) {
+      const auto payload = getClusterPayload(nid);
+      if(payload == nullptr) {
+        return -2;
+      }
+      writeBinArray(stream, payload->points_.data(), payload->points_.size());
+      writeBinArray(stream, payload->cells_.data(), payload->cells_.size());
+      continue;
+    }
+    const SimplexId firstVertex = vertexIntervals_[nid - 1] + 1;
+    const SimplexId nVerts = vertexIntervals_[nid] - firstVertex + 1;
+    writeBinArray(stream,
+                  static_cast<const char *>(pointSet_)
+                    + 3 * pointSize * firstVertex,
+                  3 * pointSize * nVerts);
+    for(SimplexId cid = cellIntervals_[nid - 1] + 1;
+        cid <= cellIntervals_[nid]; cid++) {
+      for(SimplexId j = 0; j < verticesPerCell_; j++) {
+        writeBin(stream, readCellVertex(cid, j));
+      }
+    }
+  }
+
+  if(!stream) {
+    this->printErr("Could not write `" + fileName + "'");
+    return -3;
+  }
+
+  this->printMsg("Wrote " + std::to_string(nodeNumber_) + " clusters to `"
+                   + fileName + "'",
+                 1.0, tm.getElapsedTime(), 1);
+
+  return 0;
+}
+
+int CompactTriangulation::setInputFile(const std::string &fileName) {
+
+  std::ifstream stream(fileName, std::ios::in | std::ios::binary);
+  if(!stream.is_open()) {
+    this->printErr("Could not open `" + fileName + "' for reading");
+    return -1;
+  }
+
+  Timer tm{};
+
+  // 1. magic bytes (char *)
+  const auto magicBytesLength = std::strlen(clusterFileMagicBytes_);
+  std::vector<char> magicBytes(magicBytesLength);
+  stream.read(magicBytes.data(), magicBytesLength);
+  if(!stream
+     || std::strncmp(
+          magicBytes.data(), clusterFileMagicBytes_, magicBytesLength)
+          != 0) {
+    this->printErr("`" + fileName + "' is not a cluster file");
+    return -2;
+  }
+  // 2. format version (unsigned long)
+  unsigned long version{};
+  readBin(stream, version);
+  if(version != clusterFileFormatVersion_) {
+    this->printErr("Unsupported file format version ("
+                   + std::to_string(version) + ")!");
+    return -3;
+  }
+  // 3. size of the identifiers (int)
+  int idSize{};
+  readBin(stream, idSize);
+  if(idSize != sizeof(SimplexId)) {
+    this->printErr("Incompatible identifier size ("
+                   + std::to_string(idSize) + " bytes)!");
+    return -3;
+  }
+  // 4. size of the coordinates (int)
+  int pointSize{};
+  readBin(stream, pointSize);
+  if(pointSize != sizeof(float) && pointSize != sizeof(double)) {
+    this->printErr("Incorrect coordinate size ("
+                   + std::to_string(pointSize) + " bytes)!");
+    return -3;
+  }
+
+  clear();
+  pointSet_ = nullptr;
+  vertexIndices_ = nullptr;
+  cellArray_.reset();
+  doublePrecision_ = (pointSize == sizeof(double));
+
+  // 5. number of vertices, cells and clusters (SimplexId)
+  readBin(stream, vertexNumber_);
+  readBin(stream, cellNumber_);
+  readBin(stream, nodeNumber_);
+  // 6. number of vertices per cell (SimplexId)
+  readBin(stream, verticesPerCell_);
+  if(!stream || vertexNumber_ <= 0 || cellNumber_ <= 0 || nodeNumber_ <= 0
+     || verticesPerCell_ < 3 || verticesPerCell_ > 4) {
+    this->printErr("Incorrect cluster file header!");
+    vertexNumber_ = cellNumber_ = nodeNumber_ = 0;
+    return -4;
+  }
+  // 7. vertex intervals (SimplexId, nodeNumber_ + 1)
+  vertexIntervals_.resize(nodeNumber_ + 1);
+  readBinArray(stream, vertexIntervals_.data(), vertexIntervals_.size());
+  // 8. cell intervals (SimplexId, nodeNumber_ + 1)
+  cellIntervals_.resize(nodeNumber_ + 1);
+  readBinArray(stream, cellIntervals_.data(), cellIntervals_.size());
+  // 9. external cells of each cluster (SimplexId size, then SimplexId cells)
+  externalCells_.resize(nodeNumber_ + 1);
+  for(auto &cells : externalCells_) {
+    SimplexId size{};
+    readBin(stream, size);
+    if(!stream || size < 0 || size > cellNumber_) {
+      break;
+    }
+    cells.resize(size);
+    readBinArray(stream, cells.data(), cells.size());
+  }
+  if(!stream) {
+    this->printErr("Truncated cluster file!");
+    clear();
+    vertexNumber_ = cellNumber_ = nodeNumber_ = 0;
+    return -5;
+  }
+  // 10. cluster payloads, read on demand
+  payloadOffset_ = stream.tellg();
+
+  maxCellDim_ = verticesPerCell_ - 1;
+  if(maxCellDim_ == 2) {
+    triangleIntervals_ = cellIntervals_;
+  }
+  clusterFileName_ = fileName;
+  // never 0, distinct for every file loaded by any triangulation
+  static std::atomic<size_t> payloadSerialCounter{0};
+  payloadSerial_ = ++payloadSerialCounter;
+
+  this->printMsg("Read " + std::to_string(nodeNumber_) + " cluster intervals"
+                   + " from `" + fileName + "'",
+                 1.0, tm.getElapsedTime(), 1);
+
+  return 0;
+}
+
+std::shared_ptr<ClusterPayload>
+  CompactTriangulation::getClusterPayload(const SimplexId nodeId) const {
+
+  auto payload = payloadCache_.get(nodeId);
+  if(payload == nullptr) {
+    payload = std::make_shared<ClusterPayload>();
+    if(readClusterPayload(nodeId, *payload) != 0) {
+      // do not cache a partially read payload
+      return nullptr;
+    }
+    // returns the payload of a concurrent thread if it was faster
+    payload = payloadCache_.insert(
+      nodeId, payload,
+      payload->points_.size()
+        + payload->cells_.size() * sizeof(SimplexId));
+  }
+  return payload;
+}
+
+int CompactTriangulation::readClusterPayload(const SimplexId nodeId,
+                                             ClusterPayload &payload) const {
+
+  const size_t pointSize = doublePrecision_ ? sizeof(double) : sizeof(float);
+  const SimplexId firstVertex = vertexIntervals_[nodeId - 1] + 1;
+  const SimplexId firstCell = cellIntervals_[nodeId - 1] + 1;
+  payload.points_.resize(3 * pointSize
+                         * (vertexIntervals_[nodeId] - firstVertex + 1));
+  payload.cells_.resize(verticesPerCell_
+                        * (cellIntervals_[nodeId] - firstCell + 1));
+
+  // borrow an idle stream from the pool, whatever the calling thread
+  std::unique_ptr<std::ifstream> streamPtr{};
+  {
+    std::lock_guard<std::mutex> lock{clusterFilesMutex_};
+    if(!clusterFiles_.empty()) {
+      streamPtr = std::move(clusterFiles_.back());
+      clusterFiles_.pop_back();
+    }
+  }
+  if(streamPtr == nullptr) {
+    streamPtr = std::make_unique<std::ifstream>(
+      clusterFileName_, std::ios::in | std::ios::binary);
+  }
+  auto &stream = *streamPtr;
+
+  // the payloads of the previous clusters are stored before
+  const std::streamoff offset
+    = payloadOffset_
+      + static_cast<std::streamoff>(3 * pointSize) * firstVertex
+      + static_cast<std::streamoff>(verticesPerCell_ * sizeof(SimplexId))
+          * firstCell;
+  stream.clear();
+  stream.seekg(offset);
+  readBinArray(stream, payload.points_.data(), payload.points_.size());
+  readBinArray(stream, payload.cells_.data(), payload.cells_.size());
+
+  if(!stream) {
+    this->printErr("Could not read cluster " + std::to_string(nodeId)
+                   + " from `" + clusterFileName_ + "'");
+    // drop the stream, the next read opens a fresh one
+    return -1;
+  }
+
+  std::lock_guard<std::mutex> lock{clusterFilesMutex_};
+  clusterFiles_.emplace_back(std::move(streamPtr));
+
+  return 0;
+}
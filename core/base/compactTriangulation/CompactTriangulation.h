@@ -13,6 +13,9 @@
 /// field named "ttkCompactTriangulationIndex" to denote the cluster index of
 /// each vertex. Note Topocluster will reindex the simplices based on the
 /// clustering input array.
+/// The vertex coordinates and the cells of each cluster can also be paged
+/// on demand from a cluster file (see setInputFile()) to process meshes
+/// that do not fit in memory.
 /// \b Related \b publications \n
 /// "TopoCluster: A Localized Data Structure for Topology-based Visualization"
 /// Guoxi Liu, Federico Iuricich, Riccardo Fellegara, and Leila De Floriani
@@ -30,13 +33,18 @@
 
 // base code includes
 #include <AbstractTriangulation.h>
+#include <Cache.h>
 #include <CellArray.h>
 #include <FlatJaggedArray.h>
 #include <algorithm>
 #include <boost/functional/hash.hpp>
 #include <boost/unordered_map.hpp>
 #include <boost/unordered_set.hpp>
+#include <fstream>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <string>
 
 namespace ttk {
 
@@ -86,6 +94,17 @@ namespace ttk {
     friend class CompactTriangulation;
   };
 
+  /**
+   * Vertex coordinates and cell connectivity of a cluster, paged in from
+   * the cluster file in out-of-core mode.
+   */
+  struct ClusterPayload {
+    // coordinates of the cluster vertices, in the file precision
+    std::vector<char> points_{};
+    // vertices of the cells stored in the cluster
+    std::vector<SimplexId> cells_{};
+  };
+
   class CompactTriangulation final : public AbstractTriangulation {
 
     // different id types for compact triangulation
@@ -107,7 +126,7 @@ namespace ttk {
                               const int *indexArray,
                               const bool &doublePrecision = false) {
 
-      if(vertexNumber_)
+      if(vertexNumber_ || isOutOfCore())
         clear();
 
       vertexNumber_ = pointNumber;
@@ -171,10 +190,11 @@ namespace ttk {
       reorderCells(vertexMap, cellNumber, connectivity, offset);
       cellArray_
         = std::make_shared<CellArray>(connectivity, offset, cellNumber);
+      verticesPerCell_ = cellNumber > 0 ? offset[1] - offset[0] : 0;
 
       // ASSUME Regular Mesh Here to compute dimension!
       if(cellNumber) {
-        if(cellArray_->getCellVertexNumber(0) == 3) {
+        if(verticesPerCell_ == 3) {
           maxCellDim_ = 2;
           triangleIntervals_ = cellIntervals_;
         } else {
@@ -201,12 +221,38 @@ namespace ttk {
         reorderCells(vertexMap, cellArray);
         cellArray_ = std::make_shared<CellArray>(
           cellArray, cellNumber, cellArray[0] - 1);
+        verticesPerCell_ = cellArray[0];
       }
 
       return 0;
     }
 #endif
 
+    /**
+     * Set up the triangulation from a cluster file written by
+     * writeToFile() (out-of-core mode).
+     *
+     * Only the cluster intervals and the external cells of each cluster
+     * are loaded. The vertex coordinates and the cells of a cluster are
+     * read from the file when the cluster is accessed and evicted in LRU
+     * order, the payload cache being sized as the cluster cache (see
+     * initCache()).
+     */
+    int setInputFile(const std::string &fileName);
+
+    /**
+     * Write the clustered triangulation to a file that can be read back
+     * with setInputFile().
+     */
+    int writeToFile(const std::string &fileName) const;
+
+    /**
+     * Return true if the cluster payloads are paged from a file.
+     */
+    inline bool isOutOfCore() const {
+      return !clusterFileName_.empty();
+    }
+
     /**
      * Reorder the input vertices.
      */
@@ -242,7 +288,7 @@ namespace ttk {
 #endif
 
       const SimplexId nid
-        = vertexIndices_[cellArray_->getCellVertex(cellId, 0)];
+        = readVertexNodeId(readCellVertex(cellId, 0));
       const SimplexId localCellId = cellId - cellIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       if(exnode->tetraEdges_.empty()) {
@@ -304,7 +350,7 @@ namespace ttk {
 #endif
 
       const SimplexId nid
-        = vertexIndices_[cellArray_->getCellVertex(cellId, 0)];
+        = readVertexNodeId(readCellVertex(cellId, 0));
       const SimplexId localCellId = cellId - cellIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       if(exnode->cellNeighbors_.empty()) {
@@ -328,7 +374,7 @@ namespace ttk {
 #endif
 
       const SimplexId nid
-        = vertexIndices_[cellArray_->getCellVertex(cellId, 0)];
+        = readVertexNodeId(readCellVertex(cellId, 0));
       const SimplexId localCellId = cellId - cellIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       if(exnode->cellNeighbors_.empty()) {
@@ -371,7 +417,7 @@ namespace ttk {
 #endif
 
       const SimplexId nid
-        = vertexIndices_[cellArray_->getCellVertex(cellId, 0)];
+        = readVertexNodeId(readCellVertex(cellId, 0));
       const SimplexId localCellId = cellId - cellIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       if(exnode->tetraTriangles_.empty()) {
@@ -422,14 +468,13 @@ namespace ttk {
         vertexId = -1;
         return 0;
       }
-      if((localVertexId < 0)
-         || (localVertexId >= cellArray_->getCellVertexNumber(cellId))) {
+      if((localVertexId < 0) || (localVertexId >= verticesPerCell_)) {
         vertexId = -2;
         return 0;
       }
 #endif
 
-      vertexId = cellArray_->getCellVertex(cellId, localVertexId);
+      vertexId = readCellVertex(cellId, localVertexId);
       return 0;
     }
 
@@ -439,9 +484,11 @@ namespace ttk {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((cellId < 0) || (cellId >= cellNumber_))
         return -1;
+#else
+      TTK_FORCE_USE(cellId);
 #endif
 
-      return cellArray_->getCellVertexNumber(cellId);
+      return verticesPerCell_;
     }
 
     int TTK_TRIANGULATION_INTERNAL(getDimensionality)() const override {
@@ -718,9 +765,9 @@ namespace ttk {
       if(getDimensionality() == 2) {
         triangleList_.resize(cellNumber_, std::array<SimplexId, 3>());
         for(SimplexId cid = 0; cid < cellNumber_; cid++) {
-          triangleList_[cid][0] = cellArray_->getCellVertex(cid, 0);
-          triangleList_[cid][1] = cellArray_->getCellVertex(cid, 1);
-          triangleList_[cid][2] = cellArray_->getCellVertex(cid, 2);
+          triangleList_[cid][0] = readCellVertex(cid, 0);
+          triangleList_[cid][1] = readCellVertex(cid, 1);
+          triangleList_[cid][2] = readCellVertex(cid, 2);
         }
       } else {
         triangleList_.reserve(triangleIntervals_.back() + 1);
@@ -970,7 +1017,7 @@ namespace ttk {
       }
 #endif
 
-      const SimplexId nid = vertexIndices_[vertexId];
+      const SimplexId nid = readVertexNodeId(vertexId);
       const SimplexId localVertexId = vertexId - vertexIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       if(exnode->vertexEdges_.empty()) {
@@ -992,7 +1039,7 @@ namespace ttk {
         return -1;
 #endif
 
-      const SimplexId nid = vertexIndices_[vertexId];
+      const SimplexId nid = readVertexNodeId(vertexId);
       const SimplexId localVertexId = vertexId - vertexIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       if(exnode->vertexEdges_.empty()) {
@@ -1034,7 +1081,7 @@ namespace ttk {
       }
 #endif
 
-      const SimplexId nid = vertexIndices_[vertexId];
+      const SimplexId nid = readVertexNodeId(vertexId);
       const SimplexId localVertexId = vertexId - vertexIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       if(exnode->vertexLinks_.empty()) {
@@ -1056,7 +1103,7 @@ namespace ttk {
         return -1;
 #endif
 
-      const SimplexId nid = vertexIndices_[vertexId];
+      const SimplexId nid = readVertexNodeId(vertexId);
       const SimplexId localVertexId = vertexId - vertexIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       if(exnode->vertexLinks_.empty()) {
@@ -1096,7 +1143,7 @@ namespace ttk {
       }
 #endif
 
-      const SimplexId nid = vertexIndices_[vertexId];
+      const SimplexId nid = readVertexNodeId(vertexId);
       const SimplexId localVertexId = vertexId - vertexIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       if(exnode == nullptr) {
@@ -1122,7 +1169,7 @@ namespace ttk {
         return -1;
 #endif
 
-      const SimplexId nid = vertexIndices_[vertexId];
+      const SimplexId nid = readVertexNodeId(vertexId);
       const SimplexId localVertexId = vertexId - vertexIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       if(exnode->vertexNeighbors_.empty()) {
@@ -1156,14 +1203,26 @@ namespace ttk {
         return -1;
 #endif
 
+      const void *pointSet = pointSet_;
+      SimplexId localVertexId = vertexId;
+      std::shared_ptr<ClusterPayload> payload{};
+      if(isOutOfCore()) {
+        const SimplexId nid = readVertexNodeId(vertexId);
+        payload = getClusterPayload(nid);
+        if(payload == nullptr)
+          return -1;
+        pointSet = payload->points_.data();
+        localVertexId = vertexId - vertexIntervals_[nid - 1] - 1;
+      }
+
       if(doublePrecision_) {
-        x = ((const double *)pointSet_)[3 * vertexId];
-        y = ((const double *)pointSet_)[3 * vertexId + 1];
-        z = ((const double *)pointSet_)[3 * vertexId + 2];
+        x = ((const double *)pointSet)[3 * localVertexId];
+        y = ((const double *)pointSet)[3 * localVertexId + 1];
+        z = ((const double *)pointSet)[3 * localVertexId + 2];
       } else {
-        x = ((const float *)pointSet_)[3 * vertexId];
-        y = ((const float *)pointSet_)[3 * vertexId + 1];
-        z = ((const float *)pointSet_)[3 * vertexId + 2];
+        x = ((const float *)pointSet)[3 * localVertexId];
+        y = ((const float *)pointSet)[3 * localVertexId + 1];
+        z = ((const float *)pointSet)[3 * localVertexId + 2];
       }
 
       return 0;
@@ -1185,7 +1244,7 @@ namespace ttk {
       }
 #endif
 
-      const SimplexId nid = vertexIndices_[vertexId];
+      const SimplexId nid = readVertexNodeId(vertexId);
       const SimplexId localVertexId = vertexId - vertexIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       if(exnode->vertexStars_.empty()) {
@@ -1207,7 +1266,7 @@ namespace ttk {
         return -1;
 #endif
 
-      const SimplexId nid = vertexIndices_[vertexId];
+      const SimplexId nid = readVertexNodeId(vertexId);
       const SimplexId localVertexId = vertexId - vertexIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       if(exnode->vertexStars_.empty()) {
@@ -1247,7 +1306,7 @@ namespace ttk {
       }
 #endif
 
-      const SimplexId nid = vertexIndices_[vertexId];
+      const SimplexId nid = readVertexNodeId(vertexId);
       const SimplexId localVertexId = vertexId - vertexIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       if(exnode->vertexTriangles_.empty()) {
@@ -1270,7 +1329,7 @@ namespace ttk {
         return -1;
 #endif
 
-      const SimplexId nid = vertexIndices_[vertexId];
+      const SimplexId nid = readVertexNodeId(vertexId);
       const SimplexId localVertexId = vertexId - vertexIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       if(exnode->vertexTriangles_.empty()) {
@@ -1336,7 +1395,7 @@ namespace ttk {
       if((vertexId < 0) || (vertexId >= vertexNumber_))
         return false;
 #endif
-      const SimplexId nid = vertexIndices_[vertexId];
+      const SimplexId nid = readVertexNodeId(vertexId);
       const SimplexId localVertexId = vertexId - vertexIntervals_[nid - 1] - 1;
       ImplicitCluster *exnode = searchCache(nid);
       getBoundaryCells(exnode, 0);
@@ -1379,7 +1438,7 @@ namespace ttk {
         return -1;
       if(cellNumber_ <= 0)
         return -2;
-      if(!cellArray_)
+      if(!cellArray_ && !isOutOfCore())
         return -3;
       if(nodeNumber_ <= 0)
         return -4;
@@ -1427,7 +1486,7 @@ namespace ttk {
         return -1;
       if(cellNumber_ <= 0)
         return -2;
-      if(!cellArray_)
+      if(!cellArray_ && !isOutOfCore())
         return -3;
       if(nodeNumber_ <= 0)
         return -4;
@@ -1493,7 +1552,7 @@ namespace ttk {
     inline int preconditionVertexStarsInternal() override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if(!cellArray_)
+      if(!cellArray_ && !isOutOfCore())
         return -1;
 #endif
 
@@ -1515,6 +1574,9 @@ namespace ttk {
         caches_[i].clear();
         cacheMaps_[i].clear();
       }
+      // one payload per cached cluster, for all threads
+      payloadCache_.clear();
+      payloadCache_.setCapacity(cacheSize_ * threadNumber_);
       this->printMsg("Initializing cache: " + std::to_string(cacheSize_));
     }
 
@@ -1555,9 +1617,72 @@ namespace ttk {
       externalCells_.clear();
       cacheMaps_.clear();
       cacheMaps_.clear();
+      clusterFileName_.clear();
+      clusterFiles_.clear();
+      payloadCache_.clear();
+      payloadSerial_ = 0;
       return AbstractTriangulation::clear();
     }
 
+    /**
+     * Get the cluster of a vertex.
+     */
+    inline SimplexId readVertexNodeId(const SimplexId vertexId) const {
+      if(vertexIndices_ != nullptr) {
+        return vertexIndices_[vertexId];
+      }
+      return std::lower_bound(
+               vertexIntervals_.begin(), vertexIntervals_.end(), vertexId)
+             - vertexIntervals_.begin();
+    }
+
+    /**
+     * Get the i-th vertex of a cell, from the input cell array or from
+     * the cluster file.
+     */
+    inline SimplexId readCellVertex(const SimplexId cellId,
+                                    const SimplexId localVertexId) const {
+      if(cellArray_) {
+        return cellArray_->getCellVertex(cellId, localVertexId);
+      }
+      const SimplexId nid
+        = std::lower_bound(
+            cellIntervals_.begin(), cellIntervals_.end(), cellId)
+          - cellIntervals_.begin();
+      // consecutive reads mostly hit the same cluster: remember the last
+      // payload of the calling thread to skip the (locked) payload cache
+      // lookup. The memo is keyed on the triangulation serial number and
+      // holds a reference on the payload, so it stays valid after an
+      // eviction and is never reused by another triangulation.
+      thread_local PayloadMemo memo{};
+      if(memo.serial != payloadSerial_ || memo.nodeId != nid) {
+        memo.payload = getClusterPayload(nid);
+        if(memo.payload == nullptr) {
+          memo = {};
+          return -1;
+        }
+        memo.serial = payloadSerial_;
+        memo.nodeId = nid;
+      }
+      const SimplexId localCellId = cellId - cellIntervals_[nid - 1] - 1;
+      return memo.payload
+        ->cells_[localCellId * verticesPerCell_ + localVertexId];
+    }
+
+    /**
+     * Get the payload of a cluster from the payload cache, read it from
+     * the cluster file on a cache miss. Return nullptr if the cluster
+     * could not be read (nothing is cached then).
+     */
+    std::shared_ptr<ClusterPayload>
+      getClusterPayload(const SimplexId nodeId) const;
+
+    /**
+     * Read the payload of a cluster from the cluster file.
+     */
+    int readClusterPayload(const SimplexId nodeId,
+                           ClusterPayload &payload) const;
+
     /**
      * Find the corresponding node index given the id.
      */
@@ -1728,6 +1853,27 @@ namespace ttk {
     std::vector<SimplexId> cellIntervals_;
     std::shared_ptr<CellArray> cellArray_;
     std::vector<std::vector<SimplexId>> externalCells_;
+    SimplexId verticesPerCell_{};
+
+    // Out-of-core mode
+    static const char *clusterFileMagicBytes_;
+    static const unsigned long clusterFileFormatVersion_;
+    std::string clusterFileName_{};
+    // offset of the first cluster payload in the cluster file
+    std::streamoff payloadOffset_{};
+    // pool of idle input streams on the cluster file, shared by the
+    // threads reading a payload (a stream is opened when the pool is empty)
+    mutable std::mutex clusterFilesMutex_{};
+    mutable std::vector<std::unique_ptr<std::ifstream>> clusterFiles_{};
+    mutable LRUCache<SimplexId, ClusterPayload> payloadCache_{};
+    // identifies the content of payloadCache_ (0 when not out-of-core)
+    size_t payloadSerial_{};
+    // last payload read by a thread in readCellVertex()
+    struct PayloadMemo {
+      size_t serial{};
+      SimplexId nodeId{};
+      std::shared_ptr<const ClusterPayload> payload{};
+    };
 
     // Cache system
     size_t cacheSize_;
@@ -112,6 +112,75 @@ namespace ttk {
       return 1; // return success
     }
 
+    /**
+     * Write the clusters computed by execute() to a file, so that
+     * ttk::CompactTriangulation can page them from disk (see
+     * ttk::CompactTriangulation::setInputFile()).
+     */
+    template <class triangulationType = ttk::AbstractTriangulation>
+    int writeClusterFile(const std::string &fileName,
+                         const triangulationType *triangulation) const {
+
+      const SimplexId vertexNumber = this->vertices.size();
+      const SimplexId cellNumber = this->cells.size();
+
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!triangulation)
+        return -1;
+      if(vertexNumber == 0 || cellNumber == 0) {
+        this->printErr("No clusters, call execute() first");
+        return -2;
+      }
+#endif
+
+      // reorder the vertices and the cells as in the TTK filter output
+      std::vector<float> points(3 * vertexNumber);
+      std::vector<int> indices(vertexNumber);
+      std::vector<SimplexId> vertexMap(vertexNumber);
+      for(SimplexId i = 0; i < vertexNumber; i++) {
+        triangulation->getVertexPoint(this->vertices[i], points[3 * i],
+                                      points[3 * i + 1], points[3 * i + 2]);
+        vertexMap[this->vertices[i]] = i;
+        indices[i] = this->nodes[i];
+      }
+
+      const SimplexId verticesPerCell = triangulation->getCellVertexNumber(0);
+      CompactTriangulation compactTriangulation{};
+      compactTriangulation.setDebugLevel(this->debugLevel_);
+      compactTriangulation.setThreadNumber(this->threadNumber_);
+      compactTriangulation.setInputPoints(
+        vertexNumber, points.data(), indices.data());
+
+#ifdef TTK_CELL_ARRAY_NEW
+      std::vector<LongSimplexId> connectivity(verticesPerCell * cellNumber);
+      std::vector<LongSimplexId> offsets(cellNumber + 1);
+      for(SimplexId i = 0; i < cellNumber; i++) {
+        offsets[i] = verticesPerCell * i;
+        for(SimplexId j = 0; j < verticesPerCell; j++) {
+          SimplexId vertexId{};
+          triangulation->getCellVertex(this->cells[i], j, vertexId);
+          connectivity[offsets[i] + j] = vertexMap[vertexId];
+        }
+      }
+      offsets[cellNumber] = verticesPerCell * cellNumber;
+      compactTriangulation.setInputCells(
+        cellNumber, connectivity.data(), offsets.data());
+#else
+      std::vector<LongSimplexId> cellArray((verticesPerCell + 1) * cellNumber);
+      for(SimplexId i = 0; i < cellNumber; i++) {
+        cellArray[(verticesPerCell + 1) * i] = verticesPerCell;
+        for(SimplexId j = 0; j < verticesPerCell; j++) {
+          SimplexId vertexId{};
+          triangulation->getCellVertex(this->cells[i], j, vertexId);
+          cellArray[(verticesPerCell + 1) * i + j + 1] = vertexMap[vertexId];
+        }
+      }
+      compactTriangulation.setInputCells(cellNumber, cellArray.data());
+#endif // TTK_CELL_ARRAY_NEW
+
+      return compactTriangulation.writeToFile(fileName);
+    }
+
     void clear() {
       this->vertices.clear();
       this->nodes.clear();
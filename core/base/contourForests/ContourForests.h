@@ -234,8 +234,8 @@ namespace ttk {
 
       template <typename scalarType, typename triangulationType>
       int
-        parallelBuild(std::vector<std::vector<ExtendedUnionFind *>> &baseUF_JT,
-                      std::vector<std::vector<ExtendedUnionFind *>> &baseUF_ST,
+        parallelBuild(std::vector<std::vector<SimplexId>> &baseUF_JT,
+                      std::vector<std::vector<SimplexId>> &baseUF_ST,
                       const triangulationType &mesh);
 
       void stitch();
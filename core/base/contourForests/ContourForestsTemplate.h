@@ -87,7 +87,7 @@ namespace ttk {
 
       DebugTimer timerAllocPara;
       // Union find std::vector for each partition
-      std::vector<std::vector<ExtendedUnionFind *>> vect_baseUF_JT(
+      std::vector<std::vector<SimplexId>> vect_baseUF_JT(
         parallelParams_.nbPartitions),
 
         vect_baseUF_ST(parallelParams_.nbPartitions);
@@ -111,8 +111,8 @@ namespace ttk {
         parallelData_.trees[tree].flush();
 
         // UF-array reserve
-        vect_baseUF_JT[tree].resize(scalars_->size);
-        vect_baseUF_ST[tree].resize(scalars_->size);
+        vect_baseUF_JT[tree].resize(scalars_->size, nullUF);
+        vect_baseUF_ST[tree].resize(scalars_->size, nullUF);
 
         // Statistical reserve
         parallelData_.trees[tree].jt_.treeData_.nodes.reserve(resSize);
@@ -276,8 +276,8 @@ namespace ttk {
 
     template <typename scalarType, typename triangulationType>
     int ContourForests::parallelBuild(
-      std::vector<std::vector<ExtendedUnionFind *>> &vect_baseUF_JT,
-      std::vector<std::vector<ExtendedUnionFind *>> &vect_baseUF_ST,
+      std::vector<std::vector<SimplexId>> &vect_baseUF_JT,
+      std::vector<std::vector<SimplexId>> &vect_baseUF_ST,
       const triangulationType &mesh) {
 
       const std::vector<float> timeSimplify(parallelParams_.nbPartitions, 0);
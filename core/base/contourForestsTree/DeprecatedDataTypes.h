@@ -67,6 +67,8 @@ namespace ttk {
     static const idPartition nullPartition
       = std::numeric_limits<idPartition>::max();
     static const ufDataType nullUfData = std::numeric_limits<ufDataType>::max();
+    // no union-find element (see ExtendedUnionFind)
+    static const SimplexId nullUF = -1;
     static constexpr ufDataType specialUfData
       = std::numeric_limits<ufDataType>::max() - 1;
 
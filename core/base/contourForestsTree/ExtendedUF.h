@@ -21,122 +21,91 @@
 
 #include <vector>
 
+#include <FlatUnionFind.h>
+
 #include "DeprecatedDataTypes.h"
 
 namespace ttk {
   namespace cf {
+    /**
+     * @brief Pool of union-find elements with a payload per set
+     *
+     * Elements are indices in flat arrays (see ttk::FlatUnionFind), each
+     * one carrying a data (e.g. a super arc id) and an origin (e.g. a
+     * vertex id). The payload of a set is stored on its representative:
+     * call find() before the getters and setters.
+     */
     class ExtendedUnionFind {
     private:
-      int rank_;
-      ExtendedUnionFind *parent_;
-      ufDataType data_;
-      SimplexId origin_;
+      FlatUnionFind uf_{};
+      std::vector<ufDataType> data_{};
+      std::vector<SimplexId> origin_{};
 
     public:
-      inline ExtendedUnionFind(const SimplexId &origin) {
-        rank_ = 0;
-        parent_ = this;
-        data_ = nullUfData;
-        origin_ = origin;
-      }
-
-      inline ExtendedUnionFind(const ExtendedUnionFind &other) {
-        rank_ = other.rank_;
-        parent_ = this;
-        data_ = other.data_;
-        origin_ = other.origin_;
-      }
+      ExtendedUnionFind() = default;
 
-      inline ExtendedUnionFind &operator=(const ExtendedUnionFind &other) {
-        if(&other != this) {
-          rank_ = other.rank_;
-          parent_ = this;
-          data_ = other.data_;
-          origin_ = other.origin_;
-        }
-        return *this;
+      inline explicit ExtendedUnionFind(const size_t nElements,
+                                        const SimplexId &origin = 0) {
+        reset(nElements, origin);
       }
 
-      inline void setData(const ufDataType &d) {
-        data_ = d;
+      inline void reset(const size_t nElements, const SimplexId &origin = 0) {
+        uf_.reset(nElements);
+        data_.assign(nElements, nullUfData);
+        origin_.assign(nElements, origin);
       }
 
-      inline void setOrigin(const SimplexId &origin) {
-        origin_ = origin;
+      inline void clear() {
+        uf_.clear();
+        data_.clear();
+        origin_.clear();
       }
 
-      inline const ufDataType &getData() const {
-        return data_;
+      inline size_t size() const {
+        return data_.size();
       }
 
-      inline const SimplexId &getOrigin() const {
-        return origin_;
+      /**
+       * @brief Append a new singleton set
+       *
+       * @return The index of the new element
+       */
+      inline SimplexId makeSet(const SimplexId &origin) {
+        data_.emplace_back(nullUfData);
+        origin_.emplace_back(origin);
+        return uf_.makeSet();
       }
 
-      // heavy recursif
-      inline ExtendedUnionFind *find() {
-        if(parent_ == this)
-          return this;
-        else {
-          parent_ = parent_->find();
-          return parent_;
-        }
+      inline void setData(const SimplexId &element, const ufDataType &d) {
+        data_[element] = d;
       }
 
-      inline int getRank() const {
-        return rank_;
+      inline void setOrigin(const SimplexId &element, const SimplexId &origin) {
+        origin_[element] = origin;
       }
 
-      inline void setParent(ExtendedUnionFind *parent) {
-        parent_ = parent;
+      inline const ufDataType &getData(const SimplexId &element) const {
+        return data_[element];
       }
 
-      inline void setRank(const int &rank) {
-        rank_ = rank;
+      inline const SimplexId &getOrigin(const SimplexId &element) const {
+        return origin_[element];
       }
 
-      static inline ExtendedUnionFind *makeUnion(ExtendedUnionFind *uf0,
-                                                 ExtendedUnionFind *uf1) {
-        uf0 = uf0->find();
-        uf1 = uf1->find();
-
-        if(uf0 == uf1) {
-          return uf0;
-        } else if(uf0->getRank() > uf1->getRank()) {
-          uf1->setParent(uf0);
-          return uf0;
-        } else if(uf0->getRank() < uf1->getRank()) {
-          uf0->setParent(uf1);
-          return uf1;
-        } else {
-          uf1->setParent(uf0);
-          uf0->setRank(uf0->getRank() + 1);
-          return uf0;
-        }
+      inline SimplexId find(const SimplexId &element) {
+        return uf_.find(element);
       }
 
-      static inline ExtendedUnionFind *
-        makeUnion(std::vector<ExtendedUnionFind *> &sets) {
-        ExtendedUnionFind *n = nullptr;
-
-        if(!sets.size())
-          return nullptr;
-
-        if(sets.size() == 1)
-          return sets[0];
-
-        for(int i = 0; i < (int)sets.size() - 1; i++)
-          n = makeUnion(sets[i], sets[i + 1]);
-
-        return n;
+      inline int getRank(const SimplexId &element) const {
+        return uf_.getRank(element);
       }
 
-      inline bool operator<(const ExtendedUnionFind &other) const {
-        return rank_ < other.rank_;
+      inline SimplexId makeUnion(const SimplexId &uf0, const SimplexId &uf1) {
+        return uf_.makeUnion(uf0, uf1);
       }
 
-      inline bool operator>(const ExtendedUnionFind &other) const {
-        return rank_ > other.rank_;
+      inline SimplexId makeUnion(const std::vector<SimplexId> &sets) {
+        return uf_.makeUnion(sets);
       }
     };
   } // namespace cf
@@ -1063,28 +1063,28 @@ void MergeTree::hideAndMerge(const idSuperArc &mergingArcId,
   mergeArc(mergingArcId, receptacleArcId);
 }
 
-void MergeTree::markThisArc(vector<ExtendedUnionFind *> &ufArray,
+void MergeTree::markThisArc(ExtendedUnionFind &uf,
+                            vector<SimplexId> &ufArray,
                             const idNode &curNodeId,
                             const idSuperArc &mergingArcId,
                             const idNode &parentNodeId) {
   // size of this subtree segmentation + segmentation of this arc
   const auto &curSegmenSize = getSuperArc(mergingArcId)->getVertSize()
-                              + ufArray[curNodeId]->find()->getOrigin() + 2;
+                              + uf.getOrigin(uf.find(ufArray[curNodeId])) + 2;
   // +2 for the merging nodes
 
   // UF propagation
-  if(ufArray[parentNodeId] == nullptr) {
+  if(ufArray[parentNodeId] == nullUF) {
     // Parent have never been seen : recopy UF
-    ufArray[parentNodeId] = ufArray[curNodeId]->find();
-    ufArray[parentNodeId]->find()->setOrigin(curSegmenSize);
+    ufArray[parentNodeId] = uf.find(ufArray[curNodeId]);
+    uf.setOrigin(uf.find(ufArray[parentNodeId]), curSegmenSize);
     // cout << "will merge " << getNode(curNodeId)->getVertexId() << endl;
   } else {
     // The parent have already been visited : merge UF and segmentation
-    const auto &oldSegmentationSize
-      = ufArray[parentNodeId]->find()->getOrigin();
-    ExtendedUnionFind::makeUnion(
-      ufArray[curNodeId]->find(), ufArray[parentNodeId]->find())
-      ->setOrigin(oldSegmentationSize + curSegmenSize);
+    const auto oldSegmentationSize
+      = uf.getOrigin(uf.find(ufArray[parentNodeId]));
+    uf.setOrigin(uf.makeUnion(ufArray[curNodeId], ufArray[parentNodeId]),
+                 oldSegmentationSize + curSegmenSize);
     // cout << "Union on " << getNode(parentNodeId)->getVertexId();
     // cout << " from " << getNode(curNodeId)->getVertexId() << endl;
   }
@@ -1092,11 +1092,12 @@ void MergeTree::markThisArc(vector<ExtendedUnionFind *> &ufArray,
   // The last parentNode is the root of the subtree
   // cout << "for " << getNode(curNodeId)->getVertexId() << " set root " <<
   // getNode(parentNodeId)->getVertexId() << endl;
-  ufArray[parentNodeId]->find()->setData(-((ufDataType)parentNodeId) - 1);
+  uf.setData(uf.find(ufArray[parentNodeId]), -((ufDataType)parentNodeId) - 1);
 }
 
 idSuperArc MergeTree::newUpArc(const idNode &curNodeId,
-                               vector<ExtendedUnionFind *> &ufArray) {
+                               ExtendedUnionFind &uf,
+                               vector<SimplexId> &ufArray) {
 
   idSuperArc keepArc = nullSuperArc;
   const auto nbUp = getNode(curNodeId)->getNumberOfUpSuperArcs();
@@ -1108,8 +1109,8 @@ idSuperArc MergeTree::newUpArc(const idNode &curNodeId,
     keepArc = curArc;
 
     const idNode &newUp = getSuperArc(curArc)->getUpNodeId();
-    if(!ufArray[newUp]
-       || ufArray[curNodeId]->find() != ufArray[newUp]->find()) {
+    if(ufArray[newUp] == nullUF
+       || uf.find(ufArray[curNodeId]) != uf.find(ufArray[newUp])) {
       return curArc;
     }
   }
@@ -1120,7 +1121,8 @@ idSuperArc MergeTree::newUpArc(const idNode &curNodeId,
 }
 
 idSuperArc MergeTree::newDownArc(const idNode &curNodeId,
-                                 vector<ExtendedUnionFind *> &ufArray) {
+                                 ExtendedUnionFind &uf,
+                                 vector<SimplexId> &ufArray) {
 
   idSuperArc keepArc = nullSuperArc;
   const auto nbDown = getNode(curNodeId)->getNumberOfDownSuperArcs();
@@ -1132,8 +1134,8 @@ idSuperArc MergeTree::newDownArc(const idNode &curNodeId,
     keepArc = curArc;
 
     const idNode &newDown = getSuperArc(curArc)->getDownNodeId();
-    if(!ufArray[newDown]
-       || ufArray[curNodeId]->find() != ufArray[newDown]->find()) {
+    if(ufArray[newDown] == nullUF
+       || uf.find(ufArray[curNodeId]) != uf.find(ufArray[newDown])) {
       return curArc;
     }
   }
@@ -1146,12 +1148,13 @@ idSuperArc MergeTree::newDownArc(const idNode &curNodeId,
 tuple<idNode, idNode, SimplexId> MergeTree::createReceptArc(
   const idNode &root,
   const idSuperArc &receptacleArcId,
-  vector<ExtendedUnionFind *> &ufArray,
+  ExtendedUnionFind &uf,
+  vector<SimplexId> &ufArray,
   const vector<pair<idSuperArc, idSuperArc>> &valenceOffsets) {
 
   const bool DEBUG = false;
 
-  ExtendedUnionFind *ufRoot = ufArray[root]->find();
+  const SimplexId ufRoot = uf.find(ufArray[root]);
   idNode downNode = root;
   idNode upNode = root;
 
@@ -1162,7 +1165,7 @@ tuple<idNode, idNode, SimplexId> MergeTree::createReceptArc(
   }
 
   // descend in the tree until valence is not 2
-  SimplexId segmentationSize = ufRoot->find()->getOrigin();
+  SimplexId segmentationSize = uf.getOrigin(ufRoot);
   // cout << "init size " << segmentationSize << endl;
 
   // We need a valence of 2 (we don't want to cross a futur saddle
@@ -1174,7 +1177,7 @@ tuple<idNode, idNode, SimplexId> MergeTree::createReceptArc(
     // take the down node not leading to the current subtree
     // if have an UF, merge with current subtree
     // (else init it?)
-    const idSuperArc &downArc = newDownArc(downNode, ufArray);
+    const idSuperArc &downArc = newDownArc(downNode, uf, ufArray);
 
     // deal with arc segmentation
     segmentationSize += getSuperArc(downArc)->getVertSize() + 2;
@@ -1189,14 +1192,14 @@ tuple<idNode, idNode, SimplexId> MergeTree::createReceptArc(
     }
 
     // UF
-    if(ufArray[downNode]) {
-      segmentationSize += ufArray[downNode]->find()->getOrigin();
-      // ExtendedUnionFind::makeUnion(ufArray[downNode], ufRoot);
-      if(ufArray[downNode]->find()->getData() < 0) {
-        ufArray[downNode]->find()->setData(receptacleArcId);
+    if(ufArray[downNode] != nullUF) {
+      segmentationSize += uf.getOrigin(uf.find(ufArray[downNode]));
+      // uf.makeUnion(ufArray[downNode], ufRoot);
+      if(uf.getData(uf.find(ufArray[downNode])) < 0) {
+        uf.setData(uf.find(ufArray[downNode]), receptacleArcId);
       }
     } else {
-      // ufArray[downNode] = ufRoot->find();
+      // ufArray[downNode] = uf.find(ufRoot);
     }
     mergeArc(downArc, receptacleArcId, false);
     hideNode(tmpUp);
@@ -1214,7 +1217,7 @@ tuple<idNode, idNode, SimplexId> MergeTree::createReceptArc(
         && getNode(upNode)->getDownValence() - valenceOffsets[upNode].first
              == 1) {
 
-    const idSuperArc &upArc = newUpArc(upNode, ufArray);
+    const idSuperArc &upArc = newUpArc(upNode, uf, ufArray);
 
     segmentationSize += getSuperArc(upArc)->getVertSize() + 2;
 
@@ -1226,14 +1229,14 @@ tuple<idNode, idNode, SimplexId> MergeTree::createReceptArc(
       cout << " new segmentation : " << segmentationSize << endl;
     }
 
-    if(ufArray[upNode]) {
-      segmentationSize += ufArray[upNode]->find()->getOrigin();
-      // ExtendedUnionFind::makeUnion(ufArray[upNode], ufRoot);
-      if(ufArray[upNode]->find()->getData() < 0) {
-        ufArray[upNode]->find()->setData(receptacleArcId);
+    if(ufArray[upNode] != nullUF) {
+      segmentationSize += uf.getOrigin(uf.find(ufArray[upNode]));
+      // uf.makeUnion(ufArray[upNode], ufRoot);
+      if(uf.getData(uf.find(ufArray[upNode])) < 0) {
+        uf.setData(uf.find(ufArray[upNode]), receptacleArcId);
       }
     } else {
-      // ufArray[upNode] = ufRoot->find();
+      // ufArray[upNode] = uf.find(ufRoot);
     }
     mergeArc(upArc, receptacleArcId, false);
     hideNode(tmpDown);
@@ -1244,25 +1247,25 @@ tuple<idNode, idNode, SimplexId> MergeTree::createReceptArc(
   if(upNode == downNode) {
     // several degen. nodes adjacent
     // Prefer down for JT / ST
-    const idSuperArc tmpDown = newDownArc(downNode, ufArray);
-    const idSuperArc tmpUp = newUpArc(upNode, ufArray);
+    const idSuperArc tmpDown = newDownArc(downNode, uf, ufArray);
+    const idSuperArc tmpUp = newUpArc(upNode, uf, ufArray);
 
     if(tmpDown == nullSuperArc) {
       upNode = getSuperArc(tmpUp)->getUpNodeId();
-      if(ufArray[upNode]) {
-        segmentationSize += ufArray[upNode]->find()->getOrigin();
-        // ExtendedUnionFind::makeUnion(ufArray[downNode], ufRoot);
+      if(ufArray[upNode] != nullUF) {
+        segmentationSize += uf.getOrigin(uf.find(ufArray[upNode]));
+        // uf.makeUnion(ufArray[downNode], ufRoot);
       } else {
-        ufArray[upNode] = ufRoot->find();
+        ufArray[upNode] = uf.find(ufRoot);
       }
       getSuperArc(tmpUp)->merge(receptacleArcId);
     } else {
       downNode = getSuperArc(tmpDown)->getDownNodeId();
-      if(ufArray[downNode]) {
-        segmentationSize += ufArray[downNode]->find()->getOrigin();
-        // ExtendedUnionFind::makeUnion(ufArray[upNode], ufRoot);
+      if(ufArray[downNode] != nullUF) {
+        segmentationSize += uf.getOrigin(uf.find(ufArray[downNode]));
+        // uf.makeUnion(ufArray[upNode], ufRoot);
       } else {
-        ufArray[downNode] = ufRoot->find();
+        ufArray[downNode] = uf.find(ufRoot);
       }
       getSuperArc(tmpDown)->merge(receptacleArcId);
     }
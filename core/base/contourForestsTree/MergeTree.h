@@ -47,7 +47,7 @@ namespace ttk {
       TreeData treeData_;
 
       // storage
-      std::list<ExtendedUnionFind> storageEUF_;
+      ExtendedUnionFind storageEUF_;
 
     public:
       // CONSTRUCT
@@ -378,7 +378,7 @@ namespace ttk {
       // Merge tree processing of a vertex during build
       template <typename triangulationType>
       void processVertex(const SimplexId &vertex,
-                         std::vector<ExtendedUnionFind *> &vect_baseUF,
+                         std::vector<SimplexId> &vect_baseUF,
                          const bool overlapB,
                          const bool overlapA,
                          const triangulationType &mesh,
@@ -386,7 +386,7 @@ namespace ttk {
 
       /// \brief Compute the merge tree using Carr's algorithm
       template <typename triangulationType>
-      int build(std::vector<ExtendedUnionFind *> &vect_baseUF,
+      int build(std::vector<SimplexId> &vect_baseUF,
                 const std::vector<SimplexId> &overlapBefore,
                 const std::vector<SimplexId> &overlapAfter,
                 SimplexId start,
@@ -425,7 +425,8 @@ namespace ttk {
           &sortedPairs);
 
       // add this arc in the subtree which is in the parentNode
-      void markThisArc(std::vector<ExtendedUnionFind *> &ufArray,
+      void markThisArc(ExtendedUnionFind &uf,
+                       std::vector<SimplexId> &ufArray,
                        const idNode &curNodeId,
                        const idSuperArc &mergingArcId,
                        const idNode &parentNodeId);
@@ -711,15 +712,18 @@ namespace ttk {
       std::tuple<idNode, idNode, SimplexId> createReceptArc(
         const idNode &root,
         const idSuperArc &receptArcId,
-        std::vector<ExtendedUnionFind *> &arrayUF,
+        ExtendedUnionFind &uf,
+        std::vector<SimplexId> &arrayUF,
         const std::vector<std::pair<idSuperArc, idSuperArc>> &valenceOffsets);
 
       // during this BFS nodes should have only one arc up/down : find it :
       idSuperArc newUpArc(const idNode &curNodeId,
-                          std::vector<ExtendedUnionFind *> &ufArray);
+                          ExtendedUnionFind &uf,
+                          std::vector<SimplexId> &ufArray);
 
       idSuperArc newDownArc(const idNode &curNodeId,
-                            std::vector<ExtendedUnionFind *> &ufArray);
+                            ExtendedUnionFind &uf,
+                            std::vector<SimplexId> &ufArray);
 
       // }
       // --------------
@@ -192,8 +192,8 @@ namespace ttk {
       const auto nbArcs = getNumberOfSuperArcs();
       // Retain the relation between merge coming from st, jt
       // also retain info about what we keep
-      std::vector<ExtendedUnionFind> storageUF(nbNode, 0);
-      std::vector<ExtendedUnionFind *> subtreeUF(nbNode, nullptr);
+      ExtendedUnionFind storageUF(nbNode);
+      std::vector<SimplexId> subtreeUF(nbNode, nullUF);
 
       // nb arc seen below / above this node
       std::vector<std::pair<idSuperArc, idSuperArc>> valenceOffset(
@@ -229,8 +229,7 @@ namespace ttk {
           }
 
           node2see.emplace(thisOriginId, std::get<3>(pp));
-          storageUF[thisOriginId] = ExtendedUnionFind{0};
-          subtreeUF[thisOriginId] = &storageUF[thisOriginId];
+          subtreeUF[thisOriginId] = thisOriginId;
           ++nbPairMerged;
           if(DEBUG) {
             std::cout << "willSee " << printNode(thisOriginId) << std::endl;
@@ -265,18 +264,19 @@ namespace ttk {
         idNode parentNodeId;
         // continue traversall
         if(needToGoUp) {
-          mergingArcId = newUpArc(curNodeId, subtreeUF);
+          mergingArcId = newUpArc(curNodeId, storageUF, subtreeUF);
           parentNodeId = getSuperArc(mergingArcId)->getUpNodeId();
           ++valenceOffset[curNodeId].second;
           ++valenceOffset[parentNodeId].first;
         } else {
-          mergingArcId = newDownArc(curNodeId, subtreeUF);
+          mergingArcId = newDownArc(curNodeId, storageUF, subtreeUF);
           parentNodeId = getSuperArc(mergingArcId)->getDownNodeId();
           ++valenceOffset[curNodeId].first;
           ++valenceOffset[parentNodeId].second;
         }
 
-        markThisArc(subtreeUF, curNodeId, mergingArcId, parentNodeId);
+        markThisArc(
+          storageUF, subtreeUF, curNodeId, mergingArcId, parentNodeId);
 
         // if we have processed all but one arc of this node, we nee to continue
         // traversall
@@ -302,12 +302,14 @@ namespace ttk {
       if(DEBUG) {
         std::cout << "node subtrees before creating receptarc " << std::endl;
         for(idNode nid = 0; nid < nbNode; nid++) {
-          if(subtreeUF[nid]) {
+          if(subtreeUF[nid] != nullUF) {
             std::cout << "node " << getNode(nid)->getVertexId()
                       << " is in subtree rooted :";
-            const idNode &root = -subtreeUF[nid]->find()->getData() - 1;
+            const idNode root
+              = -storageUF.getData(storageUF.find(subtreeUF[nid])) - 1;
             std::cout << getNode(root)->getVertexId();
-            const SimplexId &segmSize = subtreeUF[nid]->find()->getOrigin();
+            const SimplexId segmSize
+              = storageUF.getOrigin(storageUF.find(subtreeUF[nid]));
             std::cout << " with segmentation of " << segmSize << std::endl;
           }
         }
@@ -334,17 +336,19 @@ namespace ttk {
             continue;
           }
 
-          if(subtreeUF[thisOriginId]->find()->getData() < 0) {
+          const SimplexId thisOriginUF
+            = storageUF.find(subtreeUF[thisOriginId]);
+          if(storageUF.getData(thisOriginUF) < 0) {
             // create receptarc
             const idNode &subtreeRoot
-              = -subtreeUF[thisOriginId]->find()->getData() - 1;
+              = -storageUF.getData(thisOriginUF) - 1;
             // The id of the next arc to be created : NOT PARALLEL
             const idSuperArc receptArcId = treeData_.superArcs.size();
             // down , up, segmentation size
             // create the receptacle arc and merge arc not in sub-tree in it
             const std::tuple<idNode, idNode, SimplexId> &receptArc
               = createReceptArc(
-                subtreeRoot, receptArcId, subtreeUF, valenceOffset);
+                subtreeRoot, receptArcId, storageUF, subtreeUF, valenceOffset);
 
             // make superArc and do the makeAlloc on it
             const bool overlapB =
@@ -369,7 +373,8 @@ namespace ttk {
               treeData_.arcsCrossingAbove.emplace_back(na);
             }
 
-            subtreeUF[thisOriginId]->find()->setData(receptArcId);
+            storageUF.setData(
+              storageUF.find(subtreeUF[thisOriginId]), receptArcId);
             getSuperArc(receptArcId)
               ->makeAllocGlobal(std::get<2>(receptArc), storage);
 
@@ -416,19 +421,21 @@ namespace ttk {
           const idNode &downNode = getSuperArc(arc)->getDownNodeId();
           const idNode &upNode = getSuperArc(arc)->getUpNodeId();
 
-          if(!(subtreeUF[downNode] && subtreeUF[upNode]))
+          if(subtreeUF[downNode] == nullUF || subtreeUF[upNode] == nullUF)
             continue;
 
-          if(subtreeUF[downNode] && subtreeUF[upNode]
-             && subtreeUF[downNode]->find() != subtreeUF[upNode]->find()) {
+          if(storageUF.find(subtreeUF[downNode])
+             != storageUF.find(subtreeUF[upNode])) {
             if(DEBUG) {
               std::cout << "Arc between 2 degenerate with mergin "
                         << printArc(arc) << std::endl;
               std::cout << "below recept : "
-                        << printArc(subtreeUF[downNode]->find()->getData());
+                        << printArc(storageUF.getData(
+                             storageUF.find(subtreeUF[downNode])));
               std::cout << std::endl;
               std::cout << "Above recept : "
-                        << printArc(subtreeUF[upNode]->find()->getData())
+                        << printArc(storageUF.getData(
+                             storageUF.find(subtreeUF[upNode])))
                         << std::endl;
               std::cout << std::endl;
             }
@@ -436,11 +443,11 @@ namespace ttk {
             continue;
           }
 
-          ExtendedUnionFind *curUF = (subtreeUF[upNode])
-                                       ? subtreeUF[upNode]->find()
-                                       : subtreeUF[downNode]->find();
+          const SimplexId curUF = (subtreeUF[upNode] != nullUF)
+                                    ? storageUF.find(subtreeUF[upNode])
+                                    : storageUF.find(subtreeUF[downNode]);
 
-          const idSuperArc &receptacleArcId = curUF->getData();
+          const idSuperArc receptacleArcId = storageUF.getData(curUF);
 
           if(DEBUG) {
             std::cout << "merge in " << printArc(receptacleArcId) << std::endl;
@@ -560,11 +567,11 @@ namespace ttk {
       const triangulationType &mesh) {
       const auto nbNode = getNumberOfNodes();
 
-      std::vector<ExtendedUnionFind> storage_JoinUF(nbNode, 0);
-      std::vector<ExtendedUnionFind> storage_SplitUF(nbNode, 0);
+      ExtendedUnionFind storage_JoinUF(nbNode);
+      ExtendedUnionFind storage_SplitUF(nbNode);
 
-      std::vector<ExtendedUnionFind *> vect_JoinUF(nbNode, nullptr);
-      std::vector<ExtendedUnionFind *> vect_SplitUF(nbNode, nullptr);
+      std::vector<SimplexId> vect_JoinUF(nbNode, nullUF);
+      std::vector<SimplexId> vect_SplitUF(nbNode, nullUF);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel sections num_threads(2)
@@ -587,9 +594,8 @@ namespace ttk {
 
             if(nbDown == 0) {
               // leaf
-              storage_JoinUF[n] = ExtendedUnionFind{getNode(n)->getVertexId()};
-              vect_JoinUF[n] = &storage_JoinUF[n];
-              vect_JoinUF[n]->setOrigin(v);
+              vect_JoinUF[n] = n;
+              storage_JoinUF.setOrigin(n, v);
               // std::cout << " jt origin : " << v << std::endl;
             } else {
               // first descendant
@@ -597,8 +603,9 @@ namespace ttk {
               const SuperArc *firstSA = getSuperArc(firstSaId);
               const idNode &firstChildNodeId = firstSA->getDownNodeId();
 
-              ExtendedUnionFind *merge = vect_JoinUF[firstChildNodeId]->find();
-              SimplexId further = merge->getOrigin();
+              const SimplexId merge
+                = storage_JoinUF.find(vect_JoinUF[firstChildNodeId]);
+              SimplexId further = storage_JoinUF.getOrigin(merge);
               idSuperArc furtherI = 0;
 
               // Find the most persistent way
@@ -611,10 +618,11 @@ namespace ttk {
                 if(neigh == n)
                   continue;
 
-                ExtendedUnionFind *neighUF = vect_JoinUF[neigh]->find();
+                const SimplexId neighUF
+                  = storage_JoinUF.find(vect_JoinUF[neigh]);
 
-                if(isLower(neighUF->getOrigin(), further)) {
-                  further = neighUF->getOrigin();
+                if(isLower(storage_JoinUF.getOrigin(neighUF), further)) {
+                  further = storage_JoinUF.getOrigin(neighUF);
                   furtherI = ni;
                 }
               }
@@ -630,25 +638,27 @@ namespace ttk {
                   if(neigh == n)
                     continue;
 
-                  ExtendedUnionFind *neighUF = vect_JoinUF[neigh]->find();
+                  const SimplexId neighUF
+                    = storage_JoinUF.find(vect_JoinUF[neigh]);
 
                   if(ni != furtherI) { // keep the more persistent pair
                     addPair<scalarType>(
-                      pairsJT, neighUF->getOrigin(), v, mesh, true);
-                    pendingMinMax.erase(neighUF->getOrigin());
+                      pairsJT, storage_JoinUF.getOrigin(neighUF), v, mesh,
+                      true);
+                    pendingMinMax.erase(storage_JoinUF.getOrigin(neighUF));
 
                     // std::cout << " jt make pair : " <<
-                    // neighUF->getOrigin() << " - " << v <<
+                    // storage_JoinUF.getOrigin(neighUF) << " - " << v <<
                     // std::endl;
                   }
 
-                  ExtendedUnionFind::makeUnion(merge, neighUF)
-                    ->setOrigin(further);
+                  storage_JoinUF.setOrigin(
+                    storage_JoinUF.makeUnion(merge, neighUF), further);
                 }
               }
 
-              merge->find()->setOrigin(further);
-              vect_JoinUF[n] = merge->find();
+              storage_JoinUF.setOrigin(storage_JoinUF.find(merge), further);
+              vect_JoinUF[n] = storage_JoinUF.find(merge);
 
               if(!nbUp) {
                 // potential close of the component
@@ -688,9 +698,8 @@ namespace ttk {
 
             if(nbUp == 0) {
               // leaf
-              storage_SplitUF[n] = ExtendedUnionFind{getNode(n)->getVertexId()};
-              vect_SplitUF[n] = &storage_SplitUF[n];
-              vect_SplitUF[n]->setOrigin(v);
+              vect_SplitUF[n] = n;
+              storage_SplitUF.setOrigin(n, v);
               // std::cout << " st origin : " << v << std::endl;
             } else {
               // first descendant
@@ -698,8 +707,9 @@ namespace ttk {
               const SuperArc *firstSA = getSuperArc(firstSaId);
               const idNode &firstChildNodeId = firstSA->getUpNodeId();
 
-              ExtendedUnionFind *merge = vect_SplitUF[firstChildNodeId]->find();
-              SimplexId further = merge->getOrigin();
+              const SimplexId merge
+                = storage_SplitUF.find(vect_SplitUF[firstChildNodeId]);
+              SimplexId further = storage_SplitUF.getOrigin(merge);
               idSuperArc furtherI = 0;
 
               for(idSuperArc ni = 1; ni < nbUp; ++ni) {
@@ -718,10 +728,11 @@ namespace ttk {
                 // std::cout << "visit neighbor : " << ni << " which is " <<
                 // getNode(neigh)->getVertexId() << std::endl;
 
-                ExtendedUnionFind *neighUF = vect_SplitUF[neigh]->find();
+                const SimplexId neighUF
+                  = storage_SplitUF.find(vect_SplitUF[neigh]);
 
-                if(isHigher(neighUF->getOrigin(), further)) {
-                  further = neighUF->getOrigin();
+                if(isHigher(storage_SplitUF.getOrigin(neighUF), further)) {
+                  further = storage_SplitUF.getOrigin(neighUF);
                   furtherI = ni;
                 }
               }
@@ -737,28 +748,30 @@ namespace ttk {
                   if(neigh == n)
                     continue;
 
-                  ExtendedUnionFind *neighUF = vect_SplitUF[neigh]->find();
+                  const SimplexId neighUF
+                    = storage_SplitUF.find(vect_SplitUF[neigh]);
 
                   if(ni != furtherI) {
                     addPair<scalarType>(
-                      pairsST, neighUF->getOrigin(), v, mesh, false);
+                      pairsST, storage_SplitUF.getOrigin(neighUF), v, mesh,
+                      false);
 
-                    pendingMinMax.erase(neighUF->getOrigin());
+                    pendingMinMax.erase(storage_SplitUF.getOrigin(neighUF));
 
                     // std::cout << " st make pair : " <<
-                    // neighUF->getOrigin() << " - " << v
+                    // storage_SplitUF.getOrigin(neighUF) << " - " << v
                     //<< " for neighbor " <<
                     // getNode(neigh)->getVertexId() << std::endl;
                   }
 
-                  ExtendedUnionFind::makeUnion(merge, neighUF)
-                    ->setOrigin(further);
+                  storage_SplitUF.setOrigin(
+                    storage_SplitUF.makeUnion(merge, neighUF), further);
                   // Re-visit after merge lead to add the most persistent
                   // pair....
                 }
               }
-              merge->find()->setOrigin(further);
-              vect_SplitUF[n] = merge->find();
+              storage_SplitUF.setOrigin(storage_SplitUF.find(merge), further);
+              vect_SplitUF[n] = storage_SplitUF.find(merge);
 
               if(!nbDown) {
                 pendingMinMax[further] = v;
@@ -823,7 +836,7 @@ namespace ttk {
     }
 
     template <typename triangulationType>
-    int MergeTree::build(std::vector<ExtendedUnionFind *> &vect_baseUF,
+    int MergeTree::build(std::vector<SimplexId> &vect_baseUF,
                          const std::vector<SimplexId> &overlapBefore,
                          const std::vector<SimplexId> &overlapAfter,
                          SimplexId start,
@@ -839,6 +852,7 @@ namespace ttk {
       //
       // clear and reset tree data (this step should take almost no time)
       flush();
+      storageEUF_.clear();
 
       DebugTimer timerBegin;
 
@@ -953,8 +967,9 @@ namespace ttk {
         if(!mesh->getVertexNeighborNumber(corrVertex)) {
           tmp_sa = getNode(l)->getUpSuperArcId(0);
         } else {
-          tmp_sa = (idSuperArc)((vect_baseUF[corrVertex])->find()->getData());
-          origin = (idSuperArc)((vect_baseUF[corrVertex])->find()->getOrigin());
+          const SimplexId corrUF = storageEUF_.find(vect_baseUF[corrVertex]);
+          tmp_sa = (idSuperArc)(storageEUF_.getData(corrUF));
+          origin = (idSuperArc)(storageEUF_.getOrigin(corrUF));
         }
 
         if(treeData_.superArcs[tmp_sa].getUpNodeId() == nullNodes) {
@@ -1002,13 +1017,13 @@ namespace ttk {
 
     template <typename triangulationType>
     void MergeTree::processVertex(const SimplexId &currentVertex,
-                                  std::vector<ExtendedUnionFind *> &vect_baseUF,
+                                  std::vector<SimplexId> &vect_baseUF,
                                   const bool overlapB,
                                   const bool overlapA,
                                   const triangulationType &mesh,
                                   DebugTimer &begin) {
-      std::vector<ExtendedUnionFind *> vect_neighUF;
-      ExtendedUnionFind *seed = nullptr, *tmpseed;
+      std::vector<SimplexId> vect_neighUF;
+      SimplexId seed = nullUF, tmpseed;
 
       SimplexId neighSize;
       const SimplexId neighborNumber
@@ -1025,11 +1040,11 @@ namespace ttk {
         // if the vertex is out: consider it null
         tmpseed = vect_baseUF[neighbor];
         // unvisited vertex, we continue.
-        if(tmpseed == nullptr) {
+        if(tmpseed == nullUF) {
           continue;
         }
 
-        tmpseed = tmpseed->find();
+        tmpseed = storageEUF_.find(tmpseed);
 
         // get all different UF in neighborhood
         if(find(vect_neighUF.cbegin(), vect_neighUF.cend(), tmpseed)
@@ -1049,13 +1064,7 @@ namespace ttk {
         // we are on a real extrema we have to create a new UNION FIND and a
         // branch a real extrema can't be a virtual extrema
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp critical
-#endif // TTK_ENABLE_OPENMP
-        {
-          this->storageEUF_.emplace_back(currentVertex);
-          seed = &this->storageEUF_.back();
-        }
+        seed = this->storageEUF_.makeSet(currentVertex);
         // When creating an extrema we create a pair ending on this node.
         currentNode = makeNode(currentVertex);
         getNode(currentNode)->setOrigin(currentNode);
@@ -1082,27 +1091,30 @@ namespace ttk {
         closingNode = makeNode(currentVertex);
         currentArc = openSuperArc(closingNode, overlapB, overlapA);
 
-        SimplexId farOrigin = vect_neighUF[0]->find()->getOrigin();
+        SimplexId farOrigin
+          = storageEUF_.getOrigin(storageEUF_.find(vect_neighUF[0]));
 
         // close each SuperArc finishing here
-        for(auto *neigh : vect_neighUF) {
-          closeSuperArc((idSuperArc)neigh->find()->getData(), closingNode,
+        for(const auto neighUF : vect_neighUF) {
+          const SimplexId neigh = storageEUF_.find(neighUF);
+          closeSuperArc((idSuperArc)storageEUF_.getData(neigh), closingNode,
                         overlapB, overlapA);
           // persistence pair closing here.
           // For the one who will continue, it will be override later
-          vertex2Node(neigh->find()->getOrigin())->setTermination(closingNode);
+          vertex2Node(storageEUF_.getOrigin(neigh))
+            ->setTermination(closingNode);
 
           // cout <<
           // getNode(getCorrespondingNode(neigh->find()->getOrigin()))->getVertexId()
           //<< " terminate on " << getNode(closingNode)->getVertexId() << endl;
 
-          if((isJT && isLower(neigh->find()->getOrigin(), farOrigin))
-             || (!isJT && isHigher(neigh->find()->getOrigin(), farOrigin))) {
+          if((isJT && isLower(storageEUF_.getOrigin(neigh), farOrigin))
+             || (!isJT && isHigher(storageEUF_.getOrigin(neigh), farOrigin))) {
             // here we keep the continuing the most persitant pair.
             // It means a pair end when a parent have another origin than the
             // current leaf (or is the root) It might be not intuitive but it is
             // more convenient for degenerate cases
-            farOrigin = neigh->find()->getOrigin();
+            farOrigin = storageEUF_.getOrigin(neigh);
             // cout << "find origin  " << farOrigin << " for " << currentVertex
             // << " " << isJT
             //<< endl;
@@ -1110,11 +1122,11 @@ namespace ttk {
         }
 
         // Union correspond to the merge
-        seed = ExtendedUnionFind::makeUnion(vect_neighUF);
-        if(seed == nullptr) {
+        seed = storageEUF_.makeUnion(vect_neighUF);
+        if(seed == nullUF) {
           return;
         }
-        seed->setOrigin(farOrigin);
+        storageEUF_.setOrigin(seed, farOrigin);
         getNode(closingNode)->setOrigin(getCorrespondingNodeId(farOrigin));
 
         // cout << "  " << getNode(closingNode)->getVertexId() << " have origin
@@ -1126,16 +1138,16 @@ namespace ttk {
 
       } else {
 #ifndef TTK_ENABLE_KAMIKAZE
-        if(seed == nullptr) {
+        if(seed == nullUF) {
           return;
         }
 #endif // TTK_ENABLE_KAMIKAZE
        // regular node
-        currentArc = (idSuperArc)seed->find()->getData();
+        currentArc = (idSuperArc)storageEUF_.getData(storageEUF_.find(seed));
         updateCorrespondingArc(currentVertex, currentArc);
       }
       // common
-      seed->setData((ufDataType)currentArc);
+      storageEUF_.setData(seed, (ufDataType)currentArc);
       getSuperArc(currentArc)->setLastVisited(currentVertex);
       vect_baseUF[currentVertex] = seed;
     }
@@ -210,14 +210,15 @@ int SubLevelSetTree::build() {
   if((minimumList_) && (maximumList_))
     return -6;
 
-  vector<UnionFind> seeds;
+  // one set per extremum, the vertices store the index of their set
+  FlatUnionFind seeds;
   vector<vector<int>> seedSuperArcs;
-  vector<UnionFind *> vertexSeeds(vertexNumber_, (UnionFind *)nullptr);
-  vector<UnionFind *> starSets;
+  vector<SimplexId> vertexSeeds(vertexNumber_, -1);
+  vector<SimplexId> starSets;
   vector<bool> visitedVertices(vertexNumber_, false);
 
   SimplexId vertexId = -1, nId = -1;
-  UnionFind *seed = nullptr, *firstUf = nullptr;
+  SimplexId seed = -1, firstUf = -1;
 
   const vector<int> *extremumList = nullptr;
 
@@ -242,12 +243,12 @@ int SubLevelSetTree::build() {
     filtrationCtCmp>
     filtrationFront;
 
-  seeds.resize(extremumList->size());
+  seeds.reset(extremumList->size());
   seedSuperArcs.resize(seeds.size());
 
   for(int i = 0; i < (int)extremumList->size(); i++) {
     // link each minimum to a union find seed
-    vertexSeeds[(*extremumList)[i]] = &(seeds[i]);
+    vertexSeeds[(*extremumList)[i]] = i;
 
     // open an arc
     seedSuperArcs[i].push_back(openSuperArc(makeNode((*extremumList)[i])));
@@ -273,19 +274,19 @@ int SubLevelSetTree::build() {
     starSets.clear();
 
     merge = false;
-    firstUf = nullptr;
+    firstUf = -1;
 
     SimplexId const neighborNumber
       = triangulation_->getVertexNeighborNumber(vertexId);
     for(SimplexId i = 0; i < neighborNumber; i++) {
       triangulation_->getVertexNeighbor(vertexId, i, nId);
 
-      if(vertexSeeds[nId]) {
-        seed = vertexSeeds[nId]->find();
+      if(vertexSeeds[nId] != -1) {
+        seed = seeds.find(vertexSeeds[nId]);
         starSets.push_back(seed);
 
         // is it merging things?
-        if(!firstUf)
+        if(firstUf == -1)
           firstUf = seed;
         else if(seed != firstUf)
           merge = true;
@@ -304,9 +305,9 @@ int SubLevelSetTree::build() {
       }
     }
 
-    if(!vertexSeeds[vertexId]) {
+    if(vertexSeeds[vertexId] == -1) {
 
-      vertexSeeds[vertexId] = UnionFind::makeUnion(starSets);
+      vertexSeeds[vertexId] = seeds.makeUnion(starSets);
 
       int const newNodeId = makeNode(vertexId);
 
@@ -314,7 +315,7 @@ int SubLevelSetTree::build() {
 
         vector<int> seedIds;
         for(int i = 0; i < (int)starSets.size(); i++) {
-          int const seedId = starSets[i] - &(seeds[0]);
+          int const seedId = starSets[i];
           bool found = false;
           for(int j = 0; j < (int)seedIds.size(); j++) {
             if(seedIds[j] == seedId) {
@@ -332,12 +333,12 @@ int SubLevelSetTree::build() {
           closeSuperArc(superArcId, newNodeId);
         }
 
-        int const seedId = vertexSeeds[vertexId] - &(seeds[0]);
+        int const seedId = vertexSeeds[vertexId];
         if(!filtrationFront.empty())
           seedSuperArcs[seedId].push_back(openSuperArc(newNodeId));
       } else if(starSets.size()) {
         // we're dealing with a degree-2 node
-        int const seedId = starSets[0] - &(seeds[0]);
+        int const seedId = starSets[0];
         int const superArcId
           = seedSuperArcs[seedId][seedSuperArcs[seedId].size() - 1];
 
@@ -20,7 +20,7 @@
 #pragma once
 
 #include <Triangulation.h>
-#include <UnionFind.h>
+#include <FlatUnionFind.h>
 
 #include <vector>
 
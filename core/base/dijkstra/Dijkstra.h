@@ -3,10 +3,12 @@
 #include <Geometry.h>
 #include <Triangulation.h>
 
+#include <algorithm>
 #include <array>
 #include <functional>
 #include <limits>
 #include <queue>
+#include <tuple>
 
 namespace ttk {
   namespace Dijkstra {
@@ -112,5 +114,225 @@ namespace ttk {
       return 0;
     }
 
+    /**
+     * @brief Compute the shortest paths from a set of sources
+     *
+     * With one thread, the sources are all pushed in the priority
+     * queue of a sequential Dijkstra. Otherwise, the algorithm is a
+     * label-correcting delta-stepping: vertices are grouped into
+     * buckets of distance width delta (the mean edge length), processed
+     * by increasing distance. The vertices of the current bucket are
+     * relaxed in parallel until none of them improves, each
+     * neighbouring vertex pulling its best path from its own
+     * neighbours so that no synchronization is needed. Only O(n)
+     * memory is used, whatever the number of sources.
+     *
+     * The distances are the same as the minimum over the sources of
+     * shortestPath. Equidistant vertices are assigned to the source of
+     * lowest index.
+     *
+     * @param[in] sources Source vertices
+     * @param[in] triangulation Access to neighbor vertices
+     * @param[out] outputDists Distance to the closest source for every
+     * mesh vertex (infinity if unreachable)
+     * @param[out] outputSources Index in @p sources of the closest
+     * source for every mesh vertex (-1 if unreachable)
+     * @param[in] nThreads Number of threads
+     *
+     * @return 0 in case of success
+     */
+    template <typename T,
+              typename triangulationType = ttk::AbstractTriangulation>
+    int multiSourceShortestPath(const std::vector<SimplexId> &sources,
+                                const triangulationType &triangulation,
+                                T *const outputDists,
+                                SimplexId *const outputSources,
+                                const int nThreads = 1) {
+
+      TTK_FORCE_USE(nThreads);
+
+      const SimplexId vertexNumber = triangulation.getNumberOfVertices();
+
+      const auto edgeLength = [&triangulation](const SimplexId a,
+                                               const SimplexId b) -> T {
+        std::array<float, 3> aCoords{}, bCoords{};
+        triangulation.getVertexPoint(a, aCoords[0], aCoords[1], aCoords[2]);
+        triangulation.getVertexPoint(b, bCoords[0], bCoords[1], bCoords[2]);
+        return Geometry::distance(aCoords.data(), bCoords.data());
+      };
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+      for(SimplexId i = 0; i < vertexNumber; ++i) {
+        outputDists[i] = std::numeric_limits<T>::infinity();
+        outputSources[i] = -1;
+      }
+
+      if(nThreads <= 1) {
+        // sequential Dijkstra with one queue for all the sources
+        using pq_t = std::tuple<T, SimplexId, SimplexId>;
+        std::priority_queue<pq_t, std::vector<pq_t>, std::greater<pq_t>> pq;
+        for(size_t i = 0; i < sources.size(); ++i) {
+          const auto s = sources[i];
+          if(s < 0 || s >= vertexNumber) {
+            return 1;
+          }
+          if(outputSources[s] == -1) {
+            outputDists[s] = T{};
+            outputSources[s] = i;
+            pq.emplace(T{}, i, s);
+          }
+        }
+        while(!pq.empty()) {
+          const auto elem = pq.top();
+          pq.pop();
+          const auto vert = std::get<2>(elem);
+          if(std::get<0>(elem) != outputDists[vert]
+             || std::get<1>(elem) != outputSources[vert]) {
+            // outdated entry
+            continue;
+          }
+          const auto nneigh = triangulation.getVertexNeighborNumber(vert);
+          for(SimplexId i = 0; i < nneigh; ++i) {
+            SimplexId neigh{};
+            triangulation.getVertexNeighbor(vert, i, neigh);
+            const T d = outputDists[vert] + edgeLength(vert, neigh);
+            if(d < outputDists[neigh]
+               || (d == outputDists[neigh]
+                   && outputSources[vert] < outputSources[neigh])) {
+              outputDists[neigh] = d;
+              outputSources[neigh] = outputSources[vert];
+              pq.emplace(d, outputSources[neigh], neigh);
+            }
+          }
+        }
+        return 0;
+      }
+
+      // bucket width: mean edge length around a sample of vertices
+      T delta{};
+      size_t nEdges{};
+      const SimplexId stride = std::max<SimplexId>(1, vertexNumber / 1024);
+      for(SimplexId i = 0; i < vertexNumber; i += stride) {
+        const auto nneigh = triangulation.getVertexNeighborNumber(i);
+        for(SimplexId j = 0; j < nneigh; ++j) {
+          SimplexId neigh{};
+          triangulation.getVertexNeighbor(i, j, neigh);
+          delta += edgeLength(i, neigh);
+          nEdges++;
+        }
+      }
+      if(nEdges > 0) {
+        delta /= nEdges;
+      }
+      const auto bucketOf = [delta](const T dist) -> size_t {
+        return delta > T{} ? static_cast<size_t>(dist / delta) : 0;
+      };
+
+      std::vector<std::vector<SimplexId>> buckets(1);
+      for(size_t i = 0; i < sources.size(); ++i) {
+        const auto s = sources[i];
+        if(s < 0 || s >= vertexNumber) {
+          return 1;
+        }
+        if(outputSources[s] == -1) {
+          outputDists[s] = T{};
+          outputSources[s] = i;
+          buckets[0].emplace_back(s);
+        }
+      }
+
+      // vertices of the current bucket, their neighbors and the best
+      // path pulled by each neighbor
+      std::vector<SimplexId> frontier{}, candidates{};
+      std::vector<size_t> offsets{};
+      std::vector<T> candDists{};
+      std::vector<SimplexId> candSources{};
+
+      for(size_t b = 0; b < buckets.size(); ++b) {
+        while(!buckets[b].empty()) {
+
+          // skip the vertices that moved to a lower bucket
+          frontier.clear();
+          for(const auto v : buckets[b]) {
+            if(bucketOf(outputDists[v]) == b) {
+              frontier.emplace_back(v);
+            }
+          }
+          buckets[b].clear();
+          TTK_PSORT(nThreads, frontier.begin(), frontier.end());
+          frontier.erase(
+            std::unique(frontier.begin(), frontier.end()), frontier.end());
+
+          offsets.resize(frontier.size() + 1);
+          offsets[0] = 0;
+          for(size_t i = 0; i < frontier.size(); ++i) {
+            offsets[i + 1]
+              = offsets[i] + triangulation.getVertexNeighborNumber(frontier[i]);
+          }
+          candidates.resize(offsets.back());
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads) schedule(dynamic, 64)
+#endif // TTK_ENABLE_OPENMP
+          for(size_t i = 0; i < frontier.size(); ++i) {
+            for(size_t j = offsets[i]; j < offsets[i + 1]; ++j) {
+              triangulation.getVertexNeighbor(
+                frontier[i], j - offsets[i], candidates[j]);
+            }
+          }
+          TTK_PSORT(nThreads, candidates.begin(), candidates.end());
+          candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                           candidates.end());
+
+          candDists.resize(candidates.size());
+          candSources.resize(candidates.size());
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads) schedule(dynamic, 64)
+#endif // TTK_ENABLE_OPENMP
+          for(size_t i = 0; i < candidates.size(); ++i) {
+            const auto v = candidates[i];
+            auto dist = outputDists[v];
+            auto source = outputSources[v];
+            const auto nneigh = triangulation.getVertexNeighborNumber(v);
+            for(SimplexId j = 0; j < nneigh; ++j) {
+              SimplexId neigh{};
+              triangulation.getVertexNeighbor(v, j, neigh);
+              if(outputSources[neigh] == -1) {
+                continue;
+              }
+              const T d = outputDists[neigh] + edgeLength(v, neigh);
+              if(d < dist || (d == dist && outputSources[neigh] < source)) {
+                dist = d;
+                source = outputSources[neigh];
+              }
+            }
+            candDists[i] = dist;
+            candSources[i] = source;
+          }
+
+          // improved vertices are re-inserted in their (new) bucket
+          for(size_t i = 0; i < candidates.size(); ++i) {
+            const auto v = candidates[i];
+            if(candSources[i] == outputSources[v]
+               && candDists[i] == outputDists[v]) {
+              continue;
+            }
+            outputDists[v] = candDists[i];
+            outputSources[v] = candSources[i];
+            const auto vb = bucketOf(candDists[i]);
+            if(vb >= buckets.size()) {
+              buckets.resize(vb + 1);
+            }
+            buckets[vb].emplace_back(v);
+          }
+        }
+        // release the memory of the processed bucket
+        std::vector<SimplexId>().swap(buckets[b]);
+      }
+
+      return 0;
+    }
+
   } // namespace Dijkstra
 } // namespace ttk
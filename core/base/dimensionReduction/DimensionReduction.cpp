@@ -1,6 +1,12 @@
 #include <DimensionReduction.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <map>
+#include <queue>
 
 #define VALUE_TO_STRING(x) #x
 #define VALUE(x) VALUE_TO_STRING(x)
@@ -55,6 +61,28 @@ int DimensionReduction::execute(
   const int nRows,
   const int nColumns) const {
 
+  if(this->isNativeMethod()) {
+    Timer tm{};
+    int ret{};
+    std::string name{};
+    if(this->Method == METHOD::PCA) {
+      name = "PCA";
+      ret = this->computePCA(outputEmbedding, inputMatrix, nRows, nColumns);
+    } else if(this->Method == METHOD::MDS) {
+      name = "MDS";
+      ret = this->computeMDS(outputEmbedding, inputMatrix, nRows, nColumns);
+    } else {
+      name = "IsoMap";
+      ret
+        = this->computeIsomap(outputEmbedding, inputMatrix, nRows, nColumns);
+    }
+    if(ret == 0) {
+      this->printMsg("Computed " + name + " (native)", 1.0,
+                     tm.getElapsedTime(), this->threadNumber_);
+    }
+    return ret;
+  }
+
 #ifdef TTK_ENABLE_SCIKIT_LEARN
 #ifndef TTK_ENABLE_KAMIKAZE
   if(majorVersion_ < '3')
@@ -374,3 +402,660 @@ collect_garbage:
 
   return 0;
 }
+
+bool DimensionReduction::isNativeMethod() const {
+  const bool hasNative = this->Method == METHOD::PCA
+                         || this->Method == METHOD::MDS
+                         || this->Method == METHOD::ISOMAP;
+#ifdef TTK_ENABLE_SCIKIT_LEARN
+  return hasNative && this->UseNativeImplementation;
+#else
+  return hasNative;
+#endif
+}
+
+namespace {
+
+  /**
+   * @brief Eigenvalues and eigenvectors of a symmetric tridiagonal
+   * matrix (implicit QL algorithm)
+   *
+   * @param[in,out] diag Diagonal, eigenvalues on output
+   * @param[in,out] offDiag Sub-diagonal (offDiag[i] = T(i, i + 1), last
+   * element unused), destroyed on output
+   * @param[out] vecs Eigenvectors (column j for eigenvalue j, row-major)
+   * @return 0 in case of success
+   */
+  int tridiagonalEigen(std::vector<double> &diag,
+                       std::vector<double> &offDiag,
+                       std::vector<double> &vecs) {
+    const int n = diag.size();
+    vecs.assign(n * n, 0.0);
+    for(int i = 0; i < n; ++i) {
+      vecs[i * n + i] = 1.0;
+    }
+    offDiag[n - 1] = 0.0;
+
+    for(int l = 0; l < n; ++l) {
+      int iter{};
+      int m{};
+      do {
+        for(m = l; m < n - 1; ++m) {
+          const auto dd = std::abs(diag[m]) + std::abs(diag[m + 1]);
+          if(std::abs(offDiag[m])
+             <= std::numeric_limits<double>::epsilon() * dd) {
+            break;
+          }
+        }
+        if(m == l) {
+          break;
+        }
+        if(iter++ == 64) {
+          return 1;
+        }
+        double g = (diag[l + 1] - diag[l]) / (2.0 * offDiag[l]);
+        double r = std::hypot(g, 1.0);
+        g = diag[m] - diag[l] + offDiag[l] / (g + std::copysign(r, g));
+        double s{1.0}, c{1.0}, p{};
+        int i{};
+        for(i = m - 1; i >= l; --i) {
+          const double f = s * offDiag[i];
+          const double b = c * offDiag[i];
+          r = std::hypot(f, g);
+          offDiag[i + 1] = r;
+          if(r == 0.0) {
+            diag[i + 1] -= p;
+            offDiag[m] = 0.0;
+            break;
+          }
+          s = f / r;
+          c = g / r;
+          g = diag[i + 1] - p;
+          r = (diag[i] - g) * s + 2.0 * c * b;
+          p = s * r;
+          diag[i + 1] = g + p;
+          g = c * r - b;
+          for(int k = 0; k < n; ++k) {
+            const auto vk = &vecs[k * n];
+            const double t = vk[i + 1];
+            vk[i + 1] = s * vk[i] + c * t;
+            vk[i] = c * vk[i] - s * t;
+          }
+        }
+        if(r == 0.0 && i >= l) {
+          continue;
+        }
+        diag[l] -= p;
+        offDiag[l] = g;
+        offDiag[m] = 0.0;
+      } while(m != l);
+    }
+
+    return 0;
+  }
+
+  /**
+   * @brief Largest (algebraic) eigenpairs of a symmetric operator
+   *
+   * Lanczos iterations with full re-orthogonalization. The Krylov
+   * subspace size is doubled until the Ritz pairs converge, up to
+   * the dimension of the operator (exact decomposition).
+   *
+   * @param[in] matVec Computes out = A * in (vectors of size @p n)
+   * @param[in] n Dimension of the operator
+   * @param[in] nEigen Number of wanted eigenpairs
+   * @param[out] values Eigenvalues, by decreasing order
+   * @param[out] vectors Unit eigenvectors (@p nEigen rows of size @p n),
+   * the largest component of each being positive
+   * @param[in] nThreads Number of threads
+   * @return 0 in case of success
+   */
+  template <typename MatVec>
+  int largestEigenpairs(const MatVec &matVec,
+                        const size_t n,
+                        const size_t nEigen,
+                        std::vector<double> &values,
+                        std::vector<std::vector<double>> &vectors,
+                        const int nThreads) {
+
+    TTK_FORCE_USE(nThreads);
+
+    const auto dot = [n](const double *const a, const double *const b) {
+      double res{};
+      for(size_t i = 0; i < n; ++i) {
+        res += a[i] * b[i];
+      }
+      return res;
+    };
+
+    // deterministic starting vectors
+    uint64_t seed{42};
+    const auto random = [&seed]() {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      return static_cast<double>(seed >> 11) / (1ULL << 53) - 0.5;
+    };
+
+    const double tolerance{1e-10};
+    size_t m = std::min(n, std::max<size_t>(2 * nEigen + 20, 64));
+    std::vector<double> basis{}, alpha{}, beta{}, diag{}, offDiag{}, ritz{};
+    std::vector<double> w(n);
+
+    while(true) {
+      basis.assign(m * n, 0.0);
+      alpha.assign(m, 0.0);
+      beta.assign(m, 0.0);
+
+      size_t j{};
+      for(; j < m; ++j) {
+        const auto vj = &basis[j * n];
+        if(j == 0 || beta[j - 1] == 0.0) {
+          // (re)start from a random vector orthogonal to the basis
+          for(size_t i = 0; i < n; ++i) {
+            vj[i] = random();
+          }
+          for(int pass = 0; pass < 2; ++pass) {
+            for(size_t k = 0; k < j; ++k) {
+              const auto vk = &basis[k * n];
+              const auto proj = dot(vk, vj);
+              for(size_t i = 0; i < n; ++i) {
+                vj[i] -= proj * vk[i];
+              }
+            }
+          }
+          const auto norm = std::sqrt(dot(vj, vj));
+          if(norm == 0.0) {
+            break;
+          }
+          for(size_t i = 0; i < n; ++i) {
+            vj[i] /= norm;
+          }
+        }
+
+        matVec(vj, w.data());
+        alpha[j] = dot(vj, w.data());
+        // full re-orthogonalization (twice is enough)
+        for(int pass = 0; pass < 2; ++pass) {
+          for(size_t k = 0; k <= j; ++k) {
+            const auto vk = &basis[k * n];
+            const auto proj = dot(vk, w.data());
+            for(size_t i = 0; i < n; ++i) {
+              w[i] -= proj * vk[i];
+            }
+          }
+        }
+        beta[j] = std::sqrt(dot(w.data(), w.data()));
+        if(j + 1 < m) {
+          if(beta[j] <= tolerance * std::max(1.0, std::abs(alpha[j]))) {
+            // invariant subspace found
+            beta[j] = 0.0;
+          } else {
+            const auto vNext = &basis[(j + 1) * n];
+            for(size_t i = 0; i < n; ++i) {
+              vNext[i] = w[i] / beta[j];
+            }
+          }
+        }
+      }
+      const auto size = j;
+
+      diag.assign(alpha.begin(), alpha.begin() + size);
+      offDiag.assign(beta.begin(), beta.begin() + size);
+      if(tridiagonalEigen(diag, offDiag, ritz) != 0) {
+        return 1;
+      }
+
+      std::vector<size_t> order(size);
+      for(size_t i = 0; i < size; ++i) {
+        order[i] = i;
+      }
+      std::sort(order.begin(), order.end(),
+                [&diag](const size_t a, const size_t b) {
+                  return diag[a] > diag[b];
+                });
+      const auto nFound = std::min(nEigen, size);
+
+      // residual of the Ritz pairs
+      double scale{};
+      for(size_t i = 0; i < size; ++i) {
+        scale = std::max(scale, std::abs(diag[i]));
+      }
+      bool converged{true};
+      for(size_t e = 0; e < nFound && size < n; ++e) {
+        const auto res = std::abs(beta[size - 1] * ritz[(size - 1) * size
+                                                         + order[e]]);
+        converged = converged && res <= 1e-8 * std::max(scale, 1e-300);
+      }
+
+      if(converged || m == n) {
+        values.resize(nFound);
+        vectors.resize(nFound);
+        for(size_t e = 0; e < nFound; ++e) {
+          values[e] = diag[order[e]];
+          auto &vec = vectors[e];
+          vec.assign(n, 0.0);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+          for(size_t i = 0; i < n; ++i) {
+            for(size_t k = 0; k < size; ++k) {
+              vec[i] += basis[k * n + i] * ritz[k * size + order[e]];
+            }
+          }
+          // sign convention
+          size_t iMax{};
+          for(size_t i = 0; i < n; ++i) {
+            if(std::abs(vec[i]) > std::abs(vec[iMax])) {
+              iMax = i;
+            }
+          }
+          if(vec[iMax] < 0.0) {
+            for(auto &v : vec) {
+              v = -v;
+            }
+          }
+        }
+        return 0;
+      }
+      m = std::min(n, 2 * m);
+    }
+  }
+
+  /**
+   * @brief Parallel product of a dense symmetric matrix with a vector
+   */
+  struct DenseMatVec {
+    const std::vector<double> &matrix;
+    const size_t n;
+    const int nThreads;
+
+    void operator()(const double *const in, double *const out) const {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 0; i < n; ++i) {
+        const auto row = &matrix[i * n];
+        double res{};
+        for(size_t j = 0; j < n; ++j) {
+          res += row[j] * in[j];
+        }
+        out[i] = res;
+      }
+    }
+  };
+
+  /**
+   * @brief Double-center a matrix of squared distances: B = -1/2 J D J
+   */
+  void doubleCenter(std::vector<double> &sqDists,
+                    const size_t n,
+                    const int nThreads) {
+    TTK_FORCE_USE(nThreads);
+
+    std::vector<double> rowMeans(n);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < n; ++i) {
+      double sum{};
+      for(size_t j = 0; j < n; ++j) {
+        sum += sqDists[i * n + j];
+      }
+      rowMeans[i] = sum / n;
+    }
+    double mean{};
+    for(const auto m : rowMeans) {
+      mean += m;
+    }
+    mean /= n;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < n; ++i) {
+      for(size_t j = 0; j < n; ++j) {
+        sqDists[i * n + j]
+          = -0.5 * (sqDists[i * n + j] - rowMeans[i] - rowMeans[j] + mean);
+      }
+    }
+  }
+
+  /**
+   * @brief Classical scaling of a matrix of squared distances
+   *
+   * @param[in,out] sqDists Squared distances (double-centered on output)
+   * @param[out] values Eigenvalues of the centered matrix
+   * @param[out] vectors Eigenvectors of the centered matrix
+   */
+  int classicalScaling(std::vector<double> &sqDists,
+                       const size_t n,
+                       const size_t nComponents,
+                       std::vector<double> &values,
+                       std::vector<std::vector<double>> &vectors,
+                       const int nThreads) {
+    doubleCenter(sqDists, n, nThreads);
+    return largestEigenpairs(DenseMatVec{sqDists, n, nThreads}, n,
+                             nComponents, values, vectors, nThreads);
+  }
+
+  /**
+   * @brief Squared Euclidean distance between two rows
+   */
+  inline double sqDistance(const double *const a,
+                           const double *const b,
+                           const int dim) {
+    double res{};
+    for(int k = 0; k < dim; ++k) {
+      res += (a[k] - b[k]) * (a[k] - b[k]);
+    }
+    return res;
+  }
+
+} // namespace
+
+int DimensionReduction::computePCA(
+  std::vector<std::vector<double>> &outputEmbedding,
+  const std::vector<double> &inputMatrix,
+  const int nRows,
+  const int nColumns) const {
+
+  const size_t nComponents = std::max(2, this->NumberOfComponents);
+
+  // centered data, and its transpose for the covariance products
+  std::vector<double> centered(inputMatrix), transposed(inputMatrix.size());
+  std::vector<double> means(nColumns);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(int j = 0; j < nColumns; ++j) {
+    for(int i = 0; i < nRows; ++i) {
+      means[j] += inputMatrix[i * nColumns + j];
+    }
+    means[j] /= nRows;
+    for(int i = 0; i < nRows; ++i) {
+      centered[i * nColumns + j] -= means[j];
+      transposed[j * nRows + i] = centered[i * nColumns + j];
+    }
+  }
+
+  // covariance operator Xt * X / (n - 1), never formed explicitly
+  std::vector<double> tmp(nRows);
+  const auto covariance = [&](const double *const in, double *const out) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(int i = 0; i < nRows; ++i) {
+      double res{};
+      for(int j = 0; j < nColumns; ++j) {
+        res += centered[i * nColumns + j] * in[j];
+      }
+      tmp[i] = res;
+    }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(int j = 0; j < nColumns; ++j) {
+      double res{};
+      for(int i = 0; i < nRows; ++i) {
+        res += transposed[j * nRows + i] * tmp[i];
+      }
+      out[j] = res / std::max(nRows - 1, 1);
+    }
+  };
+
+  std::vector<double> values{};
+  std::vector<std::vector<double>> axes{};
+  if(largestEigenpairs(covariance, nColumns, nComponents, values, axes,
+                       this->threadNumber_)
+     != 0) {
+    this->printErr("Eigen decomposition did not converge");
+    return -1;
+  }
+
+  // project on the principal axes (zeros beyond the data dimension)
+  outputEmbedding.assign(nComponents, std::vector<double>(nRows, 0.0));
+  for(size_t c = 0; c < axes.size(); ++c) {
+    auto &comp = outputEmbedding[c];
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(int i = 0; i < nRows; ++i) {
+      double res{};
+      for(int j = 0; j < nColumns; ++j) {
+        res += centered[i * nColumns + j] * axes[c][j];
+      }
+      comp[i] = res;
+    }
+    if(this->pca_Whiten && values[c] > 0.0) {
+      const auto stdDev = std::sqrt(values[c]);
+      for(auto &v : comp) {
+        v /= stdDev;
+      }
+    }
+  }
+
+  return 0;
+}
+
+int DimensionReduction::computeMDS(
+  std::vector<std::vector<double>> &outputEmbedding,
+  const std::vector<double> &inputMatrix,
+  const int nRows,
+  const int nColumns) const {
+
+  const size_t nComponents = std::max(2, this->NumberOfComponents);
+  const bool isDistanceMatrix = this->mds_Dissimilarity == "precomputed";
+  if(isDistanceMatrix && nRows != nColumns) {
+    this->printErr("Input distance matrix is not square");
+    return -1;
+  }
+  const size_t n = nRows;
+
+  const auto sqDist = [&](const size_t i, const size_t j) {
+    if(isDistanceMatrix) {
+      const auto d = inputMatrix[i * n + j];
+      return d * d;
+    }
+    return sqDistance(
+      &inputMatrix[i * nColumns], &inputMatrix[j * nColumns], nColumns);
+  };
+
+  // landmarks: the first point then farthest point sampling
+  std::vector<size_t> landmarks{};
+  if(this->mds_LandmarkNumber > 0
+     && static_cast<size_t>(this->mds_LandmarkNumber) < n) {
+    const size_t nLandmarks
+      = std::max<size_t>(this->mds_LandmarkNumber, nComponents + 1);
+    std::vector<double> minSqDist(n, std::numeric_limits<double>::max());
+    landmarks.emplace_back(0);
+    while(landmarks.size() < nLandmarks) {
+      const auto last = landmarks.back();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 0; i < n; ++i) {
+        minSqDist[i] = std::min(minSqDist[i], sqDist(last, i));
+      }
+      landmarks.emplace_back(
+        std::max_element(minSqDist.begin(), minSqDist.end())
+        - minSqDist.begin());
+    }
+  } else {
+    landmarks.resize(n);
+    for(size_t i = 0; i < n; ++i) {
+      landmarks[i] = i;
+    }
+  }
+  const auto nLandmarks = landmarks.size();
+
+  std::vector<double> sqDists(nLandmarks * nLandmarks);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < nLandmarks; ++i) {
+    for(size_t j = 0; j < nLandmarks; ++j) {
+      sqDists[i * nLandmarks + j] = sqDist(landmarks[i], landmarks[j]);
+    }
+  }
+  // mean squared distance to the landmarks, for the triangulation
+  std::vector<double> colMeans(nLandmarks);
+  for(size_t i = 0; i < nLandmarks; ++i) {
+    for(size_t j = 0; j < nLandmarks; ++j) {
+      colMeans[j] += sqDists[i * nLandmarks + j] / nLandmarks;
+    }
+  }
+
+  std::vector<double> values{};
+  std::vector<std::vector<double>> vectors{};
+  if(classicalScaling(sqDists, nLandmarks, nComponents, values, vectors,
+                      this->threadNumber_)
+     != 0) {
+    this->printErr("Eigen decomposition did not converge");
+    return -1;
+  }
+
+  outputEmbedding.assign(nComponents, std::vector<double>(n, 0.0));
+  for(size_t c = 0; c < values.size(); ++c) {
+    if(values[c] <= 0.0) {
+      this->printWrn("Non-positive eigenvalue, component "
+                     + std::to_string(c) + " is set to 0");
+      continue;
+    }
+    const auto sqrtVal = std::sqrt(values[c]);
+    auto &comp = outputEmbedding[c];
+    if(nLandmarks == n) {
+      for(size_t i = 0; i < n; ++i) {
+        comp[i] = vectors[c][i] * sqrtVal;
+      }
+      continue;
+    }
+    // distance-based triangulation from the landmarks
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < n; ++i) {
+      double res{};
+      for(size_t l = 0; l < nLandmarks; ++l) {
+        res += vectors[c][l] * (sqDist(i, landmarks[l]) - colMeans[l]);
+      }
+      comp[i] = -0.5 * res / sqrtVal;
+    }
+  }
+
+  return 0;
+}
+
+int DimensionReduction::computeIsomap(
+  std::vector<std::vector<double>> &outputEmbedding,
+  const std::vector<double> &inputMatrix,
+  const int nRows,
+  const int nColumns) const {
+
+  const size_t nComponents = std::max(2, this->NumberOfComponents);
+  const bool isDistanceMatrix = this->iso_Metric == "precomputed";
+  if(isDistanceMatrix && nRows != nColumns) {
+    this->printErr("Input distance matrix is not square");
+    return -1;
+  }
+  const size_t n = nRows;
+  const size_t k
+    = std::min<size_t>(std::max(1, this->NumberOfNeighbors), n - 1);
+
+  const auto dist = [&](const size_t i, const size_t j) {
+    if(isDistanceMatrix) {
+      return inputMatrix[i * n + j];
+    }
+    return std::sqrt(sqDistance(
+      &inputMatrix[i * nColumns], &inputMatrix[j * nColumns], nColumns));
+  };
+
+  // symmetric k-nearest neighbors graph
+  using Edge = std::pair<double, size_t>;
+  std::vector<std::vector<Edge>> graph(n);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  {
+    std::vector<Edge> candidates{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < n; ++i) {
+      candidates.clear();
+      for(size_t j = 0; j < n; ++j) {
+        if(j != i) {
+          candidates.emplace_back(dist(i, j), j);
+        }
+      }
+      std::partial_sort(
+        candidates.begin(), candidates.begin() + k, candidates.end());
+      graph[i].assign(candidates.begin(), candidates.begin() + k);
+    }
+  }
+  for(size_t i = 0; i < n; ++i) {
+    for(size_t e = 0; e < k; ++e) {
+      const auto &edge = graph[i][e];
+      graph[edge.second].emplace_back(edge.first, i);
+    }
+  }
+
+  // all pairs of geodesic distances (one Dijkstra per vertex)
+  std::vector<double> sqDists(n * n, std::numeric_limits<double>::max());
+  bool isConnected{true};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  {
+    std::priority_queue<Edge, std::vector<Edge>, std::greater<Edge>> pq{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic) reduction(&& : isConnected)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t s = 0; s < n; ++s) {
+      const auto row = &sqDists[s * n];
+      row[s] = 0.0;
+      pq.emplace(0.0, s);
+      while(!pq.empty()) {
+        const auto elem = pq.top();
+        pq.pop();
+        if(elem.first > row[elem.second]) {
+          continue;
+        }
+        for(const auto &edge : graph[elem.second]) {
+          const auto d = elem.first + edge.first;
+          if(d < row[edge.second]) {
+            row[edge.second] = d;
+            pq.emplace(d, edge.second);
+          }
+        }
+      }
+      for(size_t i = 0; i < n; ++i) {
+        isConnected
+          = isConnected && row[i] != std::numeric_limits<double>::max();
+        row[i] *= row[i];
+      }
+    }
+  }
+  if(!isConnected) {
+    this->printErr("The neighborhood graph is not connected, try to "
+                   "increase the number of neighbors");
+    return -1;
+  }
+
+  std::vector<double> values{};
+  std::vector<std::vector<double>> vectors{};
+  if(classicalScaling(
+       sqDists, n, nComponents, values, vectors, this->threadNumber_)
+     != 0) {
+    this->printErr("Eigen decomposition did not converge");
+    return -1;
+  }
+
+  outputEmbedding.assign(nComponents, std::vector<double>(n, 0.0));
+  for(size_t c = 0; c < values.size(); ++c) {
+    const auto sqrtVal = std::sqrt(std::max(values[c], 0.0));
+    for(size_t i = 0; i < n; ++i) {
+      outputEmbedding[c][i] = vectors[c][i] * sqrtVal;
+    }
+  }
+
+  return 0;
+}
@@ -11,6 +11,11 @@
 /// \brief TTK VTK-filter that takes a matrix (vtkTable) as input and apply a
 /// dimension reduction algorithm from scikit-learn.
 ///
+/// Principal Component Analysis, (classical or landmark) Multi-Dimensional
+/// Scaling and Isomap also have a native, parallel implementation that does
+/// not require Python. It is used when scikit-learn support is disabled or
+/// when requested with setUseNativeImplementation().
+///
 /// \sa ttk::Triangulation
 /// \sa ttkDimensionReduction.cpp %for a usage example.
 ///
@@ -42,6 +47,9 @@
 
 #include <Debug.h>
 
+#include <string>
+#include <vector>
+
 namespace ttk {
 
   class DimensionReduction : virtual public Debug {
@@ -162,6 +170,30 @@ namespace ttk {
       pca_MaxIteration = MaxIteration;
     }
 
+    /**
+     * @brief Use the native implementation of PCA, MDS and Isomap
+     * instead of scikit-learn
+     *
+     * The native MDS is the classical (Torgerson) scaling instead of
+     * the SMACOF algorithm of scikit-learn.
+     */
+    inline void setUseNativeImplementation(const bool useNative) {
+      this->UseNativeImplementation = useNative;
+    }
+
+    /**
+     * @brief Number of landmarks of the native MDS (0 for all the
+     * points)
+     *
+     * Landmark MDS only embeds the landmarks with the classical
+     * scaling, the other points are then placed from their distances
+     * to the landmarks. Memory and time then grow linearly with the
+     * number of points.
+     */
+    inline void setMDSLandmarkNumber(const int landmarkNumber) {
+      this->mds_LandmarkNumber = landmarkNumber;
+    }
+
     inline void setInputModulePath(const std::string &modulePath) {
       ModulePath = modulePath;
     }
@@ -206,12 +238,43 @@ namespace ttk {
 
     bool isPythonFound() const;
 
+    /**
+     * @brief Whether the current method is computed natively (without
+     * Python)
+     */
+    bool isNativeMethod() const;
+
     int execute(std::vector<std::vector<double>> &outputEmbedding,
                 const std::vector<double> &inputMatrix,
                 const int nRows,
                 const int nColumns) const;
 
   protected:
+    /**
+     * @brief Principal Component Analysis (rows as points)
+     */
+    int computePCA(std::vector<std::vector<double>> &outputEmbedding,
+                   const std::vector<double> &inputMatrix,
+                   const int nRows,
+                   const int nColumns) const;
+
+    /**
+     * @brief Classical or landmark Multi-Dimensional Scaling
+     */
+    int computeMDS(std::vector<std::vector<double>> &outputEmbedding,
+                   const std::vector<double> &inputMatrix,
+                   const int nRows,
+                   const int nColumns) const;
+
+    /**
+     * @brief Isomap: classical scaling of the geodesic distances in the
+     * k-nearest neighbors graph
+     */
+    int computeIsomap(std::vector<std::vector<double>> &outputEmbedding,
+                      const std::vector<double> &inputMatrix,
+                      const int nRows,
+                      const int nColumns) const;
+
     // se
     std::string se_Affinity{"nearest_neighbors"};
     float se_Gamma{1};
@@ -234,6 +297,7 @@ namespace ttk {
     int mds_Verbose{0};
     float mds_Epsilon{0};
     std::string mds_Dissimilarity{"euclidean"};
+    int mds_LandmarkNumber{0};
 
     // tsne
     float tsne_Perplexity{30};
@@ -268,6 +332,7 @@ namespace ttk {
     std::string ModuleName{"dimensionReduction"};
     std::string FunctionName{"doIt"};
 
+    bool UseNativeImplementation{false};
     METHOD Method{METHOD::MDS};
     int NumberOfComponents{2};
     int NumberOfNeighbors{5};
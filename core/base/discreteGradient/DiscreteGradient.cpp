@@ -237,22 +237,14 @@ int DiscreteGradient::setManifoldSize(
 #ifdef TTK_ENABLE_MPI
 void DiscreteGradient::setCellToGhost(const int cellDim,
                                       const SimplexId cellId) {
-  if(cellDim == 0) {
-    (*gradient_)[0][cellId] = GHOST_GRADIENT;
-  }
-
-  if(cellDim == 1) {
-    (*gradient_)[1][cellId] = GHOST_GRADIENT;
-    (*gradient_)[2][cellId] = GHOST_GRADIENT;
-  }
-
-  if(cellDim == 2) {
-    (*gradient_)[3][cellId] = GHOST_GRADIENT;
-    (*gradient_)[4][cellId] = GHOST_GRADIENT;
-  }
-
-  if(cellDim == 3) {
-    (*gradient_)[5][cellId] = GHOST_GRADIENT;
+  // the gradient of a d-cell is stored in (*gradient_)[2 * d - 1]
+  // (paired facet) and (*gradient_)[2 * d] (paired co-facet), the
+  // latter being absent for the cells of maximal dimension
+  if(cellDim > 0) {
+    (*gradient_)[2 * cellDim - 1][cellId] = GHOST_GRADIENT;
+  }
+  if(cellDim < this->dimensionality_) {
+    (*gradient_)[2 * cellDim][cellId] = GHOST_GRADIENT;
   }
 }
 #endif
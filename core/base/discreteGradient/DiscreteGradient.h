@@ -25,6 +25,7 @@
 #include <functional>
 #include <queue>
 #include <set>
+#include <type_traits>
 #include <utility>
 
 namespace ttk {
@@ -80,6 +81,45 @@ namespace ttk {
       bool paired_{false};
     };
 
+    /**
+     * @brief Star of the interior vertices of a regular grid
+     *
+     * Around an interior vertex of an implicit triangulation, the
+     * simplices follow the same pattern: their vertices are at constant
+     * offsets of the vertex id and their ids are affine functions of
+     * the vertex grid coordinates. The stencil stores this pattern (in
+     * the local order of the triangulation queries) so that the lower
+     * star of interior vertices is built without triangulation calls.
+     *
+     * Only the non-trivial grid axes are considered: @p dim is the grid
+     * dimensionality (2 or 3).
+     */
+    template <int dim>
+    struct GridStencil {
+      struct Simplex {
+        // simplex id around the reference vertex
+        SimplexId id_{};
+        // id increment for a unit step of the vertex along each axis
+        std::array<SimplexId, dim> steps_{};
+        // id offsets of the other vertices of the simplex
+        std::array<SimplexId, 3> verts_{};
+        // stencil indices of the faces containing the vertex
+        std::array<uint8_t, 3> faces_{};
+      };
+
+      // number of vertices along the grid axes
+      std::array<SimplexId, dim> gridDim_{};
+      // vertex id increment for a unit step along each axis
+      std::array<SimplexId, dim> vertStep_{};
+      // grid coordinates of the reference vertex
+      std::array<SimplexId, dim> ref_{};
+
+      std::array<Simplex, dim == 3 ? 14 : 6> edges_{};
+      // vertex triangles in 3D, vertex stars in 2D
+      std::array<Simplex, dim == 3 ? 36 : 6> triangles_{};
+      std::array<Simplex, dim == 3 ? 24 : 0> tetras_{};
+    };
+
     /**
      * Compute and manage a discrete gradient of a function on a triangulation.
      * TTK assumes that the input dataset is made of only one connected
@@ -155,6 +195,7 @@ triangulation.
        * @brief Use local storage instead of cache
        */
       inline void setLocalGradient() {
+        this->cachedGradient_.reset();
         this->gradient_ = &this->localGradient_;
       }
 
@@ -384,6 +425,40 @@ in the gradient.
                             const SimplexId *const offsets,
                             const triangulationType &triangulation) const;
 
+      /**
+       * @brief Store the lower star of an interior vertex of a regular
+       * grid using a precomputed stencil
+       *
+       * @return false if @p a is on the grid boundary (lower star not
+       * computed)
+       */
+      template <int dim>
+      inline bool lowerStar(lowerStarType &ls,
+                            const SimplexId a,
+                            const SimplexId *const offsets,
+                            const GridStencil<dim> &stencil) const;
+
+      /**
+       * @brief Compute the interior vertex stencil of a regular grid
+       *
+       * @return false if the triangulation is not an implicit grid of
+       * dimension @p dim or if the grid is too small to hold interior
+       * vertices
+       */
+      template <int dim, typename triangulationType>
+      bool buildGridStencil(GridStencil<dim> &stencil,
+                            const triangulationType &triangulation) const;
+      template <int dim, typename triangulationType>
+      bool buildGridStencil(GridStencil<dim> &stencil,
+                            const triangulationType &triangulation,
+                            std::true_type /* implicit grid */) const;
+      template <int dim, typename triangulationType>
+      bool buildGridStencil(GridStencil<dim> &ttkNotUsed(stencil),
+                            const triangulationType &ttkNotUsed(triangulation),
+                            std::false_type /* implicit grid */) const {
+        return false;
+      }
+
       /**
        * @brief Return the number of unpaired faces of a given cell in
        * a lower star
@@ -428,6 +503,15 @@ in the gradient.
       int processLowerStars(const SimplexId *const offsets,
                             const triangulationType &triangulation);
 
+      /**
+       * @brief ProcessLowerStars main loop, the lower stars of the
+       * interior vertices being computed with @p stencil if not null
+       */
+      template <int dim, typename triangulationType>
+      int processLowerStars(const SimplexId *const offsets,
+                            const triangulationType &triangulation,
+                            const GridStencil<dim> *const stencil);
+
       /**
        * @brief Initialize/Allocate discrete gradient memory
        */
@@ -505,8 +589,11 @@ gradient, false otherwise.
       AbstractTriangulation::gradientType localGradient_{};
       // cache key (scalar field pointer + timestamp)
       AbstractTriangulation::gradientKeyType inputScalarField_{};
-      // pointer to either cache entry corresponding to inputScalarField_ or
-      // localGradient_ (if cache is bypassed)
+      // reference on the cache entry corresponding to inputScalarField_
+      // (keeps it alive if evicted from the cache)
+      std::shared_ptr<AbstractTriangulation::gradientType> cachedGradient_{};
+      // pointer to either cachedGradient_ or localGradient_ (if cache is
+      // bypassed)
       AbstractTriangulation::gradientType *gradient_{};
       const SimplexId *inputOffsets_{};
     };
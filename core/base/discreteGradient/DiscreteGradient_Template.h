@@ -37,33 +37,31 @@ int DiscreteGradient::buildGradient(const triangulationType &triangulation,
                                     bool bypassCache) {
 
   auto &cacheHandler = *triangulation.getGradientCacheHandler();
-  const auto findGradient
-    = [this, &cacheHandler]() -> AbstractTriangulation::gradientType * {
-    if(this->inputScalarField_.first == nullptr) {
-      return {};
-    }
-    return cacheHandler.get(this->inputScalarField_);
-  };
 
-#ifdef TTK_ENABLE_OPENMP
-  if(!bypassCache && omp_in_parallel()) {
-    this->printWrn(
-      "buildGradient() called inside a parallel region, disabling cache...");
+  // no cache key
+  if(this->inputScalarField_.first == nullptr) {
     bypassCache = true;
   }
-#endif // TTK_ENABLE_OPENMP
 
   // set member variables at each buildGradient() call
   this->dimensionality_ = triangulation.getCellVertexNumber(0) - 1;
   this->numberOfVertices_ = triangulation.getNumberOfVertices();
 
-  this->gradient_ = bypassCache ? &this->localGradient_ : findGradient();
-  if(this->gradient_ == nullptr || bypassCache) {
+  // the cache is thread-safe and its entries are reference-counted:
+  // another filter evicting or computing a gradient concurrently does
+  // not affect this one
+  this->cachedGradient_
+    = bypassCache ? nullptr : cacheHandler.get(this->inputScalarField_);
 
-    if(!bypassCache) {
-      // add new cache entry
-      cacheHandler.insert(this->inputScalarField_, {});
-      this->gradient_ = cacheHandler.get(this->inputScalarField_);
+  if(this->cachedGradient_ == nullptr) {
+
+    if(bypassCache) {
+      this->gradient_ = &this->localGradient_;
+    } else {
+      // new entry, only inserted in the cache once computed
+      this->cachedGradient_
+        = std::make_shared<AbstractTriangulation::gradientType>();
+      this->gradient_ = this->cachedGradient_.get();
     }
 
     // allocate gradient memory
@@ -75,10 +73,33 @@ int DiscreteGradient::buildGradient(const triangulationType &triangulation,
 
     this->printMsg(
       "Built discrete gradient", 1.0, tm.getElapsedTime(), this->threadNumber_);
+
+    if(!bypassCache) {
+      size_t footprint{};
+      for(const auto &vec : *this->gradient_) {
+        footprint += vec.size() * sizeof(AbstractTriangulation::gradIdType);
+      }
+      // use the entry of a concurrent call with the same key, if any
+      this->cachedGradient_ = cacheHandler.insert(
+        this->inputScalarField_, this->cachedGradient_, footprint);
+      this->gradient_ = this->cachedGradient_.get();
+    }
   } else {
+    this->gradient_ = this->cachedGradient_.get();
     this->printMsg("Fetched cached discrete gradient");
   }
 
+  if(!bypassCache) {
+    const auto stats{cacheHandler.getStatistics()};
+    this->printMsg("Gradient cache: " + std::to_string(stats.hits) + " hits, "
+                     + std::to_string(stats.misses) + " misses, "
+                     + std::to_string(stats.evictions) + " evictions, "
+                     + std::to_string(stats.size) + " entries ("
+                     + std::to_string(stats.footprint / (1024 * 1024))
+                     + " MB)",
+                   debug::Priority::DETAIL);
+  }
+
   return 0;
 }
 
@@ -389,6 +410,297 @@ inline void
   }
 }
 
+template <int dim>
+inline bool
+  DiscreteGradient::lowerStar(lowerStarType &ls,
+                              const SimplexId a,
+                              const SimplexId *const offsets,
+                              const GridStencil<dim> &stencil) const {
+
+  // grid coordinates, relative to the stencil reference vertex
+  std::array<SimplexId, dim> delta{};
+  SimplexId rem{a};
+  for(int i = 0; i < dim; ++i) {
+    const auto c = i == dim - 1 ? rem : rem % stencil.gridDim_[i];
+    if(c < 1 || c > stencil.gridDim_[i] - 2) {
+      // boundary vertex
+      return false;
+    }
+    delta[i] = c - stencil.ref_[i];
+    rem /= stencil.gridDim_[i];
+  }
+
+  const auto simplexId = [&delta](const typename GridStencil<dim>::Simplex &s) {
+    SimplexId res{s.id_};
+    for(int i = 0; i < dim; ++i) {
+      res += delta[i] * s.steps_[i];
+    }
+    return res;
+  };
+
+  for(auto &vec : ls) {
+    vec.clear();
+  }
+
+  const auto offset = offsets[a];
+  ls[0].emplace_back(CellExt{0, a});
+
+  // position in the lower star of the stencil edges and triangles
+  std::array<uint8_t, std::tuple_size<decltype(stencil.edges_)>::value>
+    edgePos{};
+  std::array<uint8_t, std::tuple_size<decltype(stencil.triangles_)>::value>
+    trianglePos{};
+
+  for(size_t i = 0; i < stencil.edges_.size(); ++i) {
+    const auto &e = stencil.edges_[i];
+    const auto o = offsets[a + e.verts_[0]];
+    if(o < offset) {
+      edgePos[i] = ls[1].size();
+      ls[1].emplace_back(CellExt{1, simplexId(e), {o, -1, -1}, {}});
+    }
+  }
+
+  if(ls[1].size() < 2) {
+    // at least two edges in the lower star for one triangle
+    return true;
+  }
+
+  for(size_t i = 0; i < stencil.triangles_.size(); ++i) {
+    const auto &t = stencil.triangles_[i];
+    const auto o0 = offsets[a + t.verts_[0]];
+    const auto o1 = offsets[a + t.verts_[1]];
+    if(o0 < offset && o1 < offset) { // triangle in lowerStar
+      // higher order vertex first, faces by increasing position
+      const std::array<SimplexId, 3> lowVerts{
+        std::max(o0, o1), std::min(o0, o1), -1};
+      const auto f0 = edgePos[t.faces_[0]];
+      const auto f1 = edgePos[t.faces_[1]];
+      const std::array<uint8_t, 3> faces{
+        std::min(f0, f1), std::max(f0, f1), 0};
+      trianglePos[i] = ls[2].size();
+      ls[2].emplace_back(CellExt{2, simplexId(t), lowVerts, faces});
+    }
+  }
+
+  // at least three triangles in the lower star for one tetra
+  if(ls[2].size() >= 3) {
+    for(const auto &t : stencil.tetras_) {
+      std::array<SimplexId, 3> lowVerts{offsets[a + t.verts_[0]],
+                                        offsets[a + t.verts_[1]],
+                                        offsets[a + t.verts_[2]]};
+      if(lowVerts[0] < offset && lowVerts[1] < offset
+         && lowVerts[2] < offset) { // tetra in lowerStar
+        std::array<uint8_t, 3> faces{trianglePos[t.faces_[0]],
+                                     trianglePos[t.faces_[1]],
+                                     trianglePos[t.faces_[2]]};
+        std::sort(lowVerts.rbegin(), lowVerts.rend());
+        std::sort(faces.begin(), faces.end());
+        ls[3].emplace_back(CellExt{3, simplexId(t), lowVerts, faces});
+      }
+    }
+  }
+
+  return true;
+}
+
+template <int dim, typename triangulationType>
+bool DiscreteGradient::buildGridStencil(
+  GridStencil<dim> &stencil, const triangulationType &triangulation) const {
+  return this->buildGridStencil(
+    stencil, triangulation,
+    std::is_base_of<ImplicitTriangulation, triangulationType>{});
+}
+
+template <int dim, typename triangulationType>
+bool DiscreteGradient::buildGridStencil(GridStencil<dim> &stencil,
+                                        const triangulationType &triangulation,
+                                        std::true_type) const {
+
+  if(this->dimensionality_ != dim) {
+    return false;
+  }
+
+  // keep the non-trivial grid axes
+  const auto &dims = triangulation.getGridDimensions();
+  SimplexId vertStep{1};
+  int nAxes{};
+  for(int i = 0; i < 3; ++i) {
+    if(dims[i] > 1) {
+      if(nAxes == dim || dims[i] < 4) {
+        // no room for the reference vertex and its neighbors
+        return false;
+      }
+      stencil.gridDim_[nAxes] = dims[i];
+      stencil.vertStep_[nAxes] = vertStep;
+      stencil.ref_[nAxes] = 1;
+      nAxes++;
+    }
+    vertStep *= dims[i];
+  }
+  if(nAxes != dim) {
+    return false;
+  }
+
+  // star of a vertex, as in the generic lowerStar
+  using Star = std::array<std::vector<typename GridStencil<dim>::Simplex>, 3>;
+  const auto getStar = [&triangulation](const SimplexId a, Star &star) {
+    const auto store = [a](const SimplexId id, const SimplexId *const verts,
+                           const int nVerts) {
+      typename GridStencil<dim>::Simplex s{};
+      s.id_ = id;
+      int k{};
+      for(int i = 0; i < nVerts; ++i) {
+        if(verts[i] != a && k < 3) {
+          s.verts_[k++] = verts[i] - a;
+        }
+      }
+      return s;
+    };
+    std::array<SimplexId, 4> v{};
+    for(auto &vec : star) {
+      vec.clear();
+    }
+    const auto nedges = triangulation.getVertexEdgeNumber(a);
+    for(SimplexId i = 0; i < nedges; ++i) {
+      SimplexId edgeId{};
+      triangulation.getVertexEdge(a, i, edgeId);
+      triangulation.getEdgeVertex(edgeId, 0, v[0]);
+      triangulation.getEdgeVertex(edgeId, 1, v[1]);
+      star[0].emplace_back(store(edgeId, v.data(), 2));
+    }
+    if(dim == 2) {
+      const auto ncells = triangulation.getVertexStarNumber(a);
+      for(SimplexId i = 0; i < ncells; ++i) {
+        SimplexId cellId{};
+        triangulation.getVertexStar(a, i, cellId);
+        for(int j = 0; j < 3; ++j) {
+          triangulation.getCellVertex(cellId, j, v[j]);
+        }
+        star[1].emplace_back(store(cellId, v.data(), 3));
+      }
+    } else {
+      const auto ntri = triangulation.getVertexTriangleNumber(a);
+      for(SimplexId i = 0; i < ntri; ++i) {
+        SimplexId triangleId{};
+        triangulation.getVertexTriangle(a, i, triangleId);
+        for(int j = 0; j < 3; ++j) {
+          triangulation.getTriangleVertex(triangleId, j, v[j]);
+        }
+        star[1].emplace_back(store(triangleId, v.data(), 3));
+      }
+      const auto ncells = triangulation.getVertexStarNumber(a);
+      for(SimplexId i = 0; i < ncells; ++i) {
+        SimplexId cellId{};
+        triangulation.getVertexStar(a, i, cellId);
+        for(int j = 0; j < 4; ++j) {
+          triangulation.getCellVertex(cellId, j, v[j]);
+        }
+        star[2].emplace_back(store(cellId, v.data(), 4));
+      }
+    }
+  };
+
+  std::array<
+    std::pair<typename GridStencil<dim>::Simplex *, size_t>, 3> const tables{
+    std::make_pair(stencil.edges_.data(), stencil.edges_.size()),
+    std::make_pair(stencil.triangles_.data(), stencil.triangles_.size()),
+    std::make_pair(stencil.tetras_.data(), stencil.tetras_.size())};
+
+  SimplexId ref{};
+  for(int i = 0; i < dim; ++i) {
+    ref += stencil.ref_[i] * stencil.vertStep_[i];
+  }
+
+  // the reference vertex gives the simplices and their vertices
+  Star star{};
+  getStar(ref, star);
+  for(size_t i = 0; i < tables.size(); ++i) {
+    if(star[i].size() != tables[i].second) {
+      return false;
+    }
+    std::copy(star[i].begin(), star[i].end(), tables[i].first);
+  }
+
+  // its neighbors along each axis give the id increments, the same
+  // simplices being expected in the same order
+  const auto sameVerts = [](const typename GridStencil<dim>::Simplex &s0,
+                            const typename GridStencil<dim>::Simplex &s1) {
+    return s0.verts_ == s1.verts_;
+  };
+  for(int k = 0; k < dim; ++k) {
+    getStar(ref + stencil.vertStep_[k], star);
+    for(size_t i = 0; i < tables.size(); ++i) {
+      if(star[i].size() != tables[i].second
+         || !std::equal(star[i].begin(), star[i].end(), tables[i].first,
+                        sameVerts)) {
+        return false;
+      }
+      for(size_t j = 0; j < star[i].size(); ++j) {
+        tables[i].first[j].steps_[k] = star[i][j].id_ - tables[i].first[j].id_;
+      }
+    }
+  }
+
+  // faces of the triangles and tetrahedra containing the vertex
+  const auto sameSet = [](const SimplexId a0, const SimplexId a1,
+                          const SimplexId b0, const SimplexId b1) {
+    return (a0 == b0 && a1 == b1) || (a0 == b1 && a1 == b0);
+  };
+  for(auto &t : stencil.triangles_) {
+    for(int k = 0; k < 2; ++k) {
+      const auto it = std::find_if(
+        stencil.edges_.begin(), stencil.edges_.end(),
+        [&t, k](const typename GridStencil<dim>::Simplex &e) {
+          return e.verts_[0] == t.verts_[k];
+        });
+      if(it == stencil.edges_.end()) {
+        return false;
+      }
+      t.faces_[k] = it - stencil.edges_.begin();
+    }
+  }
+  for(auto &t : stencil.tetras_) {
+    for(int k = 0; k < 3; ++k) {
+      // the face not containing the (2 - k)-th other vertex
+      const auto v0 = t.verts_[k == 2 ? 1 : 0];
+      const auto v1 = t.verts_[k == 0 ? 1 : 2];
+      const auto it = std::find_if(
+        stencil.triangles_.begin(), stencil.triangles_.end(),
+        [&](const typename GridStencil<dim>::Simplex &f) {
+          return sameSet(f.verts_[0], f.verts_[1], v0, v1);
+        });
+      if(it == stencil.triangles_.end()) {
+        return false;
+      }
+      t.faces_[k] = it - stencil.triangles_.begin();
+    }
+  }
+
+  // check the affine model on the diagonal neighbor
+  SimplexId diag{ref};
+  for(int k = 0; k < dim; ++k) {
+    diag += stencil.vertStep_[k];
+  }
+  getStar(diag, star);
+  for(size_t i = 0; i < tables.size(); ++i) {
+    if(star[i].size() != tables[i].second) {
+      return false;
+    }
+    for(size_t j = 0; j < star[i].size(); ++j) {
+      const auto &s = tables[i].first[j];
+      SimplexId id{s.id_};
+      for(int k = 0; k < dim; ++k) {
+        id += s.steps_[k];
+      }
+      if(star[i][j].id_ != id || !sameVerts(star[i][j], s)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 template <typename triangulationType>
 inline void DiscreteGradient::pairCells(
   CellExt &alpha, CellExt &beta, const triangulationType &triangulation) {
@@ -461,6 +773,31 @@ template <typename triangulationType>
 int DiscreteGradient::processLowerStars(
   const SimplexId *const offsets, const triangulationType &triangulation) {
 
+  // regular grids: the lower stars of the interior vertices are
+  // computed from a stencil, without position-dependent triangulation
+  // queries
+  if(this->dimensionality_ == 3) {
+    GridStencil<3> stencil{};
+    if(this->buildGridStencil(stencil, triangulation)) {
+      return this->processLowerStars(offsets, triangulation, &stencil);
+    }
+  } else if(this->dimensionality_ == 2) {
+    GridStencil<2> stencil{};
+    if(this->buildGridStencil(stencil, triangulation)) {
+      return this->processLowerStars(offsets, triangulation, &stencil);
+    }
+  }
+
+  return this->processLowerStars(
+    offsets, triangulation, static_cast<GridStencil<3> *>(nullptr));
+}
+
+template <int dim, typename triangulationType>
+int DiscreteGradient::processLowerStars(
+  const SimplexId *const offsets,
+  const triangulationType &triangulation,
+  const GridStencil<dim> *const stencil) {
+
   /* Compute gradient */
 
   auto nverts = triangulation.getNumberOfVertices();
@@ -529,7 +866,9 @@ int DiscreteGradient::processLowerStars(
       }
     };
 
-    lowerStar(Lx, x, offsets, triangulation);
+    if(stencil == nullptr || !lowerStar(Lx, x, offsets, *stencil)) {
+      lowerStar(Lx, x, offsets, triangulation);
+    }
     // In case the vertex is a ghost, the gradient of the
     // simplices of its star is set to GHOST_GRADIENT
 #ifdef TTK_ENABLE_MPI
@@ -1,5 +1,7 @@
 #include <DiscreteMorseSandwich.h>
 
+#include <unordered_map>
+
 ttk::DiscreteMorseSandwich::DiscreteMorseSandwich() {
   this->setDebugMsgPrefix("DiscreteMorseSandwich");
 }
@@ -179,3 +181,213 @@ void ttk::DiscreteMorseSandwich::displayStats(
   }
   this->printMsg(rows, debug::Priority::DETAIL);
 }
+
+#ifdef TTK_ENABLE_MPI
+
+void ttk::DiscreteMorseSandwich::pairDistributedCriticalCells(
+  std::vector<PersistencePair> &pairs,
+  const std::vector<SimplexId> &critCells,
+  const std::vector<SimplexId> &vpathsEnds,
+  const std::vector<SimplexId> &interfaceEnds,
+  const SimplexId nVerts,
+  const int dim,
+  const bool ignoreBoundary,
+  const bool infinitePairs) {
+
+  Timer tm{};
+
+  struct CritCell {
+    /** global cell id */
+    SimplexId gid;
+    /** global id of the cell greater vertex */
+    SimplexId vertGid;
+    /** global order of the cell vertices, in decreasing order */
+    std::array<SimplexId, 4> key;
+  };
+
+  // critical cells per dimension, sorted along the filtration: their
+  // position is used as a compact identifier and as filtration order
+  std::array<std::vector<CritCell>, 4> cells{};
+  for(size_t i = 0; i + 7 <= critCells.size(); i += 7) {
+    cells[critCells[i]].emplace_back(CritCell{
+      critCells[i + 1],
+      critCells[i + 2],
+      {critCells[i + 3], critCells[i + 4], critCells[i + 5], critCells[i + 6]},
+    });
+  }
+  std::array<std::unordered_map<SimplexId, SimplexId>, 4> gidToId{};
+  std::array<std::vector<SimplexId>, 4> criticalCellsByDim{};
+  size_t nMaxCells{};
+  for(int i = 0; i < dim + 1; ++i) {
+    TTK_PSORT(this->threadNumber_, cells[i].begin(), cells[i].end(),
+              [](const CritCell &a, const CritCell &b) {
+                return a.key < b.key;
+              });
+    criticalCellsByDim[i].resize(cells[i].size());
+    std::iota(criticalCellsByDim[i].begin(), criticalCellsByDim[i].end(), 0);
+    gidToId[i].reserve(cells[i].size());
+    for(size_t j = 0; j < cells[i].size(); ++j) {
+      gidToId[i][cells[i][j].gid] = j;
+    }
+    nMaxCells = std::max(nMaxCells, cells[i].size());
+  }
+  // the leading -1 is read when sorting triplets with a boundary
+  // component (-1) instead of a second maximum
+  std::vector<SimplexId> order(nMaxCells + 1);
+  std::iota(order.begin(), order.end(), -1);
+  const auto cellsOrder{order.data() + 1};
+
+  // chain the partial V-paths through the cells shared between ranks
+  // (0: descending V-paths, 1: ascending V-paths)
+  std::array<std::unordered_map<SimplexId, SimplexId>, 2> nextEnd{};
+  for(size_t i = 0; i + 3 <= interfaceEnds.size(); i += 3) {
+    nextEnd[interfaceEnds[i]][interfaceEnds[i + 1]] = interfaceEnds[i + 2];
+  }
+  const auto getExtremum = [&](const SimplexId type, SimplexId end) {
+    const auto &next{nextEnd[type]};
+    for(auto it = next.find(end); it != next.end(); it = next.find(end)) {
+      end = it->second;
+    }
+    const auto &ids{gidToId[type == 0 ? 0 : dim]};
+    const auto it{ids.find(end)};
+    return it == ids.end() ? SimplexId{-1} : it->second;
+  };
+
+  std::vector<tripletType> sadMinTriplets{}, sadMaxTriplets{};
+  std::vector<SimplexId> ends{};
+  for(size_t i = 0; i + 3 <= vpathsEnds.size();) {
+    const auto type{vpathsEnds[i]};
+    const auto sadGid{vpathsEnds[i + 1]};
+    const auto nEnds{vpathsEnds[i + 2]};
+    ends.clear();
+    for(SimplexId j = 0; j < nEnds; ++j) {
+      ends.emplace_back(getExtremum(type, vpathsEnds[i + 3 + j]));
+    }
+    i += 3 + nEnds;
+
+    if(type == 0) {
+      ends.erase(std::remove(ends.begin(), ends.end(), -1), ends.end());
+      std::sort(ends.begin(), ends.end());
+    } else {
+      std::sort(ends.begin(), ends.end(),
+                [](const SimplexId a, const SimplexId b) {
+                  // actual maxima before the boundary
+                  if((a < 0) == (b < 0)) {
+                    return a < b;
+                  } else {
+                    return a > b;
+                  }
+                });
+    }
+    ends.erase(std::unique(ends.begin(), ends.end()), ends.end());
+    if(ends.size() != 2) {
+      continue;
+    }
+    if(type == 0) {
+      sadMinTriplets.emplace_back(
+        tripletType{gidToId[1][sadGid], ends[0], ends[1]});
+    } else {
+      sadMaxTriplets.emplace_back(
+        tripletType{gidToId[dim - 1][sadGid], ends[0], ends[1]});
+    }
+  }
+
+  std::array<std::vector<bool>, 4> pairedCritCells{};
+  for(int i = 0; i < dim + 1; ++i) {
+    pairedCritCells[i].resize(cells[i].size(), false);
+  }
+  auto &pairedMinima{pairedCritCells[0]};
+  auto &paired1Saddles{pairedCritCells[1]};
+  auto &paired2Saddles{pairedCritCells[dim - 1]};
+  auto &pairedMaxima{pairedCritCells[dim]};
+  std::vector<SimplexId> reps{};
+
+  if(this->ComputeMinSad) {
+    reps.resize(cells[0].size());
+    std::iota(reps.begin(), reps.end(), 0);
+    tripletsToPersistencePairs(pairs, pairedMinima, paired1Saddles, reps,
+                               sadMinTriplets, cellsOrder, cellsOrder, 0);
+    // non-paired minima
+    for(const auto min : criticalCellsByDim[0]) {
+      if(!pairedMinima[min]) {
+        pairs.emplace_back(min, -1, 0);
+        pairedMinima[min] = true;
+      }
+    }
+  } else if(!cells[0].empty()) {
+    // still extract the global pair
+    pairs.emplace_back(0, -1, 0);
+    pairedMinima[0] = true;
+  }
+
+  if(dim > 1 && this->ComputeSadMax) {
+    // saddles already paired with a minimum (in 2D)
+    sadMaxTriplets.erase(
+      std::remove_if(sadMaxTriplets.begin(), sadMaxTriplets.end(),
+                     [&paired2Saddles](const tripletType &t) {
+                       return paired2Saddles[t[0]];
+                     }),
+      sadMaxTriplets.end());
+    reps.resize(cells[dim].size());
+    std::iota(reps.begin(), reps.end(), 0);
+    tripletsToPersistencePairs(pairs, pairedMaxima, paired2Saddles, reps,
+                               sadMaxTriplets, cellsOrder, cellsOrder,
+                               dim - 1);
+  }
+
+  if(ignoreBoundary) {
+    // remove the saddle-max pair with the global maximum
+    const auto it
+      = std::find_if(pairs.begin(), pairs.end(), [&](const PersistencePair &p) {
+          return p.type >= dim - 1 && p.death != -1
+                 && cells[dim][p.death].key[0] == nVerts - 1;
+        });
+    if(it != pairs.end()) {
+      paired2Saddles[it->birth] = false;
+      pairedMaxima[it->death] = false;
+      pairs.erase(it);
+    }
+  }
+
+  if(infinitePairs && dim == 2 && !ignoreBoundary && this->ComputeSadMax) {
+    if(this->ComputeMinSad) {
+      // non-paired 1-saddles (topological handles)
+      for(const auto s1 : criticalCellsByDim[1]) {
+        if(!paired1Saddles[s1]) {
+          pairs.emplace_back(s1, -1, 1);
+        }
+      }
+    }
+    // non-paired maxima
+    for(const auto max : criticalCellsByDim[dim]) {
+      if(!pairedMaxima[max]) {
+        pairs.emplace_back(max, -1, 2);
+      }
+    }
+  }
+
+  this->displayStats(pairs, criticalCellsByDim, pairedMinima, paired1Saddles,
+                     paired2Saddles, pairedMaxima);
+
+  // back to global identifiers: the birth cell dimension is the pair
+  // type
+  auto &pairsVerts{this->distributedPairsVerts_};
+  pairsVerts.resize(pairs.size());
+  for(size_t i = 0; i < pairs.size(); ++i) {
+    auto &p{pairs[i]};
+    const auto &birth{cells[p.type][p.birth]};
+    pairsVerts[i] = {birth.vertGid, -1};
+    p.birth = birth.gid;
+    if(p.death != -1) {
+      const auto &death{cells[p.type + 1][p.death]};
+      pairsVerts[i][1] = death.vertGid;
+      p.death = death.gid;
+    }
+  }
+
+  this->printMsg("Paired the gathered critical cells", 1.0,
+                 tm.getElapsedTime(), 1, debug::LineMode::NEW,
+                 debug::Priority::DETAIL);
+}
+
+#endif // TTK_ENABLE_MPI
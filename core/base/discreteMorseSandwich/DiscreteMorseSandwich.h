@@ -109,12 +109,35 @@ namespace ttk {
       return this->s2Children_;
     }
 
+#ifdef TTK_ENABLE_MPI
+    /**
+     * @brief Greater vertices of the distributed persistence pairs
+     *
+     * Global identifiers of the greater vertex of the birth and death
+     * cells of every pair computed on rank 0 by @ref
+     * computePersistencePairs when running with MPI (-1 for the death
+     * of infinite pairs).
+     */
+    inline const std::vector<std::array<SimplexId, 2>> &
+      getDistributedPairsVertices() const {
+      return this->distributedPairsVerts_;
+    }
+#endif // TTK_ENABLE_MPI
+
     /**
      * @brief Compute the persistence pairs from the discrete gradient
      *
      * @pre @ref buildGradient and @ref preconditionTriangulation
      * should be called prior to this function
      *
+     * When running with MPI, every rank provides its part of the
+     * domain (with a layer of ghost cells) and @p offsets should be a
+     * global order (see ttk::ArrayPreconditioning), an error is
+     * returned otherwise. The pairs are then returned on rank 0 only,
+     * using global cell identifiers. The saddle-saddle pairs of 3D
+     * domains are not computed with MPI (setComputeSadSad() is
+     * ignored, with a warning).
+     *
      * @param[out] pairs Output persistence pairs
      * @param[in] offsets Order field
      * @param[in] triangulation Preconditionned triangulation
@@ -426,6 +449,57 @@ namespace ttk {
       }
     };
 
+#ifdef TTK_ENABLE_MPI
+    /**
+     * @brief Distributed version of @ref computePersistencePairs
+     *
+     * Every rank follows the V-paths starting from its critical
+     * saddles until they reach an extremum or a cell owned by another
+     * rank, where they are continued by the V-path starting from this
+     * cell on its owner rank. These partial V-paths and the critical
+     * cells are gathered on rank 0, which chains the V-paths and pairs
+     * the critical cells.
+     *
+     * @param[out] pairs Output persistence pairs (on rank 0)
+     * @param[in] offsets Global order field
+     * @param[in] triangulation Distributed triangulation
+     * @param[in] ignoreBoundary Ignore the boundary component
+     *
+     * @return 0 when success
+     */
+    template <typename triangulationType>
+    int computeDistributedPersistencePairs(
+      std::vector<PersistencePair> &pairs,
+      const SimplexId *const offsets,
+      const triangulationType &triangulation,
+      const bool ignoreBoundary);
+
+    /**
+     * @brief Pair the critical cells gathered on rank 0
+     *
+     * @param[out] pairs Output persistence pairs (global cell ids)
+     * @param[in] critCells Critical cells records (dimension, global
+     * id, greater vertex global id, vertices global order)
+     * @param[in] vpathsEnds V-paths records (0 for descending/1 for
+     * ascending, saddle global id, number of V-paths, V-paths ends)
+     * @param[in] interfaceEnds Shared cells V-paths records (0 for
+     * vertices/1 for maximal cells, global id, V-path end)
+     * @param[in] nVerts Global number of vertices
+     * @param[in] dim Dimensionality
+     * @param[in] ignoreBoundary Ignore the boundary component
+     * @param[in] infinitePairs Create infinite pairs (explicit meshes)
+     */
+    void pairDistributedCriticalCells(
+      std::vector<PersistencePair> &pairs,
+      const std::vector<SimplexId> &critCells,
+      const std::vector<SimplexId> &vpathsEnds,
+      const std::vector<SimplexId> &interfaceEnds,
+      const SimplexId nVerts,
+      const int dim,
+      const bool ignoreBoundary,
+      const bool infinitePairs);
+#endif // TTK_ENABLE_MPI
+
     template <typename triangulationType>
     void alloc(const triangulationType &triangulation) {
       Timer tm{};
@@ -481,6 +555,9 @@ namespace ttk {
     mutable std::vector<bool> onBoundary_{};
     mutable std::array<std::vector<SimplexId>, 4> critCellsOrder_{};
     mutable std::vector<std::vector<SimplexId>> s2Children_{};
+#ifdef TTK_ENABLE_MPI
+    std::vector<std::array<SimplexId, 2>> distributedPairsVerts_{};
+#endif // TTK_ENABLE_MPI
 
     bool ComputeMinSad{true};
     bool ComputeSadSad{true};
@@ -688,7 +765,7 @@ void ttk::DiscreteMorseSandwich::getMaxSaddlePairs(
               [](const SimplexId a, const SimplexId b) {
                 // positive values (actual maxima) before negative ones
                 // (boundary component id)
-                if(a * b >= 0) {
+                if((a < 0) == (b < 0)) {
                   return a < b;
                 } else {
                   return a > b;
@@ -1122,6 +1199,13 @@ int ttk::DiscreteMorseSandwich::computePersistencePairs(
   const bool ignoreBoundary,
   const bool compute2SaddlesChildren) {
 
+#ifdef TTK_ENABLE_MPI
+  if(ttk::isRunningWithMPI()) {
+    return this->computeDistributedPersistencePairs(
+      pairs, offsets, triangulation, ignoreBoundary);
+  }
+#endif // TTK_ENABLE_MPI
+
   // allocate memory
   this->alloc(triangulation);
 
@@ -1278,3 +1362,275 @@ int ttk::DiscreteMorseSandwich::computePersistencePairs(
 
   return 0;
 }
+
+#ifdef TTK_ENABLE_MPI
+
+template <typename triangulationType>
+int ttk::DiscreteMorseSandwich::computeDistributedPersistencePairs(
+  std::vector<PersistencePair> &pairs,
+  const SimplexId *const offsets,
+  const triangulationType &triangulation,
+  const bool ignoreBoundary) {
+
+  Timer tm{};
+  pairs.clear();
+  this->distributedPairsVerts_.clear();
+  const auto dim = this->dg_.getDimensionality();
+
+  // the critical cells of all ranks are paired with their global order:
+  // every rank takes the same decision, no collective is left pending
+  if(!ttk::isGlobalOrder(offsets, &triangulation, ttk::MPIcomm_)) {
+    this->printErr("The order field is not a global order");
+    this->printErr("Use ttkArrayPreconditioning to compute one");
+    return -1;
+  }
+
+  if(dim == 3 && this->ComputeSadSad && ttk::MPIrank_ == 0) {
+    this->printWrn("Saddle-saddle pairs are not computed with MPI");
+  }
+
+  // the gradient of the lower star of non-owned vertices is set to
+  // GHOST_GRADIENT: every critical cell is owned by the current rank
+  std::array<std::vector<SimplexId>, 4> criticalCellsByDim{};
+  this->dg_.getCriticalPoints(criticalCellsByDim, triangulation);
+
+  const auto isOwned = [&triangulation](const SimplexId v) {
+    return triangulation.getVertexRank(v) == ttk::MPIrank_;
+  };
+  // a cell belongs to the lower star of its greater vertex
+  const auto isCellOwned = [this, &triangulation, &isOwned](const Cell &c) {
+    return isOwned(this->dg_.getCellGreaterVertex(c, triangulation));
+  };
+  const auto getGlobalId = [&triangulation](const Cell &c) {
+    SimplexId gid{-1};
+    triangulation.getDistributedGlobalCellId(c.id_, c.dim_, gid);
+    return gid;
+  };
+
+  // follow a descending V-path until a minimum or a non-owned vertex
+  const auto descend = [this, &triangulation, &isOwned](SimplexId v) {
+    while(isOwned(v) && !this->dg_.isCellCritical(Cell{0, v})) {
+      const auto e{this->dg_.getPairedCell(Cell{0, v}, triangulation)};
+      SimplexId v0{}, v1{};
+      triangulation.getEdgeVertex(e, 0, v0);
+      triangulation.getEdgeVertex(e, 1, v1);
+      v = (v0 == v) ? v1 : v0;
+    }
+    return triangulation.getVertexGlobalId(v);
+  };
+
+  // follow an ascending V-path until a maximum, a non-owned cell or
+  // the boundary (-1)
+  const auto ascend = [this, dim, &triangulation, &isCellOwned,
+                       &getGlobalId](SimplexId c) -> SimplexId {
+    while(isCellOwned(Cell{dim, c})
+          && !this->dg_.isCellCritical(Cell{dim, c})) {
+      const auto f{this->dg_.getPairedCell(Cell{dim, c}, triangulation, true)};
+      const auto nStar{dim == 3 ? triangulation.getTriangleStarNumber(f)
+                                : triangulation.getEdgeStarNumber(f)};
+      SimplexId next{c};
+      for(SimplexId i = 0; i < nStar && next == c; ++i) {
+        if(dim == 3) {
+          triangulation.getTriangleStar(f, i, next);
+        } else {
+          triangulation.getEdgeStar(f, i, next);
+        }
+      }
+      if(next == c) {
+        return -1;
+      }
+      c = next;
+    }
+    return getGlobalId(Cell{dim, c});
+  };
+
+  // 1. critical cells with their filtration key (global order of
+  // their vertices, in decreasing order)
+  std::vector<SimplexId> critCells{};
+  for(int i = 0; i < dim + 1; ++i) {
+    for(const auto c : criticalCellsByDim[i]) {
+      std::array<SimplexId, 4> key{-1, -1, -1, -1};
+      if(i == 0) {
+        key[0] = offsets[c];
+      } else if(i == 1) {
+        EdgeSimplex e{};
+        e.fillEdge(c, offsets, triangulation);
+        std::copy(e.vertsOrder_.begin(), e.vertsOrder_.end(), key.begin());
+      } else if(i == 2) {
+        TriangleSimplex t{};
+        t.fillTriangle(c, offsets, triangulation);
+        std::copy(t.vertsOrder_.begin(), t.vertsOrder_.end(), key.begin());
+      } else {
+        TetraSimplex t{};
+        t.fillTetra(c, offsets, triangulation);
+        key = t.vertsOrder_;
+      }
+      const Cell cell{i, c};
+      critCells.insert(
+        critCells.end(),
+        {i, getGlobalId(cell),
+         triangulation.getVertexGlobalId(
+           this->dg_.getCellGreaterVertex(cell, triangulation)),
+         key[0], key[1], key[2], key[3]});
+    }
+  }
+
+  // 2. V-paths starting from the critical saddles
+  std::vector<std::vector<SimplexId>> sadMin{}, sadMax{};
+  if(this->ComputeMinSad) {
+    const auto &saddles{criticalCellsByDim[1]};
+    sadMin.resize(saddles.size());
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < saddles.size(); ++i) {
+      SimplexId v0{}, v1{};
+      triangulation.getEdgeVertex(saddles[i], 0, v0);
+      triangulation.getEdgeVertex(saddles[i], 1, v1);
+      sadMin[i] = {descend(v0), descend(v1)};
+    }
+  }
+  if(dim > 1 && this->ComputeSadMax) {
+    const auto &saddles{criticalCellsByDim[dim - 1]};
+    sadMax.resize(saddles.size());
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < saddles.size(); ++i) {
+      const auto s{saddles[i]};
+      // the star of an owned saddle is complete on the current rank
+      const auto nStar{dim == 3 ? triangulation.getTriangleStarNumber(s)
+                                : triangulation.getEdgeStarNumber(s)};
+      for(SimplexId j = 0; j < nStar; ++j) {
+        SimplexId c{};
+        if(dim == 3) {
+          triangulation.getTriangleStar(s, j, c);
+        } else {
+          triangulation.getEdgeStar(s, j, c);
+        }
+        sadMax[i].emplace_back(ascend(c));
+      }
+      if(nStar == 1) {
+        // critical saddle is on boundary
+        sadMax[i].emplace_back(-1);
+      }
+    }
+  }
+
+  std::vector<SimplexId> vpathsEnds{};
+  for(size_t i = 0; i < sadMin.size(); ++i) {
+    vpathsEnds.insert(
+      vpathsEnds.end(),
+      {0, getGlobalId(Cell{1, criticalCellsByDim[1][i]}), 2, sadMin[i][0],
+       sadMin[i][1]});
+  }
+  for(size_t i = 0; i < sadMax.size(); ++i) {
+    vpathsEnds.insert(
+      vpathsEnds.end(),
+      {1, getGlobalId(Cell{dim - 1, criticalCellsByDim[dim - 1][i]}),
+       static_cast<SimplexId>(sadMax[i].size())});
+    vpathsEnds.insert(vpathsEnds.end(), sadMax[i].begin(), sadMax[i].end());
+  }
+
+  // 3. V-paths starting from the owned cells that other ranks can
+  // reach (owned vertices with a non-owned neighbor, owned maximal
+  // cells with a non-owned vertex)
+  const auto nVerts{triangulation.getNumberOfVertices()};
+  const auto nCells{triangulation.getNumberOfCells()};
+  std::vector<SimplexId> vertsEnds{}, cellsEnds{};
+  SimplexId nOwnedVerts{};
+  if(this->ComputeMinSad) {
+    vertsEnds.resize(nVerts, -1);
+  }
+  if(dim > 1 && this->ComputeSadMax) {
+    // -1 stands for the boundary
+    cellsEnds.resize(nCells, -2);
+  }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for reduction(+ : nOwnedVerts)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId i = 0; i < nVerts; ++i) {
+      if(!isOwned(i)) {
+        continue;
+      }
+      nOwnedVerts++;
+      if(vertsEnds.empty()) {
+        continue;
+      }
+      const auto nNeighs{triangulation.getVertexNeighborNumber(i)};
+      for(SimplexId j = 0; j < nNeighs; ++j) {
+        SimplexId n{};
+        triangulation.getVertexNeighbor(i, j, n);
+        if(!isOwned(n)) {
+          vertsEnds[i] = descend(i);
+          break;
+        }
+      }
+    }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId i = 0; i < static_cast<SimplexId>(cellsEnds.size()); ++i) {
+      if(!isCellOwned(Cell{dim, i})) {
+        continue;
+      }
+      for(int j = 0; j < dim + 1; ++j) {
+        SimplexId v{};
+        triangulation.getCellVertex(i, j, v);
+        if(!isOwned(v)) {
+          cellsEnds[i] = ascend(i);
+          break;
+        }
+      }
+    }
+  }
+
+  std::vector<SimplexId> interfaceEnds{};
+  for(size_t i = 0; i < vertsEnds.size(); ++i) {
+    const auto gid{triangulation.getVertexGlobalId(i)};
+    // skip minima and vertices outside of the interface
+    if(vertsEnds[i] != -1 && vertsEnds[i] != gid) {
+      interfaceEnds.insert(interfaceEnds.end(), {0, gid, vertsEnds[i]});
+    }
+  }
+  for(size_t i = 0; i < cellsEnds.size(); ++i) {
+    const auto gid{getGlobalId(Cell{dim, static_cast<SimplexId>(i)})};
+    if(cellsEnds[i] != -2 && cellsEnds[i] != gid) {
+      interfaceEnds.insert(interfaceEnds.end(), {1, gid, cellsEnds[i]});
+    }
+  }
+
+  this->printMsg("Computed the local V-paths", 1.0, tm.getElapsedTime(),
+                 this->threadNumber_, debug::LineMode::NEW,
+                 debug::Priority::DETAIL);
+
+  // 4. gather everything on rank 0
+  std::vector<SimplexId> gCritCells{}, gVpathsEnds{}, gInterfaceEnds{};
+  ttk::gatherVector(critCells, gCritCells);
+  ttk::gatherVector(vpathsEnds, gVpathsEnds);
+  ttk::gatherVector(interfaceEnds, gInterfaceEnds);
+  SimplexId nGlobVerts{};
+  MPI_Reduce(&nOwnedVerts, &nGlobVerts, 1, ttk::getMPIType(nOwnedVerts),
+             MPI_SUM, 0, ttk::MPIcomm_);
+
+  if(ttk::MPIrank_ == 0) {
+    this->pairDistributedCriticalCells(
+      pairs, gCritCells, gVpathsEnds, gInterfaceEnds, nGlobVerts, dim,
+      ignoreBoundary,
+      std::is_same<triangulationType, ttk::ExplicitTriangulation>::value);
+  }
+
+  this->printMsg(
+    "Computed " + std::to_string(pairs.size()) + " persistence pairs", 1.0,
+    tm.getElapsedTime(), this->threadNumber_);
+
+  return 0;
+}
+
+#endif // TTK_ENABLE_MPI
@@ -10,6 +10,10 @@
 /// identifiers attached to them) and produces a distance field to the closest
 /// source.
 ///
+/// The shortest paths from all the sources are computed at once, with a
+/// parallel multi-source variant of the Dijkstra algorithm (see
+/// ttk::Dijkstra::multiSourceShortestPath).
+///
 /// \b Related \b publication \n
 /// "A note on two problems in connexion with graphs" \n
 /// Edsger W. Dijkstra \n
@@ -89,9 +93,6 @@ int ttk::DistanceField::execute(const triangulationType *triangulation_) const {
   SimplexId *origin = static_cast<SimplexId *>(outputIdentifiers_);
   SimplexId *seg = static_cast<SimplexId *>(outputSegmentation_);
 
-  std::fill(dist, dist + vertexNumber_, std::numeric_limits<dataType>::max());
-  std::fill(origin, origin + vertexNumber_, -1);
-
   // get the sources
   std::set<SimplexId> isSource;
   for(SimplexId k = 0; k < sourceNumber_; ++k)
@@ -99,34 +100,20 @@ int ttk::DistanceField::execute(const triangulationType *triangulation_) const {
   std::vector<SimplexId> sources(isSource.begin(), isSource.end());
   isSource.clear();
 
-  // prepare output
-  std::vector<std::vector<dataType>> scalars(sources.size());
-
-  // @PETER This doesn't seem to very work efficient, there's multilple source
-  // shortest paths algorithms.
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-  for(size_t i = 0; i < sources.size(); ++i) {
-    int const ret = Dijkstra::shortestPath<dataType>(
-      sources[i], *triangulation_, scalars[i]);
-    if(ret != 0) {
-      this->printErr(
-        "Algorithm not successful (error code:  " + std::to_string(ret) + ").");
-    }
+  // distance to and index of the closest source in a single pass
+  int const ret = Dijkstra::multiSourceShortestPath<dataType>(
+    sources, *triangulation_, dist, seg, this->threadNumber_);
+  if(ret != 0) {
+    this->printErr(
+      "Algorithm not successful (error code:  " + std::to_string(ret) + ").");
+    return ret;
   }
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
   for(SimplexId k = 0; k < vertexNumber_; ++k) {
-    for(size_t i = 0; i < sources.size(); ++i) {
-      if(i == 0 or dist[k] > scalars[i][k]) {
-        dist[k] = scalars[i][k];
-        origin[k] = sources[i];
-        seg[k] = i;
-      }
-    }
+    origin[k] = seg[k] == -1 ? -1 : sources[seg[k]];
   }
 
   this->printMsg(
@@ -1259,15 +1259,23 @@ int ExplicitTriangulation::preconditionDistributedEdges() {
   // 4. exchange global ids between ghost cells
 
   const auto nEdgesPerCell{this->getDimensionality() == 3 ? 6 : 3};
-  this->exchangeDistributedInternal(
-    [this](const SimplexId lcid, const int j) {
-      SimplexId leid{};
+  // in 2D, the cell edges are the triangle edges
+  const auto getCellEdge = [this](const SimplexId lcid, const int j) {
+    SimplexId leid{};
+    if(this->maxCellDim_ == 3) {
       this->getCellEdgeInternal(lcid, j, leid);
-      return this->edgeLidToGid_[leid];
+    } else {
+      this->getTriangleEdgeInternal(lcid, j, leid);
+    }
+    return leid;
+  };
+  this->exchangeDistributedInternal(
+    [this, &getCellEdge](const SimplexId lcid, const int j) {
+      return this->edgeLidToGid_[getCellEdge(lcid, j)];
     },
-    [this](const SimplexId lcid, const SimplexId geid, const int j) {
-      SimplexId leid{};
-      this->getCellEdgeInternal(lcid, j, leid);
+    [this, &getCellEdge](
+      const SimplexId lcid, const SimplexId geid, const int j) {
+      const auto leid{getCellEdge(lcid, j)};
       if(this->edgeLidToGid_[leid] == -1 && geid != -1) {
         this->edgeLidToGid_[leid] = geid;
         this->edgeGidToLid_[geid] = leid;
@@ -1513,12 +1521,12 @@ int ttk::ExplicitTriangulation::preconditionExchangeGhostVertices() {
 #endif // TTK_ENABLE_MPI
 
 template <typename T>
-void writeBin(std::ofstream &stream, const T var) {
+void writeBin(std::ostream &stream, const T var) {
   stream.write(reinterpret_cast<const char *>(&var), sizeof(var));
 }
 
 template <typename T>
-void writeBinArray(std::ofstream &stream,
+void writeBinArray(std::ostream &stream,
                    const T *const buff,
                    const size_t size) {
   stream.write(reinterpret_cast<const char *>(buff), size * sizeof(T));
@@ -1526,128 +1534,202 @@ void writeBinArray(std::ofstream &stream,
 
 // initialize static member variables
 const char *ExplicitTriangulation::magicBytes_ = "TTKTriangulationFileFormat";
-const unsigned long ExplicitTriangulation::formatVersion_ = 1;
+const unsigned long ExplicitTriangulation::formatVersion_ = 2;
+
+namespace {
+  // Since version 2, every array of the binary file format starts at
+  // an offset multiple of this value so it can be memory-mapped
+  constexpr size_t FILE_ALIGNMENT{64};
+  // Number of arrays in the binary file format: 5 fixed-size arrays,
+  // 11 variable-size arrays (offsets then data), 3 boolean arrays
+  constexpr size_t FILE_SECTIONS_NUMBER{5 + 2 * 11 + 3};
+
+  inline size_t alignFileOffset(const size_t offset) {
+    return (offset + FILE_ALIGNMENT - 1) / FILE_ALIGNMENT * FILE_ALIGNMENT;
+  }
+} // namespace
+
+void ExplicitTriangulation::getFileHeader(FileHeader &header) const {
+  header.version = ttk::ExplicitTriangulation::formatVersion_;
+  header.dim = this->getDimensionality();
+  header.nVerts = this->getNumberOfVertices();
+  // 0 until the edges/triangles are computed
+  header.nEdges = 0;
+  if(header.dim == 1) {
+    header.nEdges = this->getNumberOfCells();
+  } else if(header.dim > 1) {
+    header.nEdges = this->edgeList_.size();
+  }
+  header.nTriangles = 0;
+  if(header.dim == 2) {
+    header.nTriangles = this->getNumberOfCells();
+  } else if(header.dim == 3) {
+    header.nTriangles = this->triangleList_.size();
+  }
+  header.nTetras = header.dim > 2 ? this->getNumberOfCells() : 0;
+}
+
+void ExplicitTriangulation::listFileBuffers(
+  std::vector<std::pair<const char *, size_t>> &buffers,
+  std::array<std::vector<char>, 3> &boolBuffers) const {
+
+  // only list buffers outside this->cellArray_ (cellVertex,
+  // vertexCoords), those ones will be provided by VTK
+
+  buffers.clear();
+  buffers.reserve(FILE_SECTIONS_NUMBER);
+
+  // fixed-size arrays (in AbstractTriangulation.h)
+
+  const auto add_fixed = [&buffers](const auto &arr) {
+    buffers.emplace_back(reinterpret_cast<const char *>(arr.data()),
+                         arr.size() * sizeof(arr[0]));
+  };
+
+  // 12. edgeList (SimplexId array)
+  add_fixed(this->edgeList_);
+  // 13. triangleList (SimplexId array)
+  add_fixed(this->triangleList_);
+  // 14. triangleEdgeList (SimplexId array)
+  add_fixed(this->triangleEdgeList_);
+  // 15. tetraEdgeList (SimplexId array)
+  add_fixed(this->tetraEdgeList_);
+  // 16. tetraTriangleList (SimplexId array)
+  add_fixed(this->tetraTriangleList_);
+
+  // variable-size arrays (FlatJaggedArray in ExplicitTriangulation.h)
+
+  const auto add_variable = [&buffers](const FlatJaggedArray &arr) {
+    if(arr.empty()) {
+      buffers.emplace_back(nullptr, 0);
+      buffers.emplace_back(nullptr, 0);
+      return;
+    }
+    buffers.emplace_back(reinterpret_cast<const char *>(arr.offset_ptr()),
+                         (arr.size() + 1) * sizeof(SimplexId));
+    buffers.emplace_back(reinterpret_cast<const char *>(arr.data_ptr()),
+                         arr.dataSize() * sizeof(SimplexId));
+  };
+
+  // 17. vertexNeighbors (SimplexId arrays, offsets then data)
+  add_variable(this->vertexNeighborData_);
+  // 18. cellNeighbors (SimplexId arrays, offsets then data)
+  add_variable(this->cellNeighborData_);
+  // 19. vertexEdges (SimplexId arrays, offsets then data)
+  add_variable(this->vertexEdgeData_);
+  // 20. vertexTriangles (SimplexId arrays, offsets then data)
+  add_variable(this->vertexTriangleData_);
+  // 21. edgeTriangles (SimplexId arrays, offsets then data)
+  add_variable(this->edgeTriangleData_);
+  // 22. vertexStars (SimplexId arrays, offsets then data)
+  add_variable(this->vertexStarData_);
+  // 23. edgeStars (SimplexId arrays, offsets then data)
+  add_variable(this->edgeStarData_);
+  // 24. triangleStars (SimplexId arrays, offsets then data)
+  add_variable(this->triangleStarData_);
+  // 25. vertexLinks (SimplexId arrays, offsets then data)
+  add_variable(this->vertexLinkData_);
+  // 26. edgeLinks (SimplexId arrays, offsets then data)
+  add_variable(this->edgeLinkData_);
+  // 27. triangleLinks (SimplexId arrays, offsets then data)
+  add_variable(this->triangleLinkData_);
+
+  // std::vector<bool> is bit-packed: convert to one char per element
+  const auto add_bool
+    = [&buffers](const std::vector<bool> &arr, std::vector<char> &buff) {
+        buff.resize(arr.size());
+        for(size_t i = 0; i < arr.size(); ++i) {
+          buff[i] = static_cast<char>(arr[i]);
+        }
+        buffers.emplace_back(buff.data(), buff.size());
+      };
+
+  // 28. boundary vertices (bool array)
+  add_bool(this->boundaryVertices_, boolBuffers[0]);
+  // 29. boundary edges (bool array)
+  add_bool(this->boundaryEdges_, boolBuffers[1]);
+  // 30. boundary triangles (bool array)
+  add_bool(this->boundaryTriangles_, boolBuffers[2]);
+}
 
 int ExplicitTriangulation::writeToFile(std::ofstream &stream) const {
 
+  FileHeader header{};
+  this->getFileHeader(header);
+
   // 1. magic bytes (char *)
   stream.write(ttk::ExplicitTriangulation::magicBytes_,
                std::strlen(ttk::ExplicitTriangulation::magicBytes_));
   // 2. format version (unsigned long)
-  writeBin(stream, ttk::ExplicitTriangulation::formatVersion_);
+  writeBin(stream, header.version);
   // 3. dimensionality (int)
-  const auto dim = this->getDimensionality();
-  writeBin(stream, dim);
+  writeBin(stream, header.dim);
   // 4. number of vertices (SimplexId)
-  const auto nVerts = this->getNumberOfVertices();
-  writeBin(stream, nVerts);
+  writeBin(stream, header.nVerts);
   // 5. number of edges (SimplexId)
-  const auto edgesNumber = [this, dim]() -> SimplexId {
-    if(dim == 1) {
-      return this->getNumberOfCells();
-    } else if(dim > 1) {
-      return this->edgeList_.size();
-    }
-    return 0;
-  };
-  const auto nEdges = edgesNumber();
-  writeBin(stream, nEdges);
+  writeBin(stream, header.nEdges);
   // 6. number of triangles (SimplexId, 0 in 1D)
-  const auto trianglesNumber = [this, dim]() -> SimplexId {
-    if(dim == 2) {
-      return this->getNumberOfCells();
-    } else if(dim == 3) {
-      return this->triangleList_.size();
-    }
-    return 0;
-  };
-  const auto nTriangles = trianglesNumber();
-  writeBin(stream, nTriangles);
+  writeBin(stream, header.nTriangles);
   // 7. number of tetrahedron (SimplexId, 0 in 2D)
-  const auto nTetras = dim > 2 ? this->getNumberOfCells() : 0;
-  writeBin(stream, nTetras);
-
-  // only write buffers oustside this->cellArray_ (cellVertex, vertexCoords),
-  // those ones will be provided by VTK
-
-  // fixed-size arrays (in AbstractTriangulation.h)
-
-#define WRITE_FIXED(ARRAY)                             \
-  if(ARRAY.empty()) {                                  \
-    writeBin(stream, char{0});                         \
-  } else {                                             \
-    writeBin(stream, char{1});                         \
-    writeBinArray(stream, ARRAY.data(), ARRAY.size()); \
+  writeBin(stream, header.nTetras);
+  // 8. size of SimplexId (int, 4 or 8 bytes)
+  writeBin(stream, static_cast<int>(sizeof(SimplexId)));
+  // 9. checksum of the input cells (uint64_t, 0 if unknown)
+  writeBin(stream, this->fileChecksum_);
+
+  // list the arrays to write (pointer to the first byte, size in
+  // bytes), empty arrays are stored as empty sections
+  std::vector<std::pair<const char *, size_t>> buffers{};
+  std::array<std::vector<char>, 3> boolBuffers{};
+  this->listFileBuffers(buffers, boolBuffers);
+
+  // 10. number of arrays (uint64_t)
+  writeBin(stream, static_cast<uint64_t>(buffers.size()));
+
+  // 11. table of contents (offset & size in bytes of every array,
+  // offsets aligned on FILE_ALIGNMENT, {0, 0} for empty arrays)
+  std::vector<FileSection> sections(buffers.size());
+  size_t curr = static_cast<size_t>(stream.tellp())
+                + sections.size() * sizeof(FileSection);
+  for(size_t i = 0; i < buffers.size(); ++i) {
+    if(buffers[i].second == 0) {
+      sections[i] = {0, 0};
+      continue;
+    }
+    curr = alignFileOffset(curr);
+    sections[i] = {curr, buffers[i].second};
+    curr += buffers[i].second;
   }
+  writeBinArray(stream, sections.data(), sections.size());
 
-  // 8. edgeList (SimplexId array)
-  WRITE_FIXED(this->edgeList_);
-  // 9. triangleList (SimplexId array)
-  WRITE_FIXED(this->triangleList_);
-  // 10. triangleEdgeList (SimplexId array)
-  WRITE_FIXED(this->triangleEdgeList_);
-  // 11. tetraEdgeList (SimplexId array)
-  WRITE_FIXED(this->tetraEdgeList_);
-  // 12. tetraTriangleList (SimplexId array)
-  WRITE_FIXED(this->tetraTriangleList_);
-
-  // variable-size arrays (FlatJaggedArray in ExplicitTriangulation.h)
-
-#define WRITE_GUARD(ARRAY)     \
-  if(ARRAY.empty()) {          \
-    writeBin(stream, char{0}); \
-    return;                    \
-  } else {                     \
-    writeBin(stream, char{1}); \
+  // 12. -> 30. array contents, zero-padded to their aligned offsets
+  const std::array<char, FILE_ALIGNMENT> padding{};
+  for(size_t i = 0; i < buffers.size(); ++i) {
+    if(sections[i].size == 0) {
+      continue;
+    }
+    const auto pos = static_cast<size_t>(stream.tellp());
+    stream.write(padding.data(), sections[i].offset - pos);
+    stream.write(buffers[i].first, buffers[i].second);
   }
 
-  const auto write_variable = [&stream](const FlatJaggedArray &arr) {
-    // empty array guard
-    WRITE_GUARD(arr);
-    writeBinArray(stream, arr.offset_ptr(), arr.size() + 1);
-    writeBinArray(stream, arr.get_ptr(0, 0), arr.dataSize());
-  };
-
-  // 13. vertexNeighbors (SimplexId array, offsets then data)
-  write_variable(this->vertexNeighborData_);
-  // 14. cellNeighbors (SimplexId array, offsets then data)
-  write_variable(this->cellNeighborData_);
-  // 15. vertexEdges (SimplexId array, offsets then data)
-  write_variable(this->vertexEdgeData_);
-  // 16. vertexTriangles (SimplexId array, offsets then data)
-  write_variable(this->vertexTriangleData_);
-  // 17. edgeTriangles (SimplexId array, offsets then data)
-  write_variable(this->edgeTriangleData_);
-  // 18. vertexStars (SimplexId array, offsets then data)
-  write_variable(this->vertexStarData_);
-  // 19. edgeStars (SimplexId array, offsets then data)
-  write_variable(this->edgeStarData_);
-  // 20. triangleStars (SimplexId array, offsets then data)
-  write_variable(this->triangleStarData_);
-  // 21. vertexLinks (SimplexId array, offsets then data)
-  write_variable(this->vertexLinkData_);
-  // 22. edgeLinks (SimplexId array, offsets then data)
-  write_variable(this->edgeLinkData_);
-  // 23. triangleLinks (SimplexId array, offsets then data)
-  write_variable(this->triangleLinkData_);
+  return 0;
+}
 
-  const auto write_bool = [&stream](const std::vector<bool> &arr) {
-    // empty array guard
-    WRITE_GUARD(arr);
-    for(size_t i = 0; i < arr.size(); ++i) {
-      const auto b = static_cast<char>(arr[i]);
-      writeBin(stream, b);
-    }
+int ExplicitTriangulation::getNumberOfStoredArrays() const {
+  const std::array<bool, 19> nonEmpty{
+    !this->edgeList_.empty(),           !this->triangleList_.empty(),
+    !this->triangleEdgeList_.empty(),   !this->tetraEdgeList_.empty(),
+    !this->tetraTriangleList_.empty(),  !this->vertexNeighborData_.empty(),
+    !this->cellNeighborData_.empty(),   !this->vertexEdgeData_.empty(),
+    !this->vertexTriangleData_.empty(), !this->edgeTriangleData_.empty(),
+    !this->vertexStarData_.empty(),     !this->edgeStarData_.empty(),
+    !this->triangleStarData_.empty(),   !this->vertexLinkData_.empty(),
+    !this->edgeLinkData_.empty(),       !this->triangleLinkData_.empty(),
+    !this->boundaryVertices_.empty(),   !this->boundaryEdges_.empty(),
+    !this->boundaryTriangles_.empty(),
   };
-
-  // 24. boundary vertices (bool array)
-  write_bool(this->boundaryVertices_);
-  // 25. boundary edges (bool array)
-  write_bool(this->boundaryEdges_);
-  // 26. boundary triangles (bool array)
-  write_bool(this->boundaryTriangles_);
-
-  return 0;
+  return std::count(nonEmpty.begin(), nonEmpty.end(), true);
 }
 
 int ExplicitTriangulation::writeToFileASCII(std::ofstream &stream) const {
@@ -1741,15 +1823,206 @@ int ExplicitTriangulation::writeToFileASCII(std::ofstream &stream) const {
 }
 
 template <typename T>
-void readBin(std::ifstream &stream, T &res) {
+void readBin(std::istream &stream, T &res) {
   stream.read(reinterpret_cast<char *>(&res), sizeof(res));
 }
 
 template <typename T>
-void readBinArray(std::ifstream &stream, T *const res, const size_t size) {
+void readBinArray(std::istream &stream, T *const res, const size_t size) {
   stream.read(reinterpret_cast<char *>(res), size * sizeof(T));
 }
 
+int ExplicitTriangulation::checkFileHeader(const FileHeader &header) const {
+
+  if(header.version > ttk::ExplicitTriangulation::formatVersion_) {
+    this->printErr("Unsupported file format version ("
+                   + std::to_string(header.version) + ")!");
+    return -1;
+  }
+  if(header.version != ttk::ExplicitTriangulation::formatVersion_) {
+    this->printWrn("File format version (" + std::to_string(header.version)
+                   + ") and software version ("
+                   + std::to_string(ttk::ExplicitTriangulation::formatVersion_)
+                   + ") are different!");
+  }
+
+  if(header.dim != this->getDimensionality()) {
+    this->printErr("Incorrect dimension!");
+    return -1;
+  }
+  if(header.nVerts != this->getNumberOfVertices()) {
+    this->printErr("Incorrect number of vertices!");
+    return -1;
+  }
+  if((header.dim == 2 && header.nTriangles != this->getNumberOfCells())
+     || (header.dim == 3 && header.nTetras != this->getNumberOfCells())) {
+    this->printErr("Incorrect number of cells!");
+    return -1;
+  }
+
+  return 0;
+}
+
+int ExplicitTriangulation::checkFileChecksum(const uint64_t checksum) const {
+  if(this->fileChecksum_ != 0 && checksum != this->fileChecksum_) {
+    this->printErr("File written for other input cells (checksum mismatch)!");
+    return -1;
+  }
+  return 0;
+}
+
+template <typename SectionReader>
+int ExplicitTriangulation::readFileSections(
+  const FileHeader &header,
+  const std::vector<FileSection> &sections,
+  SectionReader &reader) {
+
+  size_t sectionId{};
+  bool valid{true};
+
+  // fixed-size arrays (in AbstractTriangulation.h)
+
+  const auto read_fixed = [&](auto &arr, const SimplexId n_items) {
+    const auto &section = sections[sectionId++];
+    if(section.size == 0) {
+      return;
+    }
+    if(section.size != n_items * sizeof(arr[0])) {
+      valid = false;
+      return;
+    }
+    arr.resize(n_items);
+    valid &= reader.copy(section, arr.data());
+  };
+
+  // 12. edgeList (SimplexId array)
+  read_fixed(this->edgeList_, header.nEdges);
+  // 13. triangleList (SimplexId array)
+  read_fixed(this->triangleList_, header.nTriangles);
+  // 14. triangleEdgeList (SimplexId array)
+  read_fixed(this->triangleEdgeList_, header.nTriangles);
+  // 15. tetraEdgeList (SimplexId array)
+  read_fixed(this->tetraEdgeList_, header.nTetras);
+  // 16. tetraTriangleList (SimplexId array)
+  read_fixed(this->tetraTriangleList_, header.nTetras);
+
+  // variable-size arrays (FlatJaggedArrays in ExplicitTriangulation.h)
+
+  const auto read_variable = [&](FlatJaggedArray &arr,
+                                 const SimplexId n_items) {
+    const auto &offSection = sections[sectionId++];
+    const auto &dataSection = sections[sectionId++];
+    if(offSection.size == 0) {
+      return;
+    }
+    if(offSection.size != (n_items + 1) * sizeof(SimplexId)) {
+      valid = false;
+      return;
+    }
+    const auto offsetsView = reader.view(offSection);
+    const auto dataView = reader.view(dataSection);
+    if(offsetsView != nullptr && dataView != nullptr) {
+      // zero-copy
+      if(dataSection.size != offsetsView[n_items] * sizeof(SimplexId)) {
+        valid = false;
+        return;
+      }
+      arr.setExternalData(dataView, offsetsView, n_items);
+      return;
+    }
+    std::vector<SimplexId> offsets(n_items + 1), data{};
+    valid &= reader.copy(offSection, offsets.data());
+    if(dataSection.size != offsets.back() * sizeof(SimplexId)) {
+      valid = false;
+      return;
+    }
+    data.resize(offsets.back());
+    valid &= reader.copy(dataSection, data.data());
+    arr.setData(std::move(data), std::move(offsets));
+  };
+
+  // 17. vertexNeighbors (SimplexId arrays, offsets then data)
+  read_variable(this->vertexNeighborData_, header.nVerts);
+  // 18. cellNeighbors (SimplexId arrays, offsets then data)
+  read_variable(this->cellNeighborData_, this->getNumberOfCells());
+  // 19. vertexEdges (SimplexId arrays, offsets then data)
+  read_variable(this->vertexEdgeData_, header.nVerts);
+  // 20. vertexTriangles (SimplexId arrays, offsets then data)
+  read_variable(this->vertexTriangleData_, header.nVerts);
+  // 21. edgeTriangles (SimplexId arrays, offsets then data)
+  read_variable(this->edgeTriangleData_, header.nEdges);
+  // 22. vertexStars (SimplexId arrays, offsets then data)
+  read_variable(this->vertexStarData_, header.nVerts);
+  // 23. edgeStars (SimplexId arrays, offsets then data)
+  read_variable(this->edgeStarData_, header.nEdges);
+  // 24. triangleStars (SimplexId arrays, offsets then data)
+  read_variable(this->triangleStarData_, header.nTriangles);
+  // 25. vertexLinks (SimplexId arrays, offsets then data)
+  read_variable(this->vertexLinkData_, header.nVerts);
+  // 26. edgeLinks (SimplexId arrays, offsets then data)
+  read_variable(this->edgeLinkData_, header.nEdges);
+  // 27. triangleLinks (SimplexId arrays, offsets then data)
+  read_variable(this->triangleLinkData_, header.nTriangles);
+
+  const auto read_bool = [&](std::vector<bool> &arr, const SimplexId n_items) {
+    const auto &section = sections[sectionId++];
+    if(section.size == 0) {
+      return;
+    }
+    if(section.size != static_cast<size_t>(n_items)) {
+      valid = false;
+      return;
+    }
+    std::vector<char> buff(n_items);
+    valid &= reader.copy(section, buff.data());
+    arr.resize(n_items);
+    for(SimplexId i = 0; i < n_items; ++i) {
+      arr[i] = static_cast<bool>(buff[i]);
+    }
+  };
+
+  // 28. boundary vertices (bool array)
+  read_bool(this->boundaryVertices_, header.nVerts);
+  // 29. boundary edges (bool array)
+  read_bool(this->boundaryEdges_, header.nEdges);
+  // 30. boundary triangles (bool array)
+  read_bool(this->boundaryTriangles_, header.nTriangles);
+
+  if(!valid) {
+    this->printErr("Inconsistent array sizes in input file!");
+    // no partially read (or dangling) array should prevent the
+    // preconditions from computing them again
+    this->clearFileSections();
+    return -1;
+  }
+
+  return 0;
+}
+
+void ExplicitTriangulation::clearFileSections() {
+  this->edgeList_ = {};
+  this->triangleList_ = {};
+  this->triangleEdgeList_ = {};
+  this->tetraEdgeList_ = {};
+  this->tetraTriangleList_ = {};
+
+  this->vertexNeighborData_.clear();
+  this->cellNeighborData_.clear();
+  this->vertexEdgeData_.clear();
+  this->vertexTriangleData_.clear();
+  this->edgeTriangleData_.clear();
+  this->vertexStarData_.clear();
+  this->edgeStarData_.clear();
+  this->triangleStarData_.clear();
+  this->vertexLinkData_.clear();
+  this->edgeLinkData_.clear();
+  this->triangleLinkData_.clear();
+
+  this->boundaryVertices_ = {};
+  this->boundaryEdges_ = {};
+  this->boundaryTriangles_ = {};
+}
+
 int ExplicitTriangulation::readFromFile(std::ifstream &stream) {
 
   // 1. magic bytes (char *)
@@ -1764,43 +2037,312 @@ int ExplicitTriangulation::readFromFile(std::ifstream &stream) {
     this->printErr("Aborting...");
     return 0;
   }
-  // 2. format version (unsigned long)
-  unsigned long version{};
-  readBin(stream, version);
-  if(version != ttk::ExplicitTriangulation::formatVersion_) {
-    this->printWrn("File format version (" + std::to_string(version)
-                   + ") and software version ("
-                   + std::to_string(ttk::ExplicitTriangulation::formatVersion_)
-                   + ") are different!");
-  }
 
-  int dim{};
-  SimplexId nVerts{}, nEdges{}, nTriangles{}, nTetras{};
+  FileHeader header{};
 
+  // 2. format version (unsigned long)
+  readBin(stream, header.version);
   // 3. dimensionality (int)
-  readBin(stream, dim);
+  readBin(stream, header.dim);
   // 4. number of vertices (SimplexId)
-  readBin(stream, nVerts);
+  readBin(stream, header.nVerts);
   // 5. number of edges (SimplexId)
-  readBin(stream, nEdges);
+  readBin(stream, header.nEdges);
   // 6. number of triangles (SimplexId, 0 in 1D)
-  readBin(stream, nTriangles);
+  readBin(stream, header.nTriangles);
   // 7. number of tetrahedron (SimplexId, 0 in 2D)
-  readBin(stream, nTetras);
+  readBin(stream, header.nTetras);
 
-  if(dim != this->getDimensionality()) {
-    this->printErr("Incorrect dimension!");
+  if(this->checkFileHeader(header) != 0) {
     return 0;
   }
-  if(nVerts != this->getNumberOfVertices()) {
-    this->printErr("Incorrect number of vertices!");
+
+  if(header.version < 2) {
+    return this->readFromFileLegacy(stream, header);
+  }
+
+  // 8. size of SimplexId (int)
+  int idSize{};
+  readBin(stream, idSize);
+  if(idSize != sizeof(SimplexId)) {
+    this->printErr("Incompatible SimplexId size (" + std::to_string(idSize)
+                   + " bytes)!");
     return 0;
   }
-  if((dim == 2 && nTriangles != this->getNumberOfCells())
-     || (dim == 3 && nTetras != this->getNumberOfCells())) {
-    this->printErr("Incorrect number of cells!");
+  // 9. checksum of the input cells (uint64_t)
+  uint64_t checksum{};
+  readBin(stream, checksum);
+  if(this->checkFileChecksum(checksum) != 0) {
+    return -1;
+  }
+  // 10. number of arrays (uint64_t)
+  uint64_t nSections{};
+  readBin(stream, nSections);
+  if(nSections != FILE_SECTIONS_NUMBER) {
+    this->printErr("Incorrect number of arrays!");
     return 0;
   }
+  // 11. table of contents
+  std::vector<FileSection> sections(nSections);
+  readBinArray(stream, sections.data(), sections.size());
+
+  // 12. -> 30. copy array contents into internal buffers
+  struct {
+    std::ifstream &stream;
+    bool copy(const FileSection &section, void *const dst) {
+      this->stream.seekg(section.offset);
+      this->stream.read(static_cast<char *>(dst), section.size);
+      return this->stream.good();
+    }
+    const SimplexId *view(const FileSection &ttkNotUsed(section)) {
+      return nullptr;
+    }
+  } reader{stream};
+
+  if(this->readFileSections(header, sections, reader) != 0) {
+    return -1;
+  }
+
+  return 0;
+}
+
+int ExplicitTriangulation::readFromMappedFile(const std::string &fileName) {
+
+  Timer tm{};
+
+  auto mappedFile = std::make_shared<MemoryMappedFile>();
+  if(mappedFile->open(fileName) != 0) {
+    this->printErr("Could not map file `" + fileName + "' in memory");
+    return -1;
+  }
+
+  // bounds-checked cursor over the mapped file
+  size_t cursor{};
+  const auto read_mapped = [&mappedFile, &cursor](void *dst, size_t size) {
+    if(cursor + size > mappedFile->size()) {
+      return false;
+    }
+    std::memcpy(dst, mappedFile->data() + cursor, size);
+    cursor += size;
+    return true;
+  };
+
+  // 1. magic bytes (char *)
+  const auto magicBytesLen
+    = std::strlen(ttk::ExplicitTriangulation::magicBytes_);
+  std::vector<char> mBytes(magicBytesLen + 1);
+  if(!read_mapped(mBytes.data(), magicBytesLen)
+     || std::strcmp(mBytes.data(), ttk::ExplicitTriangulation::magicBytes_)
+          != 0) {
+    this->printErr("Could not find magic bytes in input files!");
+    this->printErr("Aborting...");
+    return -1;
+  }
+
+  FileHeader header{};
+  int idSize{};
+  uint64_t nSections{};
+
+  // 2. -> 7. format version, dimensionality, number of simplices
+  const bool hasHeader
+    = read_mapped(&header.version, sizeof(header.version))
+      && read_mapped(&header.dim, sizeof(header.dim))
+      && read_mapped(&header.nVerts, sizeof(header.nVerts))
+      && read_mapped(&header.nEdges, sizeof(header.nEdges))
+      && read_mapped(&header.nTriangles, sizeof(header.nTriangles))
+      && read_mapped(&header.nTetras, sizeof(header.nTetras));
+  if(!hasHeader) {
+    this->printErr("Truncated file header!");
+    return -1;
+  }
+
+  if(header.version < 2) {
+    // legacy files have unaligned arrays, copy them instead
+    mappedFile->close();
+    this->printWrn("Legacy file format, arrays will be copied");
+    std::ifstream stream(fileName, std::ios::in | std::ios::binary);
+    return this->readFromFile(stream);
+  }
+
+  if(this->checkFileHeader(header) != 0) {
+    return -1;
+  }
+
+  // 8. size of SimplexId (int), 9. checksum of the input cells
+  // (uint64_t) & 10. number of arrays (uint64_t)
+  uint64_t checksum{};
+  if(!read_mapped(&idSize, sizeof(idSize))
+     || !read_mapped(&checksum, sizeof(checksum))
+     || !read_mapped(&nSections, sizeof(nSections))) {
+    this->printErr("Truncated file header!");
+    return -1;
+  }
+  if(idSize != sizeof(SimplexId)) {
+    this->printErr("Incompatible SimplexId size (" + std::to_string(idSize)
+                   + " bytes)!");
+    return -1;
+  }
+  if(this->checkFileChecksum(checksum) != 0) {
+    return -1;
+  }
+  if(nSections != FILE_SECTIONS_NUMBER) {
+    this->printErr("Incorrect number of arrays!");
+    return -1;
+  }
+
+  // 11. table of contents
+  std::vector<FileSection> sections(nSections);
+  if(!read_mapped(sections.data(), nSections * sizeof(FileSection))) {
+    this->printErr("Truncated file header!");
+    return -1;
+  }
+  for(const auto &section : sections) {
+    if(section.offset + section.size > mappedFile->size()
+       || section.offset % alignof(SimplexId) != 0) {
+      this->printErr("Corrupted table of contents!");
+      return -1;
+    }
+  }
+
+  // 12. -> 30. point to the variable-size arrays in the mapped pages,
+  // copy the others
+  struct {
+    const char *const base;
+    bool copy(const FileSection &section, void *const dst) {
+      std::memcpy(dst, this->base + section.offset, section.size);
+      return true;
+    }
+    const SimplexId *view(const FileSection &section) {
+      return reinterpret_cast<const SimplexId *>(this->base + section.offset);
+    }
+  } reader{mappedFile->data()};
+
+  if(this->readFileSections(header, sections, reader) != 0) {
+    return -1;
+  }
+
+  // keep the mapping alive as long as the views are used
+  this->mappedFile_ = std::move(mappedFile);
+
+  this->printMsg("Mapped triangulation file", 1.0, tm.getElapsedTime(), 1,
+                 debug::LineMode::NEW, debug::Priority::DETAIL);
+
+  return 0;
+}
+
+int ExplicitTriangulation::appendToFile(const std::string &fileName) const {
+
+  std::fstream stream(
+    fileName, std::ios::in | std::ios::out | std::ios::binary);
+  if(!stream.good()) {
+    return -1;
+  }
+
+  // 1. magic bytes (char *)
+  const auto magicBytesLen
+    = std::strlen(ttk::ExplicitTriangulation::magicBytes_);
+  std::vector<char> mBytes(magicBytesLen + 1);
+  stream.read(mBytes.data(), magicBytesLen);
+  if(std::strcmp(mBytes.data(), ttk::ExplicitTriangulation::magicBytes_)
+     != 0) {
+    return -2;
+  }
+
+  // 2. -> 10. header of the stored file
+  FileHeader header{};
+  int idSize{};
+  uint64_t checksum{}, nSections{};
+  readBin(stream, header.version);
+  readBin(stream, header.dim);
+  readBin(stream, header.nVerts);
+  const auto countsPos = stream.tellg();
+  readBin(stream, header.nEdges);
+  readBin(stream, header.nTriangles);
+  readBin(stream, header.nTetras);
+  readBin(stream, idSize);
+  readBin(stream, checksum);
+  readBin(stream, nSections);
+  if(!stream.good() || header.version != formatVersion_
+     || idSize != sizeof(SimplexId) || checksum != this->fileChecksum_
+     || nSections != FILE_SECTIONS_NUMBER) {
+    return -2;
+  }
+
+  // 11. table of contents
+  const auto tocPos = stream.tellg();
+  std::vector<FileSection> sections(nSections);
+  readBinArray(stream, sections.data(), sections.size());
+  if(!stream.good()) {
+    return -2;
+  }
+
+  // the stored numbers of edges and triangles are 0 until they are
+  // computed, the other ones should match
+  FileHeader current{};
+  this->getFileHeader(current);
+  if(header.dim != current.dim || header.nVerts != current.nVerts
+     || header.nTetras != current.nTetras
+     || (header.nEdges != 0 && header.nEdges != current.nEdges)
+     || (header.nTriangles != 0 && header.nTriangles != current.nTriangles)) {
+    return -2;
+  }
+
+  std::vector<std::pair<const char *, size_t>> buffers{};
+  std::array<std::vector<char>, 3> boolBuffers{};
+  this->listFileBuffers(buffers, boolBuffers);
+
+  // check the stored arrays before appending anything
+  bool newArrays{false};
+  for(size_t i = 0; i < buffers.size(); ++i) {
+    if(buffers[i].second == 0) {
+      continue;
+    }
+    if(sections[i].size == 0) {
+      newArrays = true;
+    } else if(sections[i].size != buffers[i].second) {
+      return -2;
+    }
+  }
+  if(!newArrays) {
+    return 0;
+  }
+
+  // 12. -> 30. append the new arrays at the (aligned) end of the file
+  stream.seekp(0, std::ios::end);
+  auto curr = static_cast<size_t>(stream.tellp());
+  const std::array<char, FILE_ALIGNMENT> padding{};
+  for(size_t i = 0; i < buffers.size(); ++i) {
+    if(buffers[i].second == 0 || sections[i].size != 0) {
+      continue;
+    }
+    const auto offset = alignFileOffset(curr);
+    stream.write(padding.data(), offset - curr);
+    stream.write(buffers[i].first, buffers[i].second);
+    sections[i] = {offset, buffers[i].second};
+    curr = offset + buffers[i].second;
+  }
+  // the arrays should be stored before being referenced
+  stream.flush();
+
+  // 5. & 6. numbers of edges and triangles
+  stream.seekp(countsPos);
+  writeBin(stream, current.nEdges);
+  writeBin(stream, current.nTriangles);
+  // 11. updated table of contents
+  stream.seekp(tocPos);
+  writeBinArray(stream, sections.data(), sections.size());
+  stream.flush();
+
+  return stream.good() ? 0 : -3;
+}
+
+int ExplicitTriangulation::readFromFileLegacy(std::ifstream &stream,
+                                              const FileHeader &header) {
+
+  const auto nVerts = header.nVerts;
+  const auto nEdges = header.nEdges;
+  const auto nTriangles = header.nTriangles;
+  const auto nTetras = header.nTetras;
 
   // fixed-size arrays (in AbstractTriangulation.h)
 
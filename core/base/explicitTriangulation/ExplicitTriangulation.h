@@ -94,6 +94,16 @@ namespace ttk {
       return &cellNeighborList_;
     }
 
+    inline const FlatJaggedArray *
+      TTK_TRIANGULATION_INTERNAL(getCellNeighborsCSR)() override {
+      return &cellNeighborData_;
+    }
+
+    inline SimplexRange TTK_TRIANGULATION_INTERNAL(getCellNeighborsRange)(
+      const SimplexId &cellId) const override {
+      return cellNeighborData_[cellId];
+    }
+
     inline int getCellTriangleInternal(const SimplexId &cellId,
                                        const int &localTriangleId,
                                        SimplexId &triangleId) const override {
@@ -178,6 +188,16 @@ namespace ttk {
       return &edgeLinkList_;
     }
 
+    inline const FlatJaggedArray *
+      TTK_TRIANGULATION_INTERNAL(getEdgeLinksCSR)() override {
+      return &edgeLinkData_;
+    }
+
+    inline SimplexRange TTK_TRIANGULATION_INTERNAL(getEdgeLinksRange)(
+      const SimplexId &edgeId) const override {
+      return edgeLinkData_[edgeId];
+    }
+
     inline int TTK_TRIANGULATION_INTERNAL(getEdgeStar)(
       const SimplexId &edgeId,
       const int &localStarId,
@@ -198,6 +218,16 @@ namespace ttk {
       return &edgeStarList_;
     }
 
+    inline const FlatJaggedArray *
+      TTK_TRIANGULATION_INTERNAL(getEdgeStarsCSR)() override {
+      return &edgeStarData_;
+    }
+
+    inline SimplexRange TTK_TRIANGULATION_INTERNAL(getEdgeStarsRange)(
+      const SimplexId &edgeId) const override {
+      return edgeStarData_[edgeId];
+    }
+
     inline int getEdgeTriangleInternal(const SimplexId &edgeId,
                                        const int &localTriangleId,
                                        SimplexId &triangleId) const override {
@@ -216,6 +246,15 @@ namespace ttk {
       return &edgeTriangleList_;
     }
 
+    inline const FlatJaggedArray *getEdgeTrianglesCSRInternal() override {
+      return &edgeTriangleData_;
+    }
+
+    inline SimplexRange
+      getEdgeTrianglesRangeInternal(const SimplexId &edgeId) const override {
+      return edgeTriangleData_[edgeId];
+    }
+
     inline int getEdgeVertexInternal(const SimplexId &edgeId,
                                      const int &localVertexId,
                                      SimplexId &vertexId) const override {
@@ -311,6 +350,16 @@ namespace ttk {
       return &triangleLinkList_;
     }
 
+    inline const FlatJaggedArray *
+      TTK_TRIANGULATION_INTERNAL(getTriangleLinksCSR)() override {
+      return &triangleLinkData_;
+    }
+
+    inline SimplexRange TTK_TRIANGULATION_INTERNAL(getTriangleLinksRange)(
+      const SimplexId &triangleId) const override {
+      return triangleLinkData_[triangleId];
+    }
+
     inline int TTK_TRIANGULATION_INTERNAL(getTriangleStar)(
       const SimplexId &triangleId,
       const int &localStarId,
@@ -330,6 +379,16 @@ namespace ttk {
       return &triangleStarList_;
     }
 
+    inline const FlatJaggedArray *
+      TTK_TRIANGULATION_INTERNAL(getTriangleStarsCSR)() override {
+      return &triangleStarData_;
+    }
+
+    inline SimplexRange TTK_TRIANGULATION_INTERNAL(getTriangleStarsRange)(
+      const SimplexId &triangleId) const override {
+      return triangleStarData_[triangleId];
+    }
+
     inline int getTriangleVertexInternal(const SimplexId &triangleId,
                                          const int &localVertexId,
                                          SimplexId &vertexId) const override {
@@ -362,6 +421,15 @@ namespace ttk {
       return &vertexEdgeList_;
     }
 
+    inline const FlatJaggedArray *getVertexEdgesCSRInternal() override {
+      return &vertexEdgeData_;
+    }
+
+    inline SimplexRange
+      getVertexEdgesRangeInternal(const SimplexId &vertexId) const override {
+      return vertexEdgeData_[vertexId];
+    }
+
     inline int TTK_TRIANGULATION_INTERNAL(getVertexLink)(
       const SimplexId &vertexId,
       const int &localLinkId,
@@ -382,6 +450,16 @@ namespace ttk {
       return &vertexLinkList_;
     }
 
+    inline const FlatJaggedArray *
+      TTK_TRIANGULATION_INTERNAL(getVertexLinksCSR)() override {
+      return &vertexLinkData_;
+    }
+
+    inline SimplexRange TTK_TRIANGULATION_INTERNAL(getVertexLinksRange)(
+      const SimplexId &vertexId) const override {
+      return vertexLinkData_[vertexId];
+    }
+
     inline int TTK_TRIANGULATION_INTERNAL(getVertexNeighbor)(
       const SimplexId &vertexId,
       const int &localNeighborId,
@@ -402,6 +480,16 @@ namespace ttk {
       return &vertexNeighborList_;
     }
 
+    inline const FlatJaggedArray *
+      TTK_TRIANGULATION_INTERNAL(getVertexNeighborsCSR)() override {
+      return &vertexNeighborData_;
+    }
+
+    inline SimplexRange TTK_TRIANGULATION_INTERNAL(getVertexNeighborsRange)(
+      const SimplexId &vertexId) const override {
+      return vertexNeighborData_[vertexId];
+    }
+
     inline int TTK_TRIANGULATION_INTERNAL(getVertexPoint)(
       const SimplexId &vertexId, float &x, float &y, float &z) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -441,6 +529,16 @@ namespace ttk {
       return &vertexStarList_;
     }
 
+    inline const FlatJaggedArray *
+      TTK_TRIANGULATION_INTERNAL(getVertexStarsCSR)() override {
+      return &vertexStarData_;
+    }
+
+    inline SimplexRange TTK_TRIANGULATION_INTERNAL(getVertexStarsRange)(
+      const SimplexId &vertexId) const override {
+      return vertexStarData_[vertexId];
+    }
+
     inline int getVertexTriangleInternal(const SimplexId &vertexId,
                                          const int &localTriangleId,
                                          SimplexId &triangleId) const override {
@@ -459,6 +557,15 @@ namespace ttk {
       return &vertexTriangleList_;
     }
 
+    inline const FlatJaggedArray *getVertexTrianglesCSRInternal() override {
+      return &vertexTriangleData_;
+    }
+
+    inline SimplexRange getVertexTrianglesRangeInternal(
+      const SimplexId &vertexId) const override {
+      return vertexTriangleData_[vertexId];
+    }
+
     inline bool TTK_TRIANGULATION_INTERNAL(isEdgeOnBoundary)(
       const SimplexId &edgeId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -613,12 +720,49 @@ namespace ttk {
      * @brief Write internal state to disk using an ASCII format
      */
     int writeToFileASCII(std::ofstream &stream) const;
+    /**
+     * @brief Append the arrays missing from a file written by writeToFile
+     *
+     * Only the new arrays are written, at the end of the file, then the
+     * header and the table of contents are updated. Previous readers
+     * of the file remain valid.
+     *
+     * @return 0 in case of success, a negative value if the file cannot
+     * be updated (it should then be written again)
+     */
+    int appendToFile(const std::string &fileName) const;
     /**
      * @brief Read from disk into internal state
      *
      * Use a custom binary format for fast loading
      */
     int readFromFile(std::ifstream &stream);
+    /**
+     * @brief Memory-map a file written by writeToFile into internal state
+     *
+     * The variable-size arrays (stars, links, neighbors...) are not
+     * copied but directly point into the mapped pages, which are only
+     * loaded when accessed and shared between processes. The mapping is
+     * kept alive as long as the triangulation (or one of its copies)
+     * exists. Falls back to readFromFile for legacy (version 1) files.
+     */
+    int readFromMappedFile(const std::string &fileName);
+    /**
+     * @brief Number of non-empty arrays stored by writeToFile
+     *
+     * Grows when new preconditioning results are available.
+     */
+    int getNumberOfStoredArrays() const;
+    /**
+     * @brief Checksum of the input cells written in the binary file
+     * format
+     *
+     * The readers reject the files storing another checksum (0 disables
+     * the check).
+     */
+    inline void setFileChecksum(const uint64_t checksum) {
+      this->fileChecksum_ = checksum;
+    }
 
 #ifdef TTK_ENABLE_MPI
 
@@ -807,6 +951,37 @@ namespace ttk {
     FlatJaggedArray edgeLinkData_{};
     FlatJaggedArray triangleLinkData_{};
 
+    // memory-mapped file backing the FlatJaggedArrays above (if any)
+    std::shared_ptr<MemoryMappedFile> mappedFile_{};
+    // checksum of the input cells in the binary file format
+    uint64_t fileChecksum_{};
+
+    // position & size (in bytes) of an array in the binary file format
+    struct FileSection {
+      uint64_t offset;
+      uint64_t size;
+    };
+
+    // first fields of the binary file format
+    struct FileHeader {
+      unsigned long version;
+      int dim;
+      SimplexId nVerts, nEdges, nTriangles, nTetras;
+    };
+
+    int checkFileHeader(const FileHeader &header) const;
+    int checkFileChecksum(const uint64_t checksum) const;
+    void getFileHeader(FileHeader &header) const;
+    void listFileBuffers(std::vector<std::pair<const char *, size_t>> &buffers,
+                         std::array<std::vector<char>, 3> &boolBuffers) const;
+    int readFromFileLegacy(std::ifstream &stream, const FileHeader &header);
+    // reset the arrays filled by readFileSections
+    void clearFileSections();
+    template <typename SectionReader>
+    int readFileSections(const FileHeader &header,
+                         const std::vector<FileSection> &sections,
+                         SectionReader &reader);
+
     // Char array that identifies the file format.
     static const char *magicBytes_;
     // Current version of the file format. To be incremented at every
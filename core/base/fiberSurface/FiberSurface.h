@@ -175,8 +175,7 @@ namespace ttk {
       return 0;
     }
 
-    inline int
-      setTetNeighbors(const std::vector<std::vector<SimplexId>> *tetNeighbors) {
+    inline int setTetNeighbors(const FlatJaggedArray *tetNeighbors) {
       tetNeighbors_ = tetNeighbors;
       return 0;
     }
@@ -483,7 +482,7 @@ namespace ttk {
     const void *uField_{}, *vField_{};
     const float *pointSet_{};
     const SimplexId *tetList_{};
-    const std::vector<std::vector<SimplexId>> *tetNeighbors_{};
+    const FlatJaggedArray *tetNeighbors_{};
     std::array<SimplexId, 12> edgeImplicitEncoding_{
       0, 1, 0, 2, 0, 3, 3, 1, 2, 1, 2, 3};
 
@@ -1597,10 +1596,9 @@ int ttk::FiberSurface::computeContour(
 
         if(createdVertices) {
           // only propagate if we created a triangle
-          for(SimplexId j = 0; j < (SimplexId)(*tetNeighbors_)[tetId].size();
-              j++) {
-            if(!visitedTets[(*tetNeighbors_)[tetId][j]]) {
-              threadedTetQueue[i].push_back((*tetNeighbors_)[tetId][j]);
+          for(const auto neighbor : (*tetNeighbors_)[tetId]) {
+            if(!visitedTets[neighbor]) {
+              threadedTetQueue[i].push_back(neighbor);
             }
           }
         }
@@ -13,6 +13,10 @@
 
 #include "FTMTree.h"
 
+#ifdef TTK_ENABLE_MPI
+#include <FlatUnionFind.h>
+#endif // TTK_ENABLE_MPI
+
 using namespace std;
 using namespace ttk;
 using namespace ftm;
@@ -21,3 +25,165 @@ FTMTree::FTMTree()
   : FTMTree_CT(std::make_shared<Params>(), std::make_shared<Scalars>()) {
   this->setDebugMsgPrefix("FTMTree");
 }
+
+#ifdef TTK_ENABLE_MPI
+
+void FTMTree::computeLocalOrder(const SimplexId *const globalOrder,
+                                std::vector<SimplexId> &localOrder) const {
+  const auto nVerts = scalars_->size;
+  std::vector<SimplexId> sortedVerts(nVerts);
+  std::iota(sortedVerts.begin(), sortedVerts.end(), 0);
+  TTK_PSORT(this->threadNumber_, sortedVerts.begin(), sortedVerts.end(),
+            [globalOrder](const SimplexId a, const SimplexId b) {
+              return globalOrder[a] < globalOrder[b];
+            });
+  localOrder.resize(nVerts);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < nVerts; i++) {
+    localOrder[sortedVerts[i]] = i;
+  }
+}
+
+void FTMTree::mergeDistributedTrees(const std::vector<SimplexId> &augVerts,
+                                    const std::vector<SimplexId> &edges,
+                                    DistributedTree &distributedTree,
+                                    std::vector<idSuperArc> &upArcs) const {
+  Timer tm;
+
+  // compact identifiers of the gathered vertices (shared vertices
+  // are gathered from several ranks)
+  std::unordered_map<SimplexId, SimplexId> gidToId{};
+  std::vector<SimplexId> gids{}, keys{};
+  for(size_t i = 0; i < augVerts.size(); i += 2) {
+    if(gidToId.emplace(augVerts[i], gids.size()).second) {
+      gids.emplace_back(augVerts[i]);
+      keys.emplace_back(augVerts[i + 1]);
+    }
+  }
+  const SimplexId nVerts = gids.size();
+
+  // lower neighbors of every vertex in the glued trees
+  std::vector<SimplexId> lowerOffsets(nVerts + 1, 0), lowerNeighbors{};
+  std::vector<std::pair<SimplexId, SimplexId>> links{};
+  links.reserve(edges.size() / 2);
+  for(size_t i = 0; i < edges.size(); i += 2) {
+    auto a = gidToId[edges[i]];
+    auto b = gidToId[edges[i + 1]];
+    if(keys[a] > keys[b]) {
+      std::swap(a, b);
+    }
+    links.emplace_back(b, a);
+  }
+  TTK_PSORT(this->threadNumber_, links.begin(), links.end());
+  links.erase(std::unique(links.begin(), links.end()), links.end());
+  for(const auto &l : links) {
+    lowerOffsets[l.first + 1]++;
+  }
+  std::partial_sum(
+    lowerOffsets.begin(), lowerOffsets.end(), lowerOffsets.begin());
+  lowerNeighbors.reserve(links.size());
+  for(const auto &l : links) {
+    lowerNeighbors.emplace_back(l.second);
+  }
+
+  std::vector<SimplexId> sorted(nVerts);
+  std::iota(sorted.begin(), sorted.end(), 0);
+  TTK_PSORT(this->threadNumber_, sorted.begin(), sorted.end(),
+            [&keys](const SimplexId a, const SimplexId b) {
+              return keys[a] < keys[b];
+            });
+
+  // union-find sweep: every component has an open arc, starting at
+  // its last node, and a highest vertex
+  auto &nodesVertex = distributedTree.nodesVertex;
+  auto &nodesOrder = distributedTree.nodesOrder;
+  auto &arcs = distributedTree.arcs;
+  nodesVertex.clear();
+  nodesOrder.clear();
+  arcs.clear();
+  FlatUnionFind uf(nVerts);
+  std::vector<idSuperArc> openArc(nVerts, nullSuperArc);
+  std::vector<SimplexId> highestVert(nVerts);
+  std::vector<idSuperArc> vertUpArc(nVerts, nullSuperArc);
+  std::vector<idNode> vertNode(nVerts, nullNodes);
+  std::vector<SimplexId> roots{};
+
+  const auto addNode = [&](const SimplexId v) {
+    vertNode[v] = nodesVertex.size();
+    nodesVertex.emplace_back(gids[v]);
+    // the split tree is swept with the opposite of the global order
+    nodesOrder.emplace_back(keys[v] < 0 ? -keys[v] : keys[v]);
+    return vertNode[v];
+  };
+  const auto openNewArc = [&](const SimplexId v) {
+    arcs.push_back({vertNode[v], nullNodes});
+    return arcs.size() - 1;
+  };
+
+  for(const auto v : sorted) {
+    roots.clear();
+    for(SimplexId i = lowerOffsets[v]; i < lowerOffsets[v + 1]; i++) {
+      roots.emplace_back(uf.find(lowerNeighbors[i]));
+    }
+    std::sort(roots.begin(), roots.end());
+    roots.erase(std::unique(roots.begin(), roots.end()), roots.end());
+
+    if(roots.size() == 1) {
+      // regular vertex
+      vertUpArc[v] = openArc[roots[0]];
+    } else {
+      // leaf or saddle: close the arcs of the merged components
+      const auto n = addNode(v);
+      for(const auto r : roots) {
+        arcs[openArc[r]][1] = n;
+      }
+      vertUpArc[v] = openNewArc(v);
+    }
+    roots.emplace_back(v);
+    const auto r = uf.makeUnion(roots);
+    openArc[r] = vertUpArc[v];
+    highestVert[r] = v;
+  }
+
+  // the highest vertex of every component is a root
+  std::vector<char> removedArc(arcs.size(), 0);
+  for(SimplexId v = 0; v < nVerts; v++) {
+    if(uf.find(v) != v) {
+      continue;
+    }
+    const auto h = highestVert[v];
+    if(vertNode[h] == nullNodes) {
+      arcs[vertUpArc[h]][1] = addNode(h);
+    } else {
+      // the arc opened at this node is empty
+      removedArc[vertUpArc[h]] = 1;
+    }
+    vertUpArc[h] = nullSuperArc;
+  }
+
+  // compact the arcs
+  std::vector<idSuperArc> newArcId(arcs.size(), nullSuperArc);
+  idSuperArc nArcs{};
+  for(size_t i = 0; i < arcs.size(); i++) {
+    if(!removedArc[i]) {
+      newArcId[i] = nArcs;
+      arcs[nArcs++] = arcs[i];
+    }
+  }
+  arcs.resize(nArcs);
+
+  upArcs.resize(augVerts.size() / 2);
+  for(size_t i = 0; i < upArcs.size(); i++) {
+    const auto a = vertUpArc[gidToId[augVerts[2 * i]]];
+    upArcs[i] = a == nullSuperArc ? nullSuperArc : newArcId[a];
+  }
+
+  this->printMsg("Stitched the trees of " + std::to_string(ttk::MPIsize_)
+                   + " ranks",
+                 1.0, tm.getElapsedTime(), this->threadNumber_,
+                 debug::LineMode::NEW, debug::Priority::DETAIL);
+}
+
+#endif // TTK_ENABLE_MPI
@@ -39,6 +39,11 @@
 #include <Geometry.h>
 #include <Triangulation.h>
 
+#ifdef TTK_ENABLE_MPI
+#include <array>
+#include <unordered_map>
+#endif // TTK_ENABLE_MPI
+
 #include "FTMDataTypes.h"
 #include "FTMTree_CT.h"
 
@@ -65,8 +70,105 @@ namespace ttk {
 
       // Initialize structures then build tree
       // Need triangulation, scalars and all params set before call
+      //
+      // When running with MPI and setDistributedTrees() is on, every
+      // rank provides its part of the domain (with a layer of ghost
+      // cells) and the offsets should be a global order (see
+      // ttk::ArrayPreconditioning). The trees built are then the trees
+      // of the current rank: the join and split trees of the whole
+      // domain are given by getDistributedTree(). Only the Join, Split
+      // and Join_Split tree types are supported, the order must be
+      // global and both the block of every rank and the whole domain
+      // must be connected: an error (-1) is returned otherwise.
       template <typename scalarType, class triangulationType>
-      void build(const triangulationType *mesh);
+      int build(const triangulationType *mesh);
+
+#ifdef TTK_ENABLE_MPI
+      /**
+       * Stitch the join and split trees of every rank in build() (off
+       * by default). The stitching uses collective communications:
+       * every rank must then call build() exactly once, on its whole
+       * block of the domain, with the same tree type.
+       */
+      inline void setDistributedTrees(const bool distributedTrees) {
+        this->distributedTrees_ = distributedTrees;
+      }
+
+      /**
+       * Merge tree of a distributed domain, with its segmentation on
+       * the vertices of the current rank
+       */
+      struct DistributedTree {
+        /** global identifier of the vertex of each node */
+        std::vector<SimplexId> nodesVertex{};
+        /** global order of the vertex of each node */
+        std::vector<SimplexId> nodesOrder{};
+        /** down (leaf side) and up (root side) node of each arc */
+        std::vector<std::array<idNode, 2>> arcs{};
+        /** arc of each local vertex, nullSuperArc for the nodes */
+        std::vector<idSuperArc> vertArc{};
+        /** node of each local vertex, nullNodes for the regular ones */
+        std::vector<idNode> vertNode{};
+      };
+
+      /**
+       * Join or split tree of the whole distributed domain, filled by
+       * build() on every rank when running with MPI for the Join,
+       * Split and Join_Split tree types, if setDistributedTrees() is on
+       */
+      inline const DistributedTree &
+        getDistributedTree(const TreeType tt) const {
+        return tt == TreeType::Split ? this->distributedST_
+                                     : this->distributedJT_;
+      }
+
+    protected:
+      /**
+       * Stitch the trees of every rank along the vertices they share
+       *
+       * The local tree, augmented with the vertices shared with other
+       * ranks, is gathered on rank 0 which computes the global tree
+       * with an union-find sweep. The global tree is then broadcast
+       * and every rank projects its segmentation on it. Returns -1 if
+       * the global tree has several roots (disconnected domain).
+       */
+      template <class triangulationType>
+      int buildDistributedTree(FTMTree_MT &tree,
+                                DistributedTree &distributedTree,
+                                const triangulationType *mesh);
+
+      /**
+       * Order of the local vertices from their global order
+       */
+      void computeLocalOrder(const SimplexId *const globalOrder,
+                             std::vector<SimplexId> &localOrder) const;
+
+      /**
+       * Whether the block of the current rank (with its ghost cells) is
+       * connected, agreed upon by every rank (collective)
+       */
+      template <class triangulationType>
+      bool isDistributedBlockConnected(const triangulationType *mesh) const;
+
+      /**
+       * Global tree from the gathered augmented local trees (rank 0)
+       *
+       * @param[in] augVerts Global identifier and sweep key of the
+       * vertices of the local trees (nodes and shared vertices)
+       * @param[in] edges Global identifiers of the lower and upper
+       * vertices of the local arcs between these vertices
+       * @param[out] distributedTree Nodes and arcs of the global tree
+       * @param[out] upArcs Arc of the global tree just above each entry
+       * of @p augVerts (nullSuperArc above the roots)
+       */
+      void mergeDistributedTrees(const std::vector<SimplexId> &augVerts,
+                                 const std::vector<SimplexId> &edges,
+                                 DistributedTree &distributedTree,
+                                 std::vector<idSuperArc> &upArcs) const;
+
+      bool distributedTrees_{false};
+      DistributedTree distributedJT_{}, distributedST_{};
+#endif // TTK_ENABLE_MPI
     };
 
 #include "FTMTree_Template.h"
@@ -17,6 +17,8 @@
 
 #include "FTMTree.h"
 
+// for std::count
+#include <algorithm>
 // for std::isnan
 #include <cmath>
 // for std::numeric_limits
@@ -27,7 +29,7 @@
 // -------
 
 template <typename scalarType, class triangulationType>
-void ttk::ftm::FTMTree::build(const triangulationType *mesh) {
+int ttk::ftm::FTMTree::build(const triangulationType *mesh) {
   // -----
   // INPUT
   // -----
@@ -67,6 +69,33 @@ void ttk::ftm::FTMTree::build(const triangulationType *mesh) {
     }
   }
 
+#ifdef TTK_ENABLE_MPI
+  // the offsets are a global order: the trees of the current rank are
+  // built with the order of its vertices
+  const SimplexId *const globalOrder{scalars_->offsets};
+  std::vector<SimplexId> localOrder{};
+  const bool distributed{this->distributedTrees_ && ttk::isRunningWithMPI()};
+  if(distributed) {
+    // the merge trees would be modified by the contour tree
+    if(params_->treeType == TreeType::Contour) {
+      this->printErr("The contour tree is not supported with MPI");
+      this->printErr("(use Join_Split for the distributed merge trees)");
+      return -1;
+    }
+    if(!ttk::isGlobalOrder(globalOrder, mesh, ttk::MPIcomm_)) {
+      this->printErr("The order field is not a global order");
+      this->printErr("Use ttkArrayPreconditioning to compute one");
+      return -1;
+    }
+    if(!this->isDistributedBlockConnected(mesh)) {
+      this->printErr("The block of every rank should be connected");
+      return -1;
+    }
+    this->computeLocalOrder(globalOrder, localOrder);
+    scalars_->offsets = localOrder.data();
+  }
+#endif // TTK_ENABLE_MPI
+
   // Alloc / reserve
   Timer initTime;
   switch(params_->treeType) {
@@ -181,6 +210,24 @@ void ttk::ftm::FTMTree::build(const triangulationType *mesh) {
     }
   }
 
+#ifdef TTK_ENABLE_MPI
+  if(distributed) {
+    scalars_->offsets = globalOrder;
+    if(params_->treeType == TreeType::Join
+       || params_->treeType == TreeType::Join_Split) {
+      if(buildDistributedTree(*getJoinTree(), distributedJT_, mesh) != 0) {
+        return -1;
+      }
+    }
+    if(params_->treeType == TreeType::Split
+       || params_->treeType == TreeType::Join_Split) {
+      if(buildDistributedTree(*getSplitTree(), distributedST_, mesh) != 0) {
+        return -1;
+      }
+    }
+  }
+#endif // TTK_ENABLE_MPI
+
   if(debugLevel_ > 4) {
     switch(params_->treeType) {
       case TreeType::Join:
@@ -197,4 +244,217 @@ void ttk::ftm::FTMTree::build(const triangulationType *mesh) {
         printTree2();
     }
   }
+
+  return 0;
 }
+
+#ifdef TTK_ENABLE_MPI
+
+template <class triangulationType>
+bool ttk::ftm::FTMTree::isDistributedBlockConnected(
+  const triangulationType *mesh) const {
+  const SimplexId nVerts = mesh->getNumberOfVertices();
+  // breadth-first search from the first vertex
+  std::vector<char> visited(nVerts, 0);
+  std::vector<SimplexId> queue{};
+  queue.reserve(nVerts);
+  if(nVerts > 0) {
+    visited[0] = 1;
+    queue.emplace_back(0);
+  }
+  for(size_t i = 0; i < queue.size(); i++) {
+    const auto nNeighs = mesh->getVertexNeighborNumber(queue[i]);
+    for(SimplexId j = 0; j < nNeighs; j++) {
+      SimplexId n;
+      mesh->getVertexNeighbor(queue[i], j, n);
+      if(!visited[n]) {
+        visited[n] = 1;
+        queue.emplace_back(n);
+      }
+    }
+  }
+  int connected = static_cast<SimplexId>(queue.size()) == nVerts;
+  MPI_Allreduce(MPI_IN_PLACE, &connected, 1, MPI_INT, MPI_MIN, ttk::MPIcomm_);
+  return connected != 0;
+}
+
+template <class triangulationType>
+int ttk::ftm::FTMTree::buildDistributedTree(FTMTree_MT &tree,
+                                             DistributedTree &distributedTree,
+                                             const triangulationType *mesh) {
+  Timer tm;
+
+  const SimplexId nVerts = mesh->getNumberOfVertices();
+  const SimplexId nCells = mesh->getNumberOfCells();
+  const SimplexId *const order = scalars_->offsets;
+  // the split tree is swept by decreasing global order
+  const bool isST = tree.isST();
+  const auto key = [order, isST](const SimplexId v) -> SimplexId {
+    return isST ? -order[v] : order[v];
+  };
+
+  // 1. vertices that may be shared with other ranks: the vertices of
+  // the cells of other ranks and their neighbors
+  std::vector<char> inGhostCell(nVerts, 0);
+  for(SimplexId c = 0; c < nCells; c++) {
+    if(mesh->getCellRank(c) == ttk::MPIrank_) {
+      continue;
+    }
+    const auto nCellVerts = mesh->getCellVertexNumber(c);
+    for(SimplexId i = 0; i < nCellVerts; i++) {
+      SimplexId v;
+      mesh->getCellVertex(c, i, v);
+      inGhostCell[v] = 1;
+    }
+  }
+  std::vector<char> isShared(nVerts, 0);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId v = 0; v < nVerts; v++) {
+    isShared[v] = inGhostCell[v];
+    const auto nNeighs = mesh->getVertexNeighborNumber(v);
+    for(SimplexId i = 0; i < nNeighs && !isShared[v]; i++) {
+      SimplexId n;
+      mesh->getVertexNeighbor(v, i, n);
+      isShared[v] = inGhostCell[n];
+    }
+  }
+
+  // 2. local tree augmented with the shared vertices: chain of the
+  // nodes and shared vertices along each local arc
+  const idSuperArc nArcs = tree.getNumberOfSuperArcs();
+  std::vector<std::vector<SimplexId>> arcVerts(nArcs);
+  std::vector<SimplexId> augVerts{};
+  for(SimplexId v = 0; v < nVerts; v++) {
+    if(tree.isCorrespondingNode(v)) {
+      augVerts.emplace_back(v);
+    } else if(isShared[v] && tree.isCorrespondingArc(v)) {
+      augVerts.emplace_back(v);
+      arcVerts[tree.getCorrespondingSuperArcId(v)].emplace_back(v);
+    }
+  }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(idSuperArc a = 0; a < nArcs; a++) {
+    auto &verts = arcVerts[a];
+    std::sort(verts.begin(), verts.end(),
+              [&key](const SimplexId u, const SimplexId v) {
+                return key(u) < key(v);
+              });
+    const auto arc = tree.getSuperArc(a);
+    verts.insert(
+      verts.begin(), tree.getNode(arc->getDownNodeId())->getVertexId());
+    if(arc->getUpNodeId() != nullNodes) {
+      verts.emplace_back(tree.getNode(arc->getUpNodeId())->getVertexId());
+    }
+  }
+
+  std::vector<SimplexId> augData{}, edges{};
+  augData.reserve(2 * augVerts.size());
+  for(const auto v : augVerts) {
+    augData.emplace_back(mesh->getVertexGlobalId(v));
+    augData.emplace_back(key(v));
+  }
+  for(const auto &verts : arcVerts) {
+    for(size_t i = 1; i < verts.size(); i++) {
+      edges.emplace_back(mesh->getVertexGlobalId(verts[i - 1]));
+      edges.emplace_back(mesh->getVertexGlobalId(verts[i]));
+    }
+  }
+
+  // 3. global tree on rank 0, broadcast to every rank
+  std::vector<SimplexId> gAugData{}, gEdges{};
+  ttk::gatherVector(augData, gAugData);
+  ttk::gatherVector(edges, gEdges);
+  std::vector<idSuperArc> gUpArcs{}, upArcs(augVerts.size());
+  if(ttk::MPIrank_ == 0) {
+    this->mergeDistributedTrees(gAugData, gEdges, distributedTree, gUpArcs);
+  }
+  ttk::scatterVector(gUpArcs, upArcs);
+  ttk::broadcastVector(distributedTree.nodesVertex);
+  ttk::broadcastVector(distributedTree.nodesOrder);
+  std::vector<idNode> arcsNodes(2 * distributedTree.arcs.size());
+  for(size_t i = 0; i < distributedTree.arcs.size(); i++) {
+    arcsNodes[2 * i] = distributedTree.arcs[i][0];
+    arcsNodes[2 * i + 1] = distributedTree.arcs[i][1];
+  }
+  ttk::broadcastVector(arcsNodes);
+  distributedTree.arcs.resize(arcsNodes.size() / 2);
+  for(size_t i = 0; i < distributedTree.arcs.size(); i++) {
+    distributedTree.arcs[i] = {arcsNodes[2 * i], arcsNodes[2 * i + 1]};
+  }
+
+  // 4. segmentation of the local vertices
+  const auto &nodesVertex = distributedTree.nodesVertex;
+  std::unordered_map<SimplexId, idNode> gidToNode{};
+  for(size_t i = 0; i < nodesVertex.size(); i++) {
+    gidToNode[nodesVertex[i]] = i;
+  }
+  std::vector<idSuperArc> nodeUpArc(nodesVertex.size(), nullSuperArc);
+  for(size_t i = 0; i < distributedTree.arcs.size(); i++) {
+    nodeUpArc[distributedTree.arcs[i][0]] = i;
+  }
+  // every rank has the same global tree: a connected domain has a
+  // single root
+  if(std::count(nodeUpArc.begin(), nodeUpArc.end(), nullSuperArc) != 1) {
+    this->printErr("The domain is not connected across the ranks");
+    return -1;
+  }
+  const auto nodeKey = [&distributedTree, isST](const idNode n) {
+    const auto o = distributedTree.nodesOrder[n];
+    return isST ? -o : o;
+  };
+
+  auto &vertArc = distributedTree.vertArc;
+  auto &vertNode = distributedTree.vertNode;
+  vertArc.assign(nVerts, nullSuperArc);
+  vertNode.assign(nVerts, nullNodes);
+  std::vector<idSuperArc> augUpArc(nVerts, nullSuperArc);
+  for(size_t i = 0; i < augVerts.size(); i++) {
+    const auto v = augVerts[i];
+    const auto it = gidToNode.find(mesh->getVertexGlobalId(v));
+    if(it != gidToNode.end()) {
+      vertNode[v] = it->second;
+    } else {
+      vertArc[v] = upArcs[i];
+    }
+    augUpArc[v] = upArcs[i];
+  }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId v = 0; v < nVerts; v++) {
+    if(tree.isCorrespondingNode(v) || isShared[v]
+       || !tree.isCorrespondingArc(v)) {
+      continue;
+    }
+    // closest lower node or shared vertex on the local arc
+    const auto &verts = arcVerts[tree.getCorrespondingSuperArcId(v)];
+    const auto lower
+      = std::lower_bound(verts.begin(), verts.end(), v,
+                         [&key](const SimplexId a, const SimplexId b) {
+                           return key(a) < key(b);
+                         })
+        - 1;
+    // go up in the global tree until the level of v
+    auto arc = augUpArc[*lower];
+    const auto k = key(v);
+    while(arc != nullSuperArc
+          && nodeKey(distributedTree.arcs[arc][1]) < k) {
+      arc = nodeUpArc[distributedTree.arcs[arc][1]];
+    }
+    vertArc[v] = arc;
+  }
+
+  this->printMsg("Built distributed "
+                   + std::string{isST ? "split" : "join"} + " tree ("
+                   + std::to_string(nodesVertex.size()) + " nodes)",
+                 1.0, tm.getElapsedTime(), this->threadNumber_);
+
+  return 0;
+}
+
+#endif // TTK_ENABLE_MPI
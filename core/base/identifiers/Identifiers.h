@@ -190,10 +190,10 @@ namespace ttk {
 
     void inline findPoint(ttk::SimplexId &id, float x, float y, float z) {
       std::array<float, 3> coordinates = {x, y, z};
-      std::vector<ttk::KDTree<float, std::array<float, 3>> *> neighbours;
+      std::vector<int> neighbours;
       std::vector<float> costs;
       kdt_.getKClosest(1, coordinates, neighbours, costs);
-      id = neighbours[0]->id_;
+      id = kdt_.getId(neighbours[0]);
     }
 
     void initializeNeighbors(double *boundingBox,
@@ -5,6 +5,14 @@
 ///
 /// \brief TTK KD-Tree
 ///
+/// The tree is implicit: the points are permuted so that the node of
+/// every range [begin, end) of the permutation is stored at the median
+/// position of the range, its subtrees being the ranges on both sides.
+/// Nodes are therefore plain indices in contiguous buffers (coordinates,
+/// weights and minimum subtree weights), the bounding boxes are derived
+/// during the traversals and a weight update only walks the path from
+/// the root to the updated node.
+///
 
 #pragma once
 
@@ -13,434 +21,370 @@
 #include <Geometry.h> // for pow
 
 #include <algorithm>
+#include <array>
 #include <limits>
 #include <memory>
+#include <numeric>
 
 namespace ttk {
   template <typename dataType, typename Container>
   class KDTree {
 
   protected:
-    // Boolean indicating if the current node is a left node of its parent
-    bool is_left_{};
-    // Indicates according to which coordinate the tree splits its elements
-    int coords_number_{0};
     // Power used for the computation of distances. p=2 yields euclidean
     // distance
     int p_{2};
     // Whether or not the KDTree should include weights that add up to distance
     // for the computation of nearest neighbours
     bool include_weights_{false};
-
-  public:
-    using KDTreeRoot = std::unique_ptr<KDTree>;
-    using KDTreeMap = std::vector<KDTree *>;
-
-    KDTreeRoot left_{}; // Lower half for the coordinate specified
-    KDTreeRoot right_{}; // Higher half
-    KDTree *parent_{};
-    // ID of the object saved here. The whole object is not kept in the KDTree
-    // Users should keep track of them in a table for instance
-    int id_{};
-    Container coordinates_{};
+    int dimension_{};
+    int nodeNumber_{};
+
+    // node -> ID of the object saved there. The whole object is not kept in
+    // the KDTree: users should keep track of them in a table for instance
+    std::vector<int> ids_{};
+    // coordinates of the nodes, axis after axis
+    std::vector<dataType> coordinates_{};
+    // bounding box of the whole tree
     Container coords_min_{};
     Container coords_max_{};
-    int level_{};
+    // weights and minimum subtree weights, per weight index and node
+    std::vector<std::vector<dataType>> weights_{};
+    std::vector<std::vector<dataType>> min_subweights_{};
 
-    std::vector<dataType> weight_{};
-    std::vector<dataType> min_subweights_{};
+  public:
+    using KDTreeRoot = std::unique_ptr<KDTree>;
+    // object ID -> node
+    using KDTreeMap = std::vector<int>;
 
     KDTree() = default;
     KDTree(const bool include_weights, const int p)
       : p_{p}, include_weights_{include_weights} {
     }
 
-    KDTree(KDTree *const father, const int coords_number, const bool is_left)
-      : is_left_{is_left}, coords_number_{coords_number},
-        include_weights_{father->include_weights_}, parent_{father} {
-    }
-
-    KDTreeMap build(dataType *data,
+    /**
+     * @brief Build the tree
+     *
+     * @param[in] data point coordinates, point after point
+     * @param[in] ptNumber number of points
+     * @param[in] dimension number of coordinates per point
+     * @param[in] weights initial weights, per weight index and point
+     * @param[in] weightNumber number of weights per point
+     * @param[in] threadNumber number of threads for the build
+     * @return the node of every point
+     */
+    KDTreeMap build(const dataType *const data,
                     const int &ptNumber,
                     const int &dimension,
                     const std::vector<std::vector<dataType>> &weights = {},
                     const int &weightNumber = 1,
-                    const int &nodeNumber = -1);
-
-    void buildRecursive(dataType *data,
-                        std::vector<int> &idx_side,
-                        const int &ptNumber,
-                        const int &dimension,
-                        KDTree<dataType, Container> *parent,
-                        KDTreeMap &correspondence_map,
-                        const int &nodeNumber,
-                        const int &maximumLevel,
-                        int &createdNumberNode,
-                        const std::vector<std::vector<dataType>> &weights = {},
-                        const int &weightNumber = 1);
-
-    inline void updateWeight(const dataType new_weight,
-                             const int weight_index = 0) {
-      weight_[weight_index] = new_weight;
-      updateMinSubweight(weight_index);
-    }
-
-    void updateMinSubweight(const int weight_index = 0);
+                    const int threadNumber = 1);
+
+    /**
+     * @brief Update the weight of a node and the minimum weights of the
+     * subtrees containing it
+     */
+    void updateWeight(const int node,
+                      const dataType new_weight,
+                      const int weight_index = 0);
+
+    /// Puts the k closest nodes to the given coordinates in the "neighbours"
+    /// vector along with their costs in the "costs" vector. The output is not
+    /// sorted, if you are interested in the k nearest neighbours in the order,
+    /// will need to sort them according to their cost.
     void getKClosest(const unsigned int k,
                      const Container &coordinates,
-                     KDTreeMap &neighbours,
+                     std::vector<int> &neighbours,
                      std::vector<dataType> &costs,
-                     const int weight_index = 0);
+                     const int weight_index = 0) const;
+
+    /**
+     * @brief Batched version of getKClosest, the queries being processed
+     * in parallel
+     */
+    void getKClosest(const unsigned int k,
+                     const std::vector<Container> &coordinates,
+                     std::vector<std::vector<int>> &neighbours,
+                     std::vector<std::vector<dataType>> &costs,
+                     const int weight_index = 0,
+                     const int threadNumber = 1) const;
+
+    inline int getId(const int node) const {
+      return ids_[node];
+    }
+    inline dataType getWeight(const int node,
+                              const int weight_index = 0) const {
+      return weights_[weight_index][node];
+    }
+    inline dataType getMinSubWeight(const int node,
+                                    const int weight_index = 0) const {
+      return min_subweights_[weight_index][node];
+    }
+    inline int size() const {
+      return nodeNumber_;
+    }
+
+  protected:
+    // node of the range [begin, end)
+    static inline int getMedian(const int begin, const int end) {
+      return begin + (end - begin - 1) / 2;
+    }
+
+    void buildRecursive(const dataType *const data,
+                        const std::vector<std::vector<dataType>> &weights,
+                        std::vector<int> &perm,
+                        const int begin,
+                        const int end,
+                        const int depth);
+
+    void updateMinSubweight(const int begin,
+                            const int end,
+                            const int weight_index);
 
     template <typename PowerFunc>
     void recursiveGetKClosest(const unsigned int k,
                               const Container &coordinates,
-                              KDTreeMap &neighbours,
+                              Container &box_min,
+                              Container &box_max,
+                              const int begin,
+                              const int end,
+                              const int depth,
+                              std::vector<int> &neighbours,
                               std::vector<dataType> &costs,
                               const int weight_index,
-                              const PowerFunc &power);
+                              const PowerFunc &power) const;
 
     template <typename PowerFunc>
-    inline dataType getCost(const Container &coordinates,
+    inline dataType getCost(const int node,
+                            const Container &coordinates,
                             const PowerFunc &power) const {
       dataType cost = 0;
-      for(size_t i = 0; i < coordinates.size(); i++) {
-        cost += power(std::abs(coordinates[i] - coordinates_[i]));
+      for(int axis = 0; axis < dimension_; axis++) {
+        cost += power(std::abs(
+          coordinates[axis] - coordinates_[axis * nodeNumber_ + node]));
       }
       return cost;
     }
 
     template <typename PowerFunc>
-    inline dataType distanceToBox(const KDTree<dataType, Container> &subtree,
+    inline dataType distanceToBox(const Container &box_min,
+                                  const Container &box_max,
                                   const Container &coordinates,
                                   const PowerFunc &power) const {
       dataType d_min = 0;
-      for(size_t axis = 0; axis < coordinates.size(); axis++) {
-        if(subtree.coords_min_[axis] > coordinates[axis]) {
-          d_min += power(subtree.coords_min_[axis] - coordinates[axis]);
-        } else if(subtree.coords_max_[axis] < coordinates[axis]) {
-          d_min += power(coordinates[axis] - subtree.coords_max_[axis]);
+      for(int axis = 0; axis < dimension_; axis++) {
+        if(box_min[axis] > coordinates[axis]) {
+          d_min += power(box_min[axis] - coordinates[axis]);
+        } else if(box_max[axis] < coordinates[axis]) {
+          d_min += power(coordinates[axis] - box_max[axis]);
         }
       }
       return d_min;
     }
-
-    inline const std::vector<dataType> &getCoordinates() const {
-      return coordinates_;
-    }
-    inline dataType getWeight(const int weight_index = 0) const {
-      return weight_[weight_index];
-    }
-    inline dataType getMinSubWeight(const int weight_index = 0) const {
-      return min_subweights_[weight_index];
-    }
-    inline bool isLeaf() const {
-      return left_ == nullptr && right_ == nullptr;
-    }
-    inline bool isRoot() const {
-      return parent_ == nullptr;
-    }
   };
 } // namespace ttk
 
 template <typename dataType, typename Container>
 typename ttk::KDTree<dataType, Container>::KDTreeMap
   ttk::KDTree<dataType, Container>::build(
-    dataType *data,
+    const dataType *const data,
     const int &ptNumber,
     const int &dimension,
     const std::vector<std::vector<dataType>> &weights,
     const int &weightNumber,
-    const int &nodeNumber) {
+    const int threadNumber) {
 
-  int createdNumberNode = 1;
-  int idGenerator = createdNumberNode - 1;
-  int maximumLevel = 0;
-
-  int correspondence_map_size = 0;
-
-  if(nodeNumber == -1) {
-    correspondence_map_size = ptNumber;
-  } else {
-    correspondence_map_size = nodeNumber;
-    maximumLevel = ceil(log2(nodeNumber + 1)) - 1;
-  }
-
-  KDTreeMap correspondence_map(correspondence_map_size);
-
-  // First, perform a argsort on the data
-  // initialize original index locations
-  dataType x_max = std::numeric_limits<dataType>::lowest();
-  dataType x_min = std::numeric_limits<dataType>::max();
-  dataType y_max = std::numeric_limits<dataType>::lowest();
-  dataType y_min = std::numeric_limits<dataType>::max();
-  dataType z_max = std::numeric_limits<dataType>::lowest();
-  dataType z_min = std::numeric_limits<dataType>::max();
-
-  for(int i = 0; i < ptNumber * dimension; i += dimension) {
-    if(x_max < data[i]) {
-      x_max = data[i];
-    }
-    if(x_min > data[i]) {
-      x_min = data[i];
-    }
-
-    if(y_max < data[i + 1]) {
-      y_max = data[i + 1];
-    }
-    if(y_min > data[i + 1]) {
-      y_min = data[i + 1];
-    }
-
-    if(dimension > 2) {
-      if(z_max < data[i + 2]) {
-        z_max = data[i + 2];
-      }
-      if(z_min > data[i + 2]) {
-        z_min = data[i + 2];
-      }
-    }
-  }
-
-  coords_min_[0] = x_min;
-  coords_max_[0] = x_max;
-  coords_min_[1] = y_min;
-  coords_max_[1] = y_max;
-  if(dimension > 2) {
-    coords_min_[2] = z_min;
-    coords_max_[2] = z_max;
-  }
-
-  std::vector<int> idx(ptNumber);
-  for(int i = 0; i < ptNumber; i++) {
-    idx[i] = i;
-  }
-  // sort indexes based on comparing values in coordinates
-  sort(idx.begin(), idx.end(), [&](int i1, int i2) {
-    return data[dimension * i1 + coords_number_]
-           < data[dimension * i2 + coords_number_];
-  });
-  int median_loc = (int)(ptNumber - 1) / 2;
-  int median_idx = idx[median_loc];
+  this->dimension_ = dimension;
+  this->nodeNumber_ = ptNumber;
+  this->ids_.resize(ptNumber);
+  this->coordinates_.resize(static_cast<size_t>(dimension) * ptNumber);
+  this->weights_.assign(weightNumber, std::vector<dataType>(ptNumber));
+  this->min_subweights_.assign(weightNumber, std::vector<dataType>(ptNumber));
 
   for(int axis = 0; axis < dimension; axis++) {
-    coordinates_[axis] = data[dimension * median_idx + axis];
-  }
-
-  if(nodeNumber == -1) {
-    correspondence_map[median_idx] = this;
-    id_ = median_idx;
-  } else {
-    correspondence_map[idGenerator] = this;
-    id_ = idGenerator;
+    coords_min_[axis] = std::numeric_limits<dataType>::max();
+    coords_max_[axis] = std::numeric_limits<dataType>::lowest();
   }
-
-  parent_ = nullptr;
-  level_ = 0;
-
-  this->weight_.clear();
-  this->min_subweights_.clear();
-
-  if(weights.empty()) {
-    this->weight_.resize(weightNumber);
-    this->min_subweights_.resize(weightNumber);
-  } else {
-    for(int i = 0; i < weightNumber; i++) {
-      weight_.push_back(weights[i][median_idx]);
-      min_subweights_.push_back(weights[i][median_idx]);
+  for(int i = 0; i < ptNumber; i++) {
+    for(int axis = 0; axis < dimension; axis++) {
+      const dataType c = data[dimension * i + axis];
+      coords_min_[axis] = std::min(coords_min_[axis], c);
+      coords_max_[axis] = std::max(coords_max_[axis], c);
     }
   }
 
-  if(((nodeNumber == -1) && (idx.size() > 2))
-     || ((nodeNumber != -1) && (createdNumberNode < nodeNumber))) {
-    // Build left leaf
-    std::vector<int> idx_left(median_loc);
-    for(int i = 0; i < median_loc; i++) {
-      idx_left[i] = idx[i];
-    }
+  std::vector<int> perm(ptNumber);
+  std::iota(perm.begin(), perm.end(), 0);
 
-    this->left_
-      = std::make_unique<KDTree>(this, (coords_number_ + 1) % dimension, true);
-    this->left_->buildRecursive(data, idx_left, ptNumber, dimension, this,
-                                correspondence_map, nodeNumber, maximumLevel,
-                                createdNumberNode, weights, weightNumber);
-  }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber)
+#pragma omp single nowait
+#endif // TTK_ENABLE_OPENMP
+  this->buildRecursive(data, weights, perm, 0, ptNumber, 0);
 
-  if(((nodeNumber == -1) && (idx.size() > 1))
-     || ((nodeNumber != -1) && (createdNumberNode < nodeNumber))) {
-    // Build right leaf
-    std::vector<int> idx_right(ptNumber - median_loc - 1);
-    for(int i = 0; i < ptNumber - median_loc - 1; i++) {
-      idx_right[i] = idx[i + median_loc + 1];
-    }
-    this->right_
-      = std::make_unique<KDTree>(this, (coords_number_ + 1) % dimension, false);
-    this->right_->buildRecursive(data, idx_right, ptNumber, dimension, this,
-                                 correspondence_map, nodeNumber, maximumLevel,
-                                 createdNumberNode, weights, weightNumber);
-  }
+  TTK_FORCE_USE(threadNumber);
 
+  KDTreeMap correspondence_map(ptNumber);
+  for(int node = 0; node < ptNumber; node++) {
+    correspondence_map[ids_[node]] = node;
+  }
   return correspondence_map;
 }
 
 template <typename dataType, typename Container>
 void ttk::KDTree<dataType, Container>::buildRecursive(
-  dataType *data,
-  std::vector<int> &idx_side,
-  const int &ptNumber,
-  const int &dimension,
-  KDTree<dataType, Container> *parent,
-  KDTreeMap &correspondence_map,
-  const int &nodeNumber,
-  const int &maximumLevel,
-  int &createdNumberNode,
+  const dataType *const data,
   const std::vector<std::vector<dataType>> &weights,
-  const int &weightNumber) {
-
-  createdNumberNode++;
-  int idGenerator = createdNumberNode - 1;
-
-  // First, perform a argsort on the data
-  sort(idx_side.begin(), idx_side.end(), [&](int i1, int i2) {
-    return data[dimension * i1 + coords_number_]
-           < data[dimension * i2 + coords_number_];
-  });
-  int median_loc = (int)(idx_side.size() - 1) / 2;
-  int median_idx = idx_side[median_loc];
+  std::vector<int> &perm,
+  const int begin,
+  const int end,
+  const int depth) {
 
-  for(int axis = 0; axis < dimension; axis++) {
-    coordinates_[axis] = data[dimension * median_idx + axis];
+  if(begin >= end) {
+    return;
   }
 
-  if(nodeNumber == -1) {
-    correspondence_map[median_idx] = this;
-    id_ = median_idx;
-  } else {
-    correspondence_map[idGenerator] = this;
-    id_ = idGenerator;
+  // split the range at its median along the axis of the current depth
+  const int axis = depth % dimension_;
+  const int node = getMedian(begin, end);
+  std::nth_element(perm.begin() + begin, perm.begin() + node,
+                   perm.begin() + end, [&](const int i1, const int i2) {
+                     return data[dimension_ * i1 + axis]
+                            < data[dimension_ * i2 + axis];
+                   });
+
+  const int id = perm[node];
+  ids_[node] = id;
+  for(int a = 0; a < dimension_; a++) {
+    coordinates_[a * nodeNumber_ + node] = data[dimension_ * id + a];
   }
-
-  parent_ = parent;
-  level_ = parent->level_ + 1;
-
-  this->weight_.clear();
-  this->min_subweights_.clear();
-
-  if(weights.empty()) {
-    this->weight_.resize(weightNumber);
-    this->min_subweights_.resize(weightNumber);
-  } else {
-    for(int i = 0; i < weightNumber; i++) {
-      weight_.push_back(weights[i][median_idx]);
-      min_subweights_.push_back(weights[i][median_idx]);
+  if(!weights.empty()) {
+    for(size_t w = 0; w < weights_.size(); w++) {
+      weights_[w][node] = weights[w][id];
     }
+  }
 
-    if(idx_side.size() > 1) {
-      // Once we get to a leaf, update min_subweights of the parents
-      for(int w = 0; w < weightNumber; w++) {
-        this->updateMinSubweight(w);
-      }
-    }
+  // only the large subtrees are worth a task
+  const int grainSize = 4096;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp task if(node - begin > grainSize) shared(weights, perm)
+#endif // TTK_ENABLE_OPENMP
+  this->buildRecursive(data, weights, perm, begin, node, depth + 1);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp task if(end - node - 1 > grainSize) shared(weights, perm)
+#endif // TTK_ENABLE_OPENMP
+  this->buildRecursive(data, weights, perm, node + 1, end, depth + 1);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp taskwait
+#endif // TTK_ENABLE_OPENMP
+  TTK_FORCE_USE(grainSize);
+
+  for(int w = 0; w < static_cast<int>(weights_.size()); w++) {
+    this->updateMinSubweight(begin, end, w);
   }
+}
 
-  // Create bounding box
-  for(int axis = 0; axis < dimension; axis++) {
-    coords_min_[axis] = parent_->coords_min_[axis];
-    coords_max_[axis] = parent_->coords_max_[axis];
+template <typename dataType, typename Container>
+void ttk::KDTree<dataType, Container>::updateMinSubweight(
+  const int begin, const int end, const int weight_index) {
+
+  const int node = getMedian(begin, end);
+  const auto &weights = weights_[weight_index];
+  auto &min_subweights = min_subweights_[weight_index];
+
+  dataType new_min_subweight = weights[node];
+  if(node > begin) {
+    new_min_subweight = std::min(
+      new_min_subweight, min_subweights[getMedian(begin, node)]);
   }
-  if(is_left_ && !this->isRoot()) {
-    coords_max_[parent_->coords_number_]
-      = parent_->coordinates_[parent_->coords_number_];
-  } else if(!is_left_ && !this->isRoot()) {
-    coords_min_[parent_->coords_number_]
-      = parent_->coordinates_[parent_->coords_number_];
+  if(end > node + 1) {
+    new_min_subweight = std::min(
+      new_min_subweight, min_subweights[getMedian(node + 1, end)]);
   }
+  min_subweights[node] = new_min_subweight;
+}
 
-  if(((nodeNumber == -1) && (idx_side.size() > 2))
-     || ((nodeNumber != -1) && (level_ < maximumLevel)
-         && (createdNumberNode < nodeNumber))) {
-    // Build left leaf
-    std::vector<int> idx_left(median_loc);
-    for(int i = 0; i < median_loc; i++) {
-      idx_left[i] = idx_side[i];
+template <typename dataType, typename Container>
+void ttk::KDTree<dataType, Container>::updateWeight(const int node,
+                                                    const dataType new_weight,
+                                                    const int weight_index) {
+  weights_[weight_index][node] = new_weight;
+
+  // ranges from the root to the node
+  std::array<std::array<int, 2>, std::numeric_limits<int>::digits + 1> path;
+  size_t pathSize{};
+  int begin = 0;
+  int end = nodeNumber_;
+  while(true) {
+    path[pathSize++] = {begin, end};
+    const int median = getMedian(begin, end);
+    if(median == node) {
+      break;
+    } else if(node < median) {
+      end = median;
+    } else {
+      begin = median + 1;
     }
-
-    this->left_
-      = std::make_unique<KDTree>(this, (coords_number_ + 1) % dimension, true);
-    this->left_->buildRecursive(data, idx_left, ptNumber, dimension, this,
-                                correspondence_map, nodeNumber, maximumLevel,
-                                createdNumberNode, weights, weightNumber);
   }
 
-  if(((nodeNumber == -1) && (idx_side.size() > 1))
-     || ((nodeNumber != -1) && (level_ < maximumLevel)
-         && (createdNumberNode < nodeNumber))) {
-    // Build right leaf
-    std::vector<int> idx_right(idx_side.size() - median_loc - 1);
-    for(unsigned int i = 0; i < idx_side.size() - median_loc - 1; i++) {
-      idx_right[i] = idx_side[i + median_loc + 1];
+  // update the subtree minima bottom-up, until one is unchanged
+  auto &min_subweights = min_subweights_[weight_index];
+  while(pathSize > 0) {
+    const auto &range = path[--pathSize];
+    const int median = getMedian(range[0], range[1]);
+    const dataType old_min_subweight = min_subweights[median];
+    this->updateMinSubweight(range[0], range[1], weight_index);
+    if(min_subweights[median] == old_min_subweight) {
+      break;
     }
-    this->right_
-      = std::make_unique<KDTree>(this, (coords_number_ + 1) % dimension, false);
-    this->right_->buildRecursive(data, idx_right, ptNumber, dimension, this,
-                                 correspondence_map, nodeNumber, maximumLevel,
-                                 createdNumberNode, weights, weightNumber);
   }
 }
 
 template <typename dataType, typename Container>
-void ttk::KDTree<dataType, Container>::updateMinSubweight(
-  const int weight_index) {
-  dataType new_min_subweight;
-  if(this->isLeaf()) {
-    new_min_subweight = weight_[weight_index];
-  } else if(!left_) {
-    new_min_subweight
-      = std::min(right_->min_subweights_[weight_index], weight_[weight_index]);
-  } else if(!right_) {
-    new_min_subweight
-      = std::min(left_->min_subweights_[weight_index], weight_[weight_index]);
-  } else {
-    new_min_subweight
-      = std::min(std::min(left_->min_subweights_[weight_index],
-                          right_->min_subweights_[weight_index]),
-                 weight_[weight_index]);
-  }
+void ttk::KDTree<dataType, Container>::getKClosest(
+  const unsigned int k,
+  const Container &coordinates,
+  std::vector<int> &neighbours,
+  std::vector<dataType> &costs,
+  const int weight_index) const {
 
-  if(new_min_subweight != min_subweights_[weight_index]) {
-    min_subweights_[weight_index] = new_min_subweight;
-    if(!this->isRoot()) {
-      parent_->updateMinSubweight(weight_index);
-    }
+  const auto p{this->p_};
+
+  neighbours.clear();
+  costs.clear();
+  if(nodeNumber_ == 0) {
+    return;
   }
+  neighbours.reserve(k);
+  costs.reserve(k);
+
+  Container box_min{coords_min_};
+  Container box_max{coords_max_};
+  TTK_POW_LAMBDA(this->recursiveGetKClosest, dataType, p, k, coordinates,
+                 box_min, box_max, 0, nodeNumber_, 0, neighbours, costs,
+                 weight_index);
 }
 
 template <typename dataType, typename Container>
-void ttk::KDTree<dataType, Container>::getKClosest(const unsigned int k,
-                                                   const Container &coordinates,
-                                                   KDTreeMap &neighbours,
-                                                   std::vector<dataType> &costs,
-                                                   const int weight_index) {
+void ttk::KDTree<dataType, Container>::getKClosest(
+  const unsigned int k,
+  const std::vector<Container> &coordinates,
+  std::vector<std::vector<int>> &neighbours,
+  std::vector<std::vector<dataType>> &costs,
+  const int weight_index,
+  const int threadNumber) const {
 
-  const auto p{this->p_};
+  neighbours.resize(coordinates.size());
+  costs.resize(coordinates.size());
 
-  /// Puts the k closest points to the given coordinates in the "neighbours"
-  /// vector along with their costs in the "costs" vector The output is not
-  /// sorted, if you are interested in the k nearest neighbours in the order,
-  /// will need to sort them according to their cost.
-  if(this->isLeaf()) {
-    dataType cost{};
-    TTK_POW_LAMBDA(cost = this->getCost, dataType, p, coordinates);
-    cost += weight_[weight_index];
-    neighbours.push_back(this);
-    costs.push_back(cost);
-  } else {
-    neighbours.reserve(k);
-    costs.reserve(k);
-    TTK_POW_LAMBDA(this->recursiveGetKClosest, dataType, p, k, coordinates,
-                   neighbours, costs, weight_index);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber) schedule(dynamic, 64)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < coordinates.size(); i++) {
+    this->getKClosest(k, coordinates[i], neighbours[i], costs[i], weight_index);
   }
-  // TODO sort neighbours and costs !
+
+  TTK_FORCE_USE(threadNumber);
 }
 
 template <typename dataType, typename Container>
@@ -448,17 +392,26 @@ template <typename PowerFunc>
 void ttk::KDTree<dataType, Container>::recursiveGetKClosest(
   const unsigned int k,
   const Container &coordinates,
-  KDTreeMap &neighbours,
+  Container &box_min,
+  Container &box_max,
+  const int begin,
+  const int end,
+  const int depth,
+  std::vector<int> &neighbours,
   std::vector<dataType> &costs,
   const int weight_index,
-  const PowerFunc &power) {
+  const PowerFunc &power) const {
+
+  const int node = getMedian(begin, end);
+  const auto &min_subweights = min_subweights_[weight_index];
+
   // 1- Look whether or not to include the current point in the nearest
   // neighbours
-  dataType cost = this->getCost(coordinates, power);
-  cost += weight_[weight_index];
+  dataType cost = this->getCost(node, coordinates, power);
+  cost += weights_[weight_index][node];
 
   if(costs.size() < k) {
-    neighbours.push_back(this);
+    neighbours.push_back(node);
     costs.push_back(cost);
   } else {
     // 1.1- Find the most costly amongst neighbours
@@ -466,36 +419,43 @@ void ttk::KDTree<dataType, Container>::recursiveGetKClosest(
       costs.begin(), std::max_element(costs.begin(), costs.begin() + k));
     const dataType max_cost = costs[idx_max_cost];
 
-    // 1.2- If the current KDTree is less costly, put it in the neighbours and
+    // 1.2- If the current node is less costly, put it in the neighbours and
     // update costs.
     if(cost < max_cost) {
       costs[idx_max_cost] = cost;
-      neighbours[idx_max_cost] = this;
+      neighbours[idx_max_cost] = node;
     }
   }
 
-  // 2- Recursively visit KDTrees that are worth it
-  if(left_) {
-    const dataType max_cost = *std::max_element(costs.begin(), costs.end());
-    const dataType min_subweight = left_->min_subweights_[weight_index];
-    const dataType d_min = this->distanceToBox(*left_, coordinates, power);
-    if(costs.size() < k || d_min + min_subweight < max_cost) {
-      // 2.2- It is possible that there exists a point in this subtree that is
-      // less costly than max_cost
-      left_->recursiveGetKClosest(
-        k, coordinates, neighbours, costs, weight_index, power);
+  // 2- Recursively visit subtrees that are worth it, the one on the side of
+  // the query first. Their bounding box is the current one cut at the
+  // current node
+  const int axis = depth % dimension_;
+  const dataType split = coordinates_[axis * nodeNumber_ + node];
+  const bool left_first = coordinates[axis] < split;
+
+  for(int side = 0; side < 2; side++) {
+    const bool is_left = (side == 0) == left_first;
+    const int sub_begin = is_left ? begin : node + 1;
+    const int sub_end = is_left ? node : end;
+    if(sub_begin >= sub_end) {
+      continue;
     }
-  }
-
-  if(right_) {
     const dataType max_cost = *std::max_element(costs.begin(), costs.end());
-    const dataType min_subweight = right_->min_subweights_[weight_index];
-    const dataType d_min = this->distanceToBox(*right_, coordinates, power);
+    const dataType min_subweight
+      = min_subweights[getMedian(sub_begin, sub_end)];
+    dataType &bound = is_left ? box_max[axis] : box_min[axis];
+    const dataType old_bound = bound;
+    bound = split;
+    const dataType d_min
+      = this->distanceToBox(box_min, box_max, coordinates, power);
     if(costs.size() < k || d_min + min_subweight < max_cost) {
       // 2.2- It is possible that there exists a point in this subtree that is
       // less costly than max_cost
-      right_->recursiveGetKClosest(
-        k, coordinates, neighbours, costs, weight_index, power);
+      this->recursiveGetKClosest(k, coordinates, box_min, box_max, sub_begin,
+                                 sub_end, depth + 1, neighbours, costs,
+                                 weight_index, power);
     }
+    bound = old_bound;
   }
-}
\ No newline at end of file
+}
@@ -61,6 +61,27 @@ namespace ttk {
       return (var1 > var2) ? var1 - var2 : var2 - var1;
     }
 
+    /**
+     * @brief Sum of the powers of the absolute differences between two
+     * fields on the vertex range [begin, end) (vectorized)
+     */
+    template <typename sumType, class dataType, typename PowerFunc>
+    static sumType sumPowers(const dataType *const input1,
+                             const dataType *const input2,
+                             const size_t begin,
+                             const size_t end,
+                             const PowerFunc &powerFunc);
+
+    /**
+     * @brief Maximum absolute difference between two fields on the
+     * vertex range [begin, end) (vectorized)
+     */
+    template <typename sumType, class dataType>
+    static sumType maxAbsDiff(const dataType *const input1,
+                              const dataType *const input2,
+                              const size_t begin,
+                              const size_t end);
+
   protected:
     double result{};
     bool printRes{true};
@@ -104,6 +125,38 @@ int ttk::LDistance::execute(const dataType *const inputData1,
   return status;
 }
 
+template <typename sumType, class dataType, typename PowerFunc>
+sumType ttk::LDistance::sumPowers(const dataType *const input1,
+                                  const dataType *const input2,
+                                  const size_t begin,
+                                  const size_t end,
+                                  const PowerFunc &powerFunc) {
+  sumType sum{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd reduction(+ : sum)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = begin; i < end; ++i) {
+    sum += powerFunc(static_cast<sumType>(abs_diff(input1[i], input2[i])));
+  }
+  return sum;
+}
+
+template <typename sumType, class dataType>
+sumType ttk::LDistance::maxAbsDiff(const dataType *const input1,
+                                   const dataType *const input2,
+                                   const size_t begin,
+                                   const size_t end) {
+  sumType maxValue{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd reduction(max : maxValue)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = begin; i < end; ++i) {
+    const auto diff = static_cast<sumType>(abs_diff(input1[i], input2[i]));
+    maxValue = diff > maxValue ? diff : maxValue;
+  }
+  return maxValue;
+}
+
 template <class dataType, typename PowerFunc>
 int ttk::LDistance::computeLn(const dataType *const input1,
                               const dataType *const input2,
@@ -113,21 +166,26 @@ int ttk::LDistance::computeLn(const dataType *const input1,
                               const PowerFunc &powerFunc) {
   dataType sum = 0;
 
-// Compute difference for each point.
+  // Careful: huge dataset + huge values
+  // may exceed double capacity.
+  if(output == nullptr) {
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_) reduction(+ : sum)
+#pragma omp parallel for simd num_threads(threadNumber_) reduction(+ : sum)
 #endif
-  for(ttk::SimplexId i = 0; i < vertexNumber; ++i) {
-    const dataType diff = abs_diff<dataType>(input1[i], input2[i]);
-    const dataType power = powerFunc(diff);
-
-    // Careful: huge dataset + huge values
-    // may exceed double capacity.
-    sum += power;
-
-    // Store difference.
-    if(output)
+    for(ttk::SimplexId i = 0; i < vertexNumber; ++i) {
+      sum += powerFunc(abs_diff<dataType>(input1[i], input2[i]));
+    }
+  } else {
+// Compute and store difference for each point.
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for simd num_threads(threadNumber_) reduction(+ : sum)
+#endif
+    for(ttk::SimplexId i = 0; i < vertexNumber; ++i) {
+      const dataType power
+        = powerFunc(abs_diff<dataType>(input1[i], input2[i]));
+      sum += power;
       output[i] = power;
+    }
   }
 
   sum = Geometry::pow(sum, 1.0 / (double)n);
@@ -150,20 +208,28 @@ int ttk::LDistance::computeLinf(const dataType *const input1,
   if(vertexNumber < 1)
     return 0;
 
-  dataType maxValue = abs_diff<dataType>(input1[0], input2[0]);
+  dataType maxValue{};
 
-// Compute difference for each point.
+  if(output == nullptr) {
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_) reduction(max : maxValue)
+#pragma omp parallel for simd num_threads(threadNumber_) \
+  reduction(max : maxValue)
 #endif
-  for(ttk::SimplexId i = 1; i < vertexNumber; ++i) {
-    const dataType iter = abs_diff<dataType>(input1[i], input2[i]);
-    if(iter > maxValue)
-      maxValue = iter;
-
-    // Store absolute difference in output.
-    if(output)
+    for(ttk::SimplexId i = 0; i < vertexNumber; ++i) {
+      const dataType iter = abs_diff<dataType>(input1[i], input2[i]);
+      maxValue = iter > maxValue ? iter : maxValue;
+    }
+  } else {
+// Compute and store absolute difference for each point.
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for simd num_threads(threadNumber_) \
+  reduction(max : maxValue)
+#endif
+    for(ttk::SimplexId i = 0; i < vertexNumber; ++i) {
+      const dataType iter = abs_diff<dataType>(input1[i], input2[i]);
+      maxValue = iter > maxValue ? iter : maxValue;
       output[i] = iter;
+    }
   }
 
   // Affect result.
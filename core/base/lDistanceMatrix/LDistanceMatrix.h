@@ -13,6 +13,8 @@
 #include <LDistance.h>
 #include <Wrapper.h>
 
+#include <algorithm>
+#include <array>
 #include <string>
 #include <vector>
 
@@ -40,6 +42,46 @@ namespace ttk {
                 const size_t nPoints) const;
 
   protected:
+    /**
+     * @brief Fill the distance matrix tile by tile
+     *
+     * The members are grouped into tiles of tileSize_ members. For
+     * every pair of tiles, the member fields are streamed by blocks of
+     * blockBytes_ bytes: the blocks of both tiles stay in cache while
+     * the partial distances between all their members are accumulated
+     * with the vectorized @p kernel. The vertex range is also split
+     * when there are too few tile pairs to keep the threads busy.
+     *
+     * @param[out] output distance matrix
+     * @param[in] inputs member fields
+     * @param[in] nPoints number of values per member field
+     * @param[in] kernel partial distance between two fields on a vertex
+     * range
+     * @param[in] combine reduction of two partial distances
+     * @param[in] finalize distance from the reduced partial distances
+     */
+    template <typename TIn,
+              typename TOut,
+              typename Kernel,
+              typename Combine,
+              typename Finalize>
+    int computeTiles(std::vector<TOut *> &output,
+                     const std::vector<const TIn *> &inputs,
+                     const size_t nPoints,
+                     const Kernel &kernel,
+                     const Combine &combine,
+                     const Finalize &finalize) const;
+
+    template <typename TIn, typename TOut, typename PowerFunc>
+    int computeLn(std::vector<TOut *> &output,
+                  const std::vector<const TIn *> &inputs,
+                  const size_t nPoints,
+                  const int n,
+                  const PowerFunc &powerFunc) const;
+
+    static constexpr size_t tileSize_{16};
+    static constexpr size_t blockBytes_{4096};
+
     std::string DistanceType{"2"};
   };
 } // namespace ttk
@@ -62,22 +104,132 @@ int ttk::LDistanceMatrix::execute(std::vector<TOut *> &output,
                      "LDistanceMatrix module, the output must be "
                      "fully initialized: each line pointer must not be NULL.");
 
-  LDistance worker{};
-  worker.setThreadNumber(1);
-  worker.setPrintRes(false);
+  if(this->DistanceType == "inf") {
+    return this->computeTiles(
+      output, inputs, nPoints,
+      [](const TIn *const a, const TIn *const b, const size_t begin,
+         const size_t end) {
+        return LDistance::maxAbsDiff<double>(a, b, begin, end);
+      },
+      [](const double a, const double b) { return std::max(a, b); },
+      [](const double a) { return a; });
+  }
+
+  const int n = std::stoi(this->DistanceType);
+  if(n < 1) {
+    this->printErr("Invalid distance type " + this->DistanceType);
+    return -4;
+  }
+
+  int status{};
+  TTK_POW_LAMBDA(
+    status = this->computeLn, double, n, output, inputs, nPoints, n);
+  return status;
+}
+
+template <typename TIn, typename TOut, typename PowerFunc>
+int ttk::LDistanceMatrix::computeLn(std::vector<TOut *> &output,
+                                    const std::vector<const TIn *> &inputs,
+                                    const size_t nPoints,
+                                    const int n,
+                                    const PowerFunc &powerFunc) const {
+  return this->computeTiles(
+    output, inputs, nPoints,
+    [&powerFunc](const TIn *const a, const TIn *const b, const size_t begin,
+                 const size_t end) {
+      return LDistance::sumPowers<double>(a, b, begin, end, powerFunc);
+    },
+    [](const double a, const double b) { return a + b; },
+    [n](const double a) { return Geometry::pow(a, 1.0 / n); });
+}
+
+template <typename TIn,
+          typename TOut,
+          typename Kernel,
+          typename Combine,
+          typename Finalize>
+int ttk::LDistanceMatrix::computeTiles(std::vector<TOut *> &output,
+                                       const std::vector<const TIn *> &inputs,
+                                       const size_t nPoints,
+                                       const Kernel &kernel,
+                                       const Combine &combine,
+                                       const Finalize &finalize) const {
+
+  const size_t nInputs = inputs.size();
+  if(nInputs == 0) {
+    return 0;
+  }
+
+  const size_t nTiles = (nInputs + tileSize_ - 1) / tileSize_;
+  const size_t blockSize = std::max<size_t>(blockBytes_ / sizeof(TIn), 1);
+  const size_t nBlocks = (nPoints + blockSize - 1) / blockSize;
+
+  // pairs of tiles in the matrix upper triangle
+  std::vector<std::array<size_t, 2>> tilePairs{};
+  for(size_t i = 0; i < nTiles; ++i) {
+    for(size_t j = i; j < nTiles; ++j) {
+      tilePairs.push_back({i, j});
+    }
+  }
+
+  // vertex chunks per tile pair, at least 4 tasks per thread
+  const size_t nTasksMin = 4 * static_cast<size_t>(this->threadNumber_);
+  const size_t nChunks = std::max<size_t>(
+    std::min((nTasksMin + tilePairs.size() - 1) / tilePairs.size(), nBlocks),
+    1);
+
+  // partial distances of every (tile pair, vertex chunk) task
+  const size_t nTasks = tilePairs.size() * nChunks;
+  std::vector<double> partial(nTasks * tileSize_ * tileSize_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t t = 0; t < nTasks; ++t) {
+    const auto &tp{tilePairs[t / nChunks]};
+    const auto chunk{t % nChunks};
+    const auto iBegin{tp[0] * tileSize_};
+    const auto iEnd{std::min(iBegin + tileSize_, nInputs)};
+    const auto jBegin{tp[1] * tileSize_};
+    const auto jEnd{std::min(jBegin + tileSize_, nInputs)};
+    auto *acc{&partial[t * tileSize_ * tileSize_]};
+
+    for(size_t b = chunk * nBlocks / nChunks;
+        b < (chunk + 1) * nBlocks / nChunks; ++b) {
+      const auto begin{b * blockSize};
+      const auto end{std::min(begin + blockSize, nPoints)};
+      for(size_t i = iBegin; i < iEnd; ++i) {
+        for(size_t j = std::max(jBegin, i + 1); j < jEnd; ++j) {
+          auto &a{acc[(i - iBegin) * tileSize_ + j - jBegin]};
+          a = combine(a, kernel(inputs[i], inputs[j], begin, end));
+        }
+      }
+    }
+  }
 
-  // compute matrix upper triangle
+  // reduce the vertex chunks and fill both matrix triangles
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(this->threadNumber_) firstprivate(worker)
+#pragma omp parallel for num_threads(this->threadNumber_)
 #endif // TTK_ENABLE_OPENMP
-  for(size_t i = 0; i < nInputs; ++i) {
-    output[i][i] = 0;
-    for(size_t j = i + 1; j < nInputs; ++j) {
-      // call execute with nullptr output
-      worker.execute(inputs[i], inputs[j], {}, this->DistanceType, nPoints);
-      // store result
-      output[i][j] = worker.getResult();
-      output[j][i] = worker.getResult();
+  for(size_t p = 0; p < tilePairs.size(); ++p) {
+    const auto iBegin{tilePairs[p][0] * tileSize_};
+    const auto iEnd{std::min(iBegin + tileSize_, nInputs)};
+    const auto jBegin{tilePairs[p][1] * tileSize_};
+    const auto jEnd{std::min(jBegin + tileSize_, nInputs)};
+    for(size_t i = iBegin; i < iEnd; ++i) {
+      if(tilePairs[p][0] == tilePairs[p][1]) {
+        output[i][i] = 0;
+      }
+      for(size_t j = std::max(jBegin, i + 1); j < jEnd; ++j) {
+        const auto k{(i - iBegin) * tileSize_ + j - jBegin};
+        auto a{partial[p * nChunks * tileSize_ * tileSize_ + k]};
+        for(size_t c = 1; c < nChunks; ++c) {
+          a = combine(
+            a, partial[(p * nChunks + c) * tileSize_ * tileSize_ + k]);
+        }
+        output[i][j] = finalize(a);
+        output[j][i] = finalize(a);
+      }
     }
   }
 
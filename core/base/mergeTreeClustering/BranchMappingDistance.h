@@ -197,6 +197,13 @@ namespace ttk {
     dataType editDistance_branch(ftm::FTMTree_MT *tree1,
                                  ftm::FTMTree_MT *tree2) {
 
+      // cost matrix and assignment solvers reused for all the
+      // assignment problems
+      CostMatrix<dataType> costMatrix;
+      AssignmentExhaustive<dataType> solverExhaustive;
+      AssignmentMunkres<dataType> solverMunkres;
+      AssignmentAuction<dataType> solverAuction;
+
       // initialize memoization tables
 
       std::vector<std::vector<int>> predecessors1(tree1->getNumberOfNodes());
@@ -468,8 +475,7 @@ namespace ttk {
                         return memT[c1 + 1 * dim2 + c2 * dim3 + 1 * dim4];
                       };
                       int size = std::max(topo1_.size(), topo2_.size()) + 1;
-                      auto costMatrix = std::vector<std::vector<dataType>>(
-                        size, std::vector<dataType>(size, 0));
+                      costMatrix.resize(size, size);
                       std::vector<MatchingType> matching;
                       for(int r = 0; r < size; r++) {
                         for(int c = 0; c < size; c++) {
@@ -478,21 +484,15 @@ namespace ttk {
                       }
 
                       AssignmentSolver<dataType> *assignmentSolver;
-                      AssignmentExhaustive<dataType> solverExhaustive;
-                      AssignmentMunkres<dataType> solverMunkres;
-                      AssignmentAuction<dataType> solverAuction;
                       switch(assignmentSolverID_) {
                         case 1:
-                          solverExhaustive = AssignmentExhaustive<dataType>();
                           assignmentSolver = &solverExhaustive;
                           break;
                         case 2:
-                          solverMunkres = AssignmentMunkres<dataType>();
                           assignmentSolver = &solverMunkres;
                           break;
                         case 0:
                         default:
-                          solverAuction = AssignmentAuction<dataType>();
                           assignmentSolver = &solverAuction;
                       }
                       assignmentSolver->setInput(costMatrix);
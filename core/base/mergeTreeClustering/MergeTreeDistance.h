@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <stack>
 #include <thread>
 
@@ -59,6 +61,47 @@ namespace ttk {
     std::vector<std::vector<ftm::idNode>> tree2LevelToNode_;
     std::vector<int> tree1Level_, tree2Level_;
 
+    // Working memory of an assignment problem: the cost matrix and the
+    // solvers keep their buffers from one problem to the next
+    struct AssignmentWorkspaceBase {
+      virtual ~AssignmentWorkspaceBase() = default;
+    };
+    template <class dataType>
+    struct AssignmentWorkspace : AssignmentWorkspaceBase {
+      CostMatrix<dataType> costMatrix{};
+      AssignmentExhaustive<dataType> solverExhaustive{};
+      AssignmentMunkres<dataType> solverMunkres{};
+      AssignmentAuction<dataType> solverAuction{};
+    };
+    // idle workspaces of this instance; a task borrows one for the
+    // duration of an assignment problem (see acquireAssignmentWorkspace),
+    // so there are at most as many workspaces as concurrent problems
+    std::vector<std::unique_ptr<AssignmentWorkspaceBase>> workspaces_;
+    std::mutex workspacesMutex_;
+
+    template <class dataType>
+    std::unique_ptr<AssignmentWorkspace<dataType>>
+      acquireAssignmentWorkspace() {
+      {
+        std::lock_guard<std::mutex> lock(workspacesMutex_);
+        for(auto it = workspaces_.rbegin(); it != workspaces_.rend(); ++it) {
+          if(dynamic_cast<AssignmentWorkspace<dataType> *>(it->get())) {
+            std::unique_ptr<AssignmentWorkspace<dataType>> workspace(
+              static_cast<AssignmentWorkspace<dataType> *>(it->release()));
+            workspaces_.erase(std::next(it).base());
+            return workspace;
+          }
+        }
+      }
+      return std::make_unique<AssignmentWorkspace<dataType>>();
+    }
+
+    void releaseAssignmentWorkspace(
+      std::unique_ptr<AssignmentWorkspaceBase> workspace) {
+      std::lock_guard<std::mutex> lock(workspacesMutex_);
+      workspaces_.emplace_back(std::move(workspace));
+    }
+
   public:
     MergeTreeDistance() {
       this->setDebugMsgPrefix(
@@ -118,16 +161,24 @@ namespace ttk {
     // Assignment Problem
     // ------------------------------------------------------------------------
     template <class dataType>
-    void
-      runAssignmentProblemSolver(std::vector<std::vector<dataType>> &costMatrix,
-                                 std::vector<MatchingType> &matchings) {
+    void runAssignmentProblemSolver(CostMatrix<dataType> &costMatrix,
+                                    std::vector<MatchingType> &matchings) {
+      auto workspace = acquireAssignmentWorkspace<dataType>();
+      runAssignmentProblemSolver(costMatrix, matchings, *workspace);
+      releaseAssignmentWorkspace(std::move(workspace));
+    }
+
+    template <class dataType>
+    void runAssignmentProblemSolver(CostMatrix<dataType> &costMatrix,
+                                    std::vector<MatchingType> &matchings,
+                                    AssignmentWorkspace<dataType> &workspace) {
+      auto &solverExhaustive = workspace.solverExhaustive;
+      auto &solverMunkres = workspace.solverMunkres;
+      auto &solverAuction = workspace.solverAuction;
       AssignmentSolver<dataType> *assignmentSolver;
-      AssignmentExhaustive<dataType> solverExhaustive;
-      AssignmentMunkres<dataType> solverMunkres;
-      AssignmentAuction<dataType> solverAuction;
 
-      int const nRows = costMatrix.size() - 1;
-      int const nCols = costMatrix[0].size() - 1;
+      int const nRows = costMatrix.rows() - 1;
+      int const nCols = costMatrix.cols() - 1;
       int const max_dim = std::max(nRows, nCols);
       int const min_dim = std::min(nRows, nCols);
 
@@ -137,16 +188,13 @@ namespace ttk {
 
       switch(assignmentSolverID) {
         case 1:
-          solverExhaustive = AssignmentExhaustive<dataType>();
           assignmentSolver = &solverExhaustive;
           break;
         case 2:
-          solverMunkres = AssignmentMunkres<dataType>();
           assignmentSolver = &solverMunkres;
           break;
         case 0:
         default:
-          solverAuction = AssignmentAuction<dataType>();
           solverAuction.setEpsilon(auctionEpsilon_);
           solverAuction.setEpsilonDiviserMultiplier(auctionEpsilonDiviser_);
           solverAuction.setNumberOfRounds(auctionRound_);
@@ -161,7 +209,7 @@ namespace ttk {
     void createCostMatrix(std::vector<std::vector<dataType>> &treeTable,
                           std::vector<ftm::idNode> &children1,
                           std::vector<ftm::idNode> &children2,
-                          std::vector<std::vector<dataType>> &costMatrix) {
+                          CostMatrix<dataType> &costMatrix) {
       unsigned int nRows = children1.size(), nCols = children2.size();
       for(unsigned int i = 0; i < nRows; ++i) {
         int const forestTableI = children1[i] + 1;
@@ -213,15 +261,17 @@ namespace ttk {
       std::vector<std::tuple<int, int>> &forestAssignment) {
       // --- Create cost matrix
       int nRows = children1.size(), nCols = children2.size();
-      std::vector<std::vector<dataType>> costMatrix(
-        nRows + 1, std::vector<dataType>(nCols + 1));
+      auto workspace = acquireAssignmentWorkspace<dataType>();
+      auto &costMatrix = workspace->costMatrix;
+      costMatrix.resize(nRows + 1, nCols + 1);
       createCostMatrix(treeTable, children1, children2, costMatrix);
 
       // assignmentProblemSize[costMatrix.size()*costMatrix[0].size()]++;
 
       // --- Solve assignment problem
       std::vector<MatchingType> matchings;
-      runAssignmentProblemSolver(costMatrix, matchings);
+      runAssignmentProblemSolver(costMatrix, matchings, *workspace);
+      releaseAssignmentWorkspace(std::move(workspace));
 
       // --- Postprocess matching to create output assignment
       dataType cost = postprocessAssignment<dataType>(
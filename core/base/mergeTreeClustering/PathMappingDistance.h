@@ -213,8 +213,7 @@ namespace ttk {
           int size = std::max(tree1->getNumberOfChildren(curr1),
                               tree2->getNumberOfChildren(curr2))
                      + 1;
-          auto costMatrix = std::vector<std::vector<dataType>>(
-            size, std::vector<dataType>(size, 0));
+          CostMatrix<dataType> costMatrix(size, size);
           std::vector<MatchingType> matching;
           for(int r = 0; r < size; r++) {
             for(int c = 0; c < size; c++) {
@@ -334,6 +333,13 @@ namespace ttk {
     template <class dataType>
     dataType editDistance_path(ftm::FTMTree_MT *tree1, ftm::FTMTree_MT *tree2) {
 
+      // cost matrix and assignment solvers reused for all the
+      // assignment problems
+      CostMatrix<dataType> costMatrix;
+      AssignmentExhaustive<dataType> solverExhaustive;
+      AssignmentMunkres<dataType> solverMunkres;
+      AssignmentAuction<dataType> solverAuction;
+
       // initialize memoization tables
 
       std::vector<std::vector<int>> predecessors1(tree1->getNumberOfNodes());
@@ -540,8 +546,7 @@ namespace ttk {
                   int size = std::max(tree1->getNumberOfChildren(curr1),
                                       tree2->getNumberOfChildren(curr2))
                              + 1;
-                  auto costMatrix = std::vector<std::vector<dataType>>(
-                    size, std::vector<dataType>(size, 0));
+                  costMatrix.resize(size, size);
                   std::vector<MatchingType> matching;
                   for(int r = 0; r < size; r++) {
                     for(int c = 0; c < size; c++) {
@@ -550,21 +555,15 @@ namespace ttk {
                   }
 
                   AssignmentSolver<dataType> *assignmentSolver;
-                  AssignmentExhaustive<dataType> solverExhaustive;
-                  AssignmentMunkres<dataType> solverMunkres;
-                  AssignmentAuction<dataType> solverAuction;
                   switch(assignmentSolverID_) {
                     case 1:
-                      solverExhaustive = AssignmentExhaustive<dataType>();
                       assignmentSolver = &solverExhaustive;
                       break;
                     case 2:
-                      solverMunkres = AssignmentMunkres<dataType>();
                       assignmentSolver = &solverMunkres;
                       break;
                     case 0:
                     default:
-                      solverAuction = AssignmentAuction<dataType>();
                       assignmentSolver = &solverAuction;
                   }
                   assignmentSolver->setInput(costMatrix);
@@ -184,6 +184,26 @@ namespace ttk {
                                 const scalarType *const scalars,
                                 const triangulationType *triangulation);
 
+#ifdef TTK_ENABLE_MPI
+    /**
+     * @brief Distributed version of @ref augmentPersistenceDiagram
+     *
+     * The diagram of rank 0 holds global vertex identifiers: the
+     * scalar field values, 3D coordinates and global order of its
+     * vertices are fetched from their owner ranks. The diagram is then
+     * sorted.
+     *
+     * @return 0 when success, -1 on rank 0 if a diagram vertex has no
+     * owner rank
+     */
+    template <typename scalarType, typename triangulationType>
+    int augmentDistributedPersistenceDiagram(
+      std::vector<PersistencePair> &persistencePairs,
+      const scalarType *const scalars,
+      const SimplexId *const offsets,
+      const triangulationType *triangulation);
+#endif // TTK_ENABLE_MPI
+
     ttk::CriticalType getNodeType(ftm::FTMTree_MT *tree,
                                   ftm::TreeType treeType,
                                   const SimplexId vertexId) const;
@@ -371,6 +391,86 @@ void ttk::PersistenceDiagram::augmentPersistenceDiagram(
   }
 }
 
+#ifdef TTK_ENABLE_MPI
+
+template <typename scalarType, typename triangulationType>
+int ttk::PersistenceDiagram::augmentDistributedPersistenceDiagram(
+  std::vector<PersistencePair> &persistencePairs,
+  const scalarType *const scalars,
+  const SimplexId *const offsets,
+  const triangulationType *triangulation) {
+
+  // 1. rank 0 broadcasts the global ids of the diagram vertices
+  std::vector<SimplexId> gids{};
+  for(const auto &pair : persistencePairs) {
+    gids.emplace_back(pair.birth.id);
+    gids.emplace_back(pair.death.id);
+  }
+  std::sort(gids.begin(), gids.end());
+  gids.erase(std::unique(gids.begin(), gids.end()), gids.end());
+  int nGids = gids.size();
+  MPI_Bcast(&nGids, 1, ttk::getMPIType(nGids), 0, ttk::MPIcomm_);
+  gids.resize(nGids);
+  MPI_Bcast(
+    gids.data(), nGids, ttk::getMPIType(SimplexId{}), 0, ttk::MPIcomm_);
+
+  // 2. their owners send back their global order, scalar field value
+  // and coordinates
+  std::vector<SimplexId> ids{}, gatheredIds{};
+  std::vector<double> values{}, gatheredValues{};
+  for(const auto gid : gids) {
+    const auto lid{triangulation->getVertexLocalId(gid)};
+    if(lid == -1 || triangulation->getVertexRank(lid) != ttk::MPIrank_) {
+      continue;
+    }
+    std::array<float, 3> p{};
+    triangulation->getVertexPoint(lid, p[0], p[1], p[2]);
+    ids.insert(ids.end(), {gid, offsets[lid]});
+    values.insert(values.end(), {static_cast<double>(scalars[lid]), p[0],
+                                 p[1], p[2]});
+  }
+  ttk::gatherVector(ids, gatheredIds);
+  ttk::gatherVector(values, gatheredValues);
+
+  if(ttk::MPIrank_ != 0) {
+    return 0;
+  }
+
+  // 3. complete and sort the diagram on rank 0
+  std::unordered_map<SimplexId, size_t> gidToPos{};
+  for(size_t i = 0; i < gatheredIds.size() / 2; ++i) {
+    gidToPos[gatheredIds[2 * i]] = i;
+  }
+  for(const auto gid : gids) {
+    if(gidToPos.find(gid) == gidToPos.end()) {
+      this->printErr("Vertex " + std::to_string(gid)
+                     + " of the diagram is not owned by any rank");
+      return -1;
+    }
+  }
+  const auto fill = [&](CriticalVertex &cv) {
+    const auto pos{gidToPos.at(cv.id)};
+    cv.sfValue = gatheredValues[4 * pos];
+    for(size_t i = 0; i < cv.coords.size(); ++i) {
+      cv.coords[i] = gatheredValues[4 * pos + 1 + i];
+    }
+  };
+  for(auto &pair : persistencePairs) {
+    fill(pair.birth);
+    fill(pair.death);
+  }
+
+  std::sort(persistencePairs.begin(), persistencePairs.end(),
+            [&](const PersistencePair &a, const PersistencePair &b) {
+              return gatheredIds[2 * gidToPos.at(a.birth.id) + 1]
+                     < gatheredIds[2 * gidToPos.at(b.birth.id) + 1];
+            });
+
+  return 0;
+}
+
+#endif // TTK_ENABLE_MPI
+
 template <typename scalarType, class triangulationType>
 int ttk::PersistenceDiagram::execute(std::vector<PersistencePair> &CTDiagram,
                                      const scalarType *inputScalars,
@@ -389,10 +489,14 @@ int ttk::PersistenceDiagram::execute(std::vector<PersistencePair> &CTDiagram,
     case BACKEND::PERSISTENT_SIMPLEX:
       executePersistentSimplex(CTDiagram, inputOffsets, triangulation);
       break;
-    case BACKEND::DISCRETE_MORSE_SANDWICH:
-      executeDiscreteMorseSandwich(
+    case BACKEND::DISCRETE_MORSE_SANDWICH: {
+      const int status = executeDiscreteMorseSandwich(
         CTDiagram, inputScalars, scalarsMTime, inputOffsets, triangulation);
+      if(status != 0) {
+        return status;
+      }
       break;
+    }
     case BACKEND::PROGRESSIVE_TOPOLOGY:
       executeProgressiveTopology(CTDiagram, inputOffsets, triangulation);
       break;
@@ -408,11 +512,23 @@ int ttk::PersistenceDiagram::execute(std::vector<PersistencePair> &CTDiagram,
 
   this->printMsg("Complete", 1.0, tm.getElapsedTime(), this->threadNumber_);
 
-  // augment persistence pairs with meta-data
-  augmentPersistenceDiagram(CTDiagram, inputScalars, triangulation);
-
-  // finally sort the diagram
-  sortPersistenceDiagram(CTDiagram, inputOffsets);
+#ifdef TTK_ENABLE_MPI
+  if(ttk::isRunningWithMPI() && BackEnd == BACKEND::DISCRETE_MORSE_SANDWICH) {
+    // the diagram is on rank 0, with global vertex identifiers
+    if(augmentDistributedPersistenceDiagram(
+         CTDiagram, inputScalars, inputOffsets, triangulation)
+       != 0) {
+      return -1;
+    }
+  } else
+#endif // TTK_ENABLE_MPI
+  {
+    // augment persistence pairs with meta-data
+    augmentPersistenceDiagram(CTDiagram, inputScalars, triangulation);
+
+    // finally sort the diagram
+    sortPersistenceDiagram(CTDiagram, inputOffsets);
+  }
 
   printMsg(ttk::debug::Separator::L1);
 
@@ -504,32 +620,67 @@ int ttk::PersistenceDiagram::executeDiscreteMorseSandwich(
 
   dms_.buildGradient(inputScalars, scalarsMTime, inputOffsets, *triangulation);
   std::vector<DiscreteMorseSandwich::PersistencePair> dms_pairs{};
-  dms_.computePersistencePairs(
+  const int status = dms_.computePersistencePairs(
     dms_pairs, inputOffsets, *triangulation, this->IgnoreBoundary);
+  if(status != 0) {
+    return status;
+  }
   CTDiagram.resize(dms_pairs.size());
 
-  // transform DiscreteMorseSandwich pairs (critical cells id) to PL
-  // pairs (vertices id)
+  // find the global maximum
+  const auto nVerts = triangulation->getNumberOfVertices();
+  SimplexId globmax = std::distance(
+    inputOffsets, std::max_element(inputOffsets, inputOffsets + nVerts));
+
+#ifdef TTK_ENABLE_MPI
+  if(ttk::isRunningWithMPI()) {
+    // pairs on rank 0 with global ids, the greater vertices of their
+    // cells have been gathered by DiscreteMorseSandwich
+    const auto &pairsVerts{dms_.getDistributedPairsVertices()};
+    for(size_t i = 0; i < dms_pairs.size(); ++i) {
+      dms_pairs[i].birth = pairsVerts[i][0];
+      dms_pairs[i].death = pairsVerts[i][1];
+    }
+
+    // global order & global id of the owned vertex of highest order
+    std::vector<SimplexId> localMax{-1, -1}, maxs{};
+    for(SimplexId i = 0; i < nVerts; ++i) {
+      if(triangulation->getVertexRank(i) == ttk::MPIrank_
+         && inputOffsets[i] > localMax[0]) {
+        localMax = {inputOffsets[i], triangulation->getVertexGlobalId(i)};
+      }
+    }
+    ttk::gatherVector(localMax, maxs);
+    for(size_t i = 2; i < maxs.size(); i += 2) {
+      if(maxs[i] > maxs[0]) {
+        maxs[0] = maxs[i];
+        maxs[1] = maxs[i + 1];
+      }
+    }
+    if(!maxs.empty()) {
+      globmax = maxs[1];
+    }
+  } else
+#endif // TTK_ENABLE_MPI
+  {
+    // transform DiscreteMorseSandwich pairs (critical cells id) to PL
+    // pairs (vertices id)
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif // TTK_ENABLE_OPENMP
-  for(size_t i = 0; i < dms_pairs.size(); ++i) {
-    auto &pair{dms_pairs[i]};
-    if(pair.type > 0) {
-      pair.birth = dms_.getCellGreaterVertex(
-        Cell{pair.type, pair.birth}, *triangulation);
-    }
-    if(pair.death != -1) {
-      pair.death = dms_.getCellGreaterVertex(
-        Cell{pair.type + 1, pair.death}, *triangulation);
+    for(size_t i = 0; i < dms_pairs.size(); ++i) {
+      auto &pair{dms_pairs[i]};
+      if(pair.type > 0) {
+        pair.birth = dms_.getCellGreaterVertex(
+          Cell{pair.type, pair.birth}, *triangulation);
+      }
+      if(pair.death != -1) {
+        pair.death = dms_.getCellGreaterVertex(
+          Cell{pair.type + 1, pair.death}, *triangulation);
+      }
     }
   }
 
-  // find the global maximum
-  const auto nVerts = triangulation->getNumberOfVertices();
-  const SimplexId globmax = std::distance(
-    inputOffsets, std::max_element(inputOffsets, inputOffsets + nVerts));
-
   // convert pairs to the relevant format
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
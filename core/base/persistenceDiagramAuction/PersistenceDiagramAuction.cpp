@@ -9,41 +9,124 @@ void ttk::PersistenceDiagramAuction::runAuctionRound(int &n_biddings,
     epsilon = 1e-6 * max_price;
   }
   while(unassignedBidders_.size() > 0) {
+    if(this->parallelBidding_ && this->threadNumber_ > 1
+       && unassignedBidders_.size()
+            >= static_cast<size_t>(4 * this->threadNumber_)) {
+      this->runBiddingBatch(n_biddings, epsilon, kdt_index);
+      continue;
+    }
     n_biddings++;
     int const pos = unassignedBidders_.front();
-    Bidder &b = this->bidders_[pos];
     unassignedBidders_.pop();
+    this->unassignBidder(this->runBidderBidding(pos, epsilon, kdt_index));
+  }
+}
+
+int ttk::PersistenceDiagramAuction::runBidderBidding(const int pos,
+                                                     const double epsilon,
+                                                     const int kdt_index) {
+  Bidder &b = this->bidders_[pos];
+  GoodDiagram &all_goods = b.isDiagonal() ? diagonal_goods_ : goods_;
+  Good &twin_good = b.id_ >= 0 ? diagonal_goods_[b.id_] : goods_[-b.id_ - 1];
+  // double eps = epsilon_*(1+0.05*n_biddings/bidders_.size());
+  int idx_reassigned;
+  if(b.isDiagonal()) {
+    if(use_kdt_) {
+      idx_reassigned = b.runDiagonalKDTBidding(
+        &all_goods, twin_good, wasserstein_, epsilon, geometricalFactor_, &kdt_,
+        correspondence_kdt_map_, diagonal_queue_, kdt_index);
+    } else {
+      idx_reassigned
+        = b.runDiagonalBidding(&all_goods, twin_good, wasserstein_, epsilon,
+                               geometricalFactor_, diagonal_queue_);
+    }
+  } else {
+    if(use_kdt_) {
+      // We can use the kd-tree to speed up the search
+      idx_reassigned
+        = b.runKDTBidding(&all_goods, twin_good, wasserstein_, epsilon,
+                          geometricalFactor_, &kdt_, kdt_index);
+    } else {
+      idx_reassigned = b.runBidding(
+        &all_goods, twin_good, wasserstein_, epsilon, geometricalFactor_);
+    }
+  }
+  return idx_reassigned;
+}
+
+void ttk::PersistenceDiagramAuction::unassignBidder(const int pos) {
+  if(pos >= 0) {
+    Bidder &reassigned = bidders_[pos];
+    reassigned.resetProperty();
+    unassignedBidders_.push(pos);
+  }
+}
+
+void ttk::PersistenceDiagramAuction::runBiddingBatch(int &n_biddings,
+                                                     const double epsilon,
+                                                     const int kdt_index) {
+  // Jacobi-style round: the off-diagonal bidders of the batch look for their
+  // bid in parallel against the prices at the start of the batch, then the
+  // bids are applied sequentially, in queue order. Prices only increase, so a
+  // bid that is not higher than the current price of its good has been
+  // outbid in this batch and its bidder is simply put back in the queue.
+  const size_t batchSize = std::min(
+    unassignedBidders_.size(), static_cast<size_t>(32 * this->threadNumber_));
+
+  std::vector<int> positions(batchSize);
+  for(size_t i = 0; i < batchSize; ++i) {
+    positions[i] = unassignedBidders_.front();
+    unassignedBidders_.pop();
+  }
+
+  // bids stored as arrays (good, price, KD-Tree node)
+  std::vector<Good *> bidGoods(batchSize, nullptr);
+  std::vector<double> bidPrices(batchSize, 0.0);
+  std::vector<int> bidNodes(batchSize, -1);
 
-    GoodDiagram &all_goods = b.isDiagonal() ? diagonal_goods_ : goods_;
-    Good &twin_good = b.id_ >= 0 ? diagonal_goods_[b.id_] : goods_[-b.id_ - 1];
-    // double eps = epsilon_*(1+0.05*n_biddings/bidders_.size());
-    int idx_reassigned;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic, 8) num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < batchSize; ++i) {
+    const Bidder &b = this->bidders_[positions[i]];
     if(b.isDiagonal()) {
-      if(use_kdt_) {
-        idx_reassigned = b.runDiagonalKDTBidding(
-          &all_goods, twin_good, wasserstein_, epsilon, geometricalFactor_,
-          correspondence_kdt_map_, diagonal_queue_, kdt_index);
-      } else {
-        idx_reassigned
-          = b.runDiagonalBidding(&all_goods, twin_good, wasserstein_, epsilon,
-                                 geometricalFactor_, diagonal_queue_);
-      }
+      // diagonal bidders share the diagonal queue, they bid sequentially
+      continue;
+    }
+    Good &twin_good = diagonal_goods_[b.id_];
+    if(use_kdt_) {
+      bidGoods[i]
+        = b.findKDTBid(&goods_, twin_good, wasserstein_, epsilon,
+                       geometricalFactor_, &kdt_, bidPrices[i], bidNodes[i],
+                       kdt_index);
     } else {
-      if(use_kdt_) {
-        // We can use the kd-tree to speed up the search
-        idx_reassigned
-          = b.runKDTBidding(&all_goods, twin_good, wasserstein_, epsilon,
-                            geometricalFactor_, &kdt_, kdt_index);
-      } else {
-        idx_reassigned = b.runBidding(
-          &all_goods, twin_good, wasserstein_, epsilon, geometricalFactor_);
-      }
+      bidGoods[i] = b.findBid(&goods_, twin_good, wasserstein_, epsilon,
+                              geometricalFactor_, bidPrices[i]);
+    }
+  }
+
+  for(size_t i = 0; i < batchSize; ++i) {
+    n_biddings++;
+    const int pos = positions[i];
+    Bidder &b = this->bidders_[pos];
+    if(b.isDiagonal()) {
+      this->unassignBidder(this->runBidderBidding(pos, epsilon, kdt_index));
+      continue;
+    }
+    Good *good = bidGoods[i];
+    if(good == nullptr) {
+      continue;
+    }
+    if(bidPrices[i] <= good->getPrice()) {
+      // outbid in this batch: bid again later with up-to-date prices
+      unassignedBidders_.push(pos);
+      continue;
     }
-    if(idx_reassigned >= 0) {
-      Bidder &reassigned = bidders_[idx_reassigned];
-      reassigned.resetProperty();
-      unassignedBidders_.push(idx_reassigned);
+    const int idx_reassigned = b.assignBid(*good, bidPrices[i]);
+    if(bidNodes[i] >= 0) {
+      kdt_.updateWeight(bidNodes[i], bidPrices[i], kdt_index);
     }
+    this->unassignBidder(idx_reassigned);
   }
 }
 
@@ -110,19 +193,32 @@ double ttk::PersistenceDiagramAuction::getMatchingsAndDistance(
 
 double ttk::PersistenceDiagramAuction::initLowerBoundCost(const int kdt_index) {
   lowerBoundCost_ = 0;
+
+  // Get closest goods of the off-diagonal bidders in one batch
+  std::vector<int> queryIndex(bidders_.size(), -1);
+  std::vector<std::vector<int>> neighbours;
+  std::vector<std::vector<double>> costs;
+  if(use_kdt_) {
+    std::vector<std::array<double, 5>> coordinates;
+    for(unsigned int i = 0; i < bidders_.size(); ++i) {
+      if(!bidders_[i].isDiagonal()) {
+        queryIndex[i] = coordinates.size();
+        coordinates.emplace_back();
+        bidders_[i].GetKDTCoordinates(geometricalFactor_, coordinates.back());
+      }
+    }
+    kdt_.getKClosest(
+      1, coordinates, neighbours, costs, kdt_index, this->threadNumber_);
+  }
+
   for(unsigned int i = 0; i < bidders_.size(); ++i) {
     if(bidders_[i].isDiagonal())
       continue;
 
     // Get closest good
     double bestCost = std::numeric_limits<double>::max();
-    std::vector<KDT *> neighbours;
-    std::vector<double> costs;
     if(use_kdt_) {
-      std::array<double, 5> coordinates;
-      bidders_[i].GetKDTCoordinates(geometricalFactor_, coordinates);
-      kdt_.getKClosest(1, coordinates, neighbours, costs, kdt_index);
-      int const bestIndex = neighbours[0]->id_;
+      int const bestIndex = kdt_.getId(neighbours[queryIndex[i]][0]);
       bestCost
         = bidders_[i].cost(goods_[bestIndex], wasserstein_, geometricalFactor_);
     } else {
@@ -200,6 +296,21 @@ int ttk::Bidder::runBidding(GoodDiagram *goods,
                             int wasserstein,
                             double epsilon,
                             double geometricalFactor) {
+  double new_price{};
+  Good *best_good = this->findBid(
+    goods, twinGood, wasserstein, epsilon, geometricalFactor, new_price);
+  if(best_good == nullptr) {
+    return -1;
+  }
+  return this->assignBid(*best_good, new_price);
+}
+
+ttk::Good *ttk::Bidder::findBid(GoodDiagram *goods,
+                                Good &twinGood,
+                                int wasserstein,
+                                double epsilon,
+                                double geometricalFactor,
+                                double &new_price) const {
   double best_val = std::numeric_limits<double>::lowest();
   double second_val = std::numeric_limits<double>::lowest();
   Good *best_good{};
@@ -232,21 +343,24 @@ int ttk::Bidder::runBidding(GoodDiagram *goods,
     second_val = best_val;
   }
   if(best_good == nullptr) {
-    return -1;
+    return nullptr;
   }
   double const old_price = best_good->getPrice();
-  double new_price = old_price + best_val - second_val + epsilon;
+  new_price = old_price + best_val - second_val + epsilon;
   if(new_price > std::numeric_limits<double>::max() / 2) {
     new_price = old_price + epsilon;
   }
-  // Assign bidder to best_good
-  this->setProperty(*best_good);
+  return best_good;
+}
+
+int ttk::Bidder::assignBid(Good &good, const double new_price) {
+  // Assign bidder to good
+  this->setProperty(good);
   this->setPricePaid(new_price);
 
-  // Assign best_good to bidder and unassign the previous owner of best_good
-  // if need be
-  int const idx_reassigned = best_good->getOwner();
-  best_good->assign(this->position_in_auction_, new_price);
+  // Assign good to bidder and unassign the previous owner of good if need be
+  int const idx_reassigned = good.getOwner();
+  good.assign(this->position_in_auction_, new_price);
   return idx_reassigned;
 }
 
@@ -369,7 +483,8 @@ int ttk::Bidder::runDiagonalKDTBidding(
   int wasserstein,
   double epsilon,
   double geometricalFactor,
-  std::vector<KDT *> &correspondence_kdt_map,
+  KDT *kdt,
+  KDT::KDTreeMap &correspondence_kdt_map,
   std::priority_queue<std::pair<int, double>,
                       std::vector<std::pair<int, double>>,
                       Compare> &diagonal_queue,
@@ -471,7 +586,8 @@ int ttk::Bidder::runDiagonalKDTBidding(
   best_good->assign(this->position_in_auction_, new_price);
   if(is_twin) {
     // Update weight in KDTree if the closest good is in it
-    correspondence_kdt_map[best_good->id_]->updateWeight(new_price, kdt_index);
+    kdt->updateWeight(
+      correspondence_kdt_map[best_good->id_], new_price, kdt_index);
     if(non_empty_goods) {
       diagonal_queue.push(best_pair);
     }
@@ -493,7 +609,30 @@ int ttk::Bidder::runKDTBidding(GoodDiagram *goods,
                                const int kdt_index) {
 
   /// Runs bidding of a non-diagonal bidder
-  std::vector<KDT *> neighbours;
+  double new_price{};
+  int closest_kdt{};
+  Good *best_good
+    = this->findKDTBid(goods, twinGood, wasserstein, epsilon, geometricalFactor,
+                       kdt, new_price, closest_kdt, kdt_index);
+  int const idx_reassigned = this->assignBid(*best_good, new_price);
+  // Update the price in the KDTree
+  if(closest_kdt != -1) {
+    kdt->updateWeight(closest_kdt, new_price, kdt_index);
+  }
+  return idx_reassigned;
+}
+
+ttk::Good *ttk::Bidder::findKDTBid(GoodDiagram *goods,
+                                   Good &twinGood,
+                                   int wasserstein,
+                                   double epsilon,
+                                   double geometricalFactor,
+                                   const KDT *kdt,
+                                   double &new_price,
+                                   int &kdt_node,
+                                   const int kdt_index) const {
+
+  std::vector<int> neighbours;
   std::vector<double> costs;
 
   std::array<double, 5> coordinates;
@@ -501,7 +640,7 @@ int ttk::Bidder::runKDTBidding(GoodDiagram *goods,
 
   kdt->getKClosest(2, coordinates, neighbours, costs, kdt_index);
   double best_val, second_val;
-  KDT *closest_kdt;
+  int closest_kdt;
   Good *best_good{};
   if(costs.size() == 2) {
     std::array<int, 2> idx{0, 1};
@@ -509,7 +648,7 @@ int ttk::Bidder::runKDTBidding(GoodDiagram *goods,
               [&costs](int &a, int &b) { return costs[a] < costs[b]; });
 
     closest_kdt = neighbours[idx[0]];
-    best_good = &(*goods)[closest_kdt->id_];
+    best_good = &(*goods)[kdt->getId(closest_kdt)];
     // Value is defined as the opposite of cost (each bidder aims at
     // maximizing it)
     best_val = -costs[idx[0]];
@@ -517,7 +656,7 @@ int ttk::Bidder::runKDTBidding(GoodDiagram *goods,
   } else {
     // If the kdtree contains only one point
     closest_kdt = neighbours[0];
-    best_good = &(*goods)[closest_kdt->id_];
+    best_good = &(*goods)[kdt->getId(closest_kdt)];
     best_val = -costs[0];
     second_val = best_val;
   }
@@ -540,21 +679,10 @@ int ttk::Bidder::runKDTBidding(GoodDiagram *goods,
     second_val = best_val;
   }
   double const old_price = best_good->getPrice();
-  double new_price = old_price + best_val - second_val + epsilon;
+  new_price = old_price + best_val - second_val + epsilon;
   if(new_price > std::numeric_limits<double>::max() / 2) {
     new_price = old_price + epsilon;
   }
-  // Assign bidder to best_good
-  this->setProperty(*best_good);
-  this->setPricePaid(new_price);
-  // Assign best_good to bidder and unassign the previous owner of best_good
-  // if need be
-  int const idx_reassigned = best_good->getOwner();
-
-  best_good->assign(this->position_in_auction_, new_price);
-  // Update the price in the KDTree
-  if(!twin_chosen) {
-    closest_kdt->updateWeight(new_price, kdt_index);
-  }
-  return idx_reassigned;
+  kdt_node = twin_chosen ? -1 : closest_kdt;
+  return best_good;
 }
@@ -16,8 +16,8 @@ namespace ttk {
 
     KDT default_kdt_{};
     KDT &kdt_{default_kdt_};
-    std::vector<KDT *> default_correspondence_kdt_map_{};
-    std::vector<KDT *> &correspondence_kdt_map_{
+    KDT::KDTreeMap default_correspondence_kdt_map_{};
+    KDT::KDTreeMap &correspondence_kdt_map_{
       default_correspondence_kdt_map_};
 
     inline void initLowerBoundCostWeight(double delta_lim) {
@@ -42,7 +42,7 @@ namespace ttk {
                               double lambda,
                               double delta_lim,
                               KDT &kdt,
-                              std::vector<KDT *> &correspondence_kdt_map,
+                              KDT::KDTreeMap &correspondence_kdt_map,
                               double epsilon = {},
                               double initial_diag_price = {},
                               bool use_kdTree = true)
@@ -85,6 +85,13 @@ namespace ttk {
     }
 
     void runAuctionRound(int &n_biddings, const int kdt_index = 0);
+    int runBidderBidding(const int pos,
+                         const double epsilon,
+                         const int kdt_index = 0);
+    void runBiddingBatch(int &n_biddings,
+                         const double epsilon,
+                         const int kdt_index = 0);
+    void unassignBidder(const int pos);
     double getMatchingsAndDistance(std::vector<MatchingType> &matchings,
                                    bool get_diagonal_matches = false);
     double run(std::vector<MatchingType> &matchings, const int kdt_index = 0);
@@ -198,6 +205,12 @@ namespace ttk {
         = kdt_.build(coordinates.data(), goods_.size(), dimension);
     }
 
+    // Let the off-diagonal bidders of large bidding batches search for their
+    // bids in parallel (uses threadNumber_ threads)
+    void setParallelBidding(const bool parallelBidding) {
+      parallelBidding_ = parallelBidding;
+    }
+
     void setEpsilon(const double epsilon) {
       epsilon_ = epsilon;
     }
@@ -306,6 +319,7 @@ namespace ttk {
     double delta_lim_{};
     double lowerBoundCost_, lowerBoundCostWeight_;
     bool use_kdt_{true};
+    bool parallelBidding_{false};
 
   }; // namespace ttk
 } // namespace ttk
@@ -259,6 +259,29 @@ namespace ttk {
                       KDT *kdt,
                       const int kdt_index = 0);
 
+    // Search of the off-diagonal bid, without modifying the goods: return
+    // the good to bid for (nullptr if none) and its new price. With the
+    // KD-Tree, kdt_node is the node of the good or -1 for the twin good.
+    Good *findBid(GoodDiagram *goods,
+                  Good &diagonalGood,
+                  int wasserstein,
+                  double epsilon,
+                  double geometricalFactor,
+                  double &new_price) const;
+    Good *findKDTBid(GoodDiagram *goods,
+                     Good &diagonalGood,
+                     int wasserstein,
+                     double epsilon,
+                     double geometricalFactor,
+                     const KDT *kdt,
+                     double &new_price,
+                     int &kdt_node,
+                     const int kdt_index = 0) const;
+
+    // Assign a good to this bidder at the given price, return the position
+    // of its previous owner (or -1)
+    int assignBid(Good &good, const double new_price);
+
     // Diagonal Bidding (with or without the use of a KD-Tree
     int runDiagonalBidding(
       GoodDiagram *goods,
@@ -275,7 +298,8 @@ namespace ttk {
       int wasserstein,
       double epsilon,
       double geometricalFactor,
-      std::vector<KDT *> &correspondence_kdt_map,
+      KDT *kdt,
+      KDT::KDTreeMap &correspondence_kdt_map,
       std::priority_queue<std::pair<int, double>,
                           std::vector<std::pair<int, double>>,
                           Compare> &diagonal_queue,
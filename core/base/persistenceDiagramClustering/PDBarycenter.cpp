@@ -28,7 +28,7 @@ void ttk::PDBarycenter::runMatching(
   double epsilon,
   std::vector<int> &sizes,
   KDT &kdt,
-  std::vector<KDT *> &correspondence_kdt_map,
+  KDT::KDTreeMap &correspondence_kdt_map,
   std::vector<double> *min_diag_price,
   std::vector<double> *min_price,
   std::vector<std::vector<MatchingType>> *all_matchings,
@@ -81,7 +81,7 @@ void ttk::PDBarycenter::runMatchingAuction(
   double *total_cost,
   std::vector<int> &sizes,
   KDT &kdt,
-  std::vector<KDT *> &correspondence_kdt_map,
+  KDT::KDTreeMap &correspondence_kdt_map,
   std::vector<double> *min_diag_price,
   std::vector<std::vector<MatchingType>> *all_matchings,
   bool use_kdt,
@@ -584,7 +584,7 @@ typename ttk::PDBarycenter::KDTreePair ttk::PDBarycenter::getKDTree() const {
 
   auto correspondence_kdt_map
     = kdt->build(coordinates.data(), barycenter_goods_[0].size(), dimension,
-                 weights, barycenter_goods_.size());
+                 weights, barycenter_goods_.size(), this->threadNumber_);
   this->printMsg(" Building KDTree", 1, tm.getElapsedTime(),
                  debug::LineMode::NEW, debug::Priority::VERBOSE);
   return std::make_pair(std::move(kdt), correspondence_kdt_map);
@@ -623,7 +623,7 @@ std::vector<std::vector<ttk::MatchingType>>
   while(!finished) {
     Timer const tm;
 
-    std::pair<std::unique_ptr<KDT>, std::vector<KDT *>> pair;
+    KDTreePair pair;
     bool use_kdt = false;
     // If the barycenter is empty, do not compute the kdt (or it will crash :/)
     // TODO Fix KDTree to handle empty inputs...
@@ -152,7 +152,9 @@ double PersistenceDiagramDistanceMatrix::getMostPersistent(
 }
 
 double PersistenceDiagramDistanceMatrix::computePowerDistance(
-  const BidderDiagram &D1, const BidderDiagram &D2) const {
+  const BidderDiagram &D1,
+  const BidderDiagram &D2,
+  const int auctionThreadNumber) const {
 
   GoodDiagram D2_bis{};
   for(size_t i = 0; i < D2.size(); i++) {
@@ -165,6 +167,8 @@ double PersistenceDiagramDistanceMatrix::computePowerDistance(
 
   PersistenceDiagramAuction auction(
     this->Wasserstein, this->Alpha, this->Lambda, this->DeltaLim, true);
+  auction.setThreadNumber(auctionThreadNumber);
+  auction.setParallelBidding(auctionThreadNumber > 1);
   auction.BuildAuctionDiagrams(D1, D2_bis);
   return auction.run();
 }
@@ -178,8 +182,14 @@ void PersistenceDiagramDistanceMatrix::getDiagramsDistMat(
 
   distanceMatrix.resize(nInputs[0]);
 
+  // with fewer matrix lines than threads, parallelize each auction instead
+  const bool parallelLines
+    = nInputs[0] >= static_cast<size_t>(this->threadNumber_);
+  const int auctionThreadNumber = parallelLines ? 1 : this->threadNumber_;
+
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for schedule(dynamic) num_threads(this->threadNumber_)
+#pragma omp parallel for schedule(dynamic) num_threads(this->threadNumber_) \
+  if(parallelLines)
 #endif // TTK_ENABLE_OPENMP
   for(size_t i = 0; i < nInputs[0]; ++i) {
 
@@ -196,17 +206,17 @@ void PersistenceDiagramDistanceMatrix::getDiagramsDistMat(
       if(this->do_min_) {
         auto &dimin = diags_min[a];
         auto &djmin = diags_min[b];
-        distance += computePowerDistance(dimin, djmin);
+        distance += computePowerDistance(dimin, djmin, auctionThreadNumber);
       }
       if(this->do_sad_) {
         auto &disad = diags_sad[a];
         auto &djsad = diags_sad[b];
-        distance += computePowerDistance(disad, djsad);
+        distance += computePowerDistance(disad, djsad, auctionThreadNumber);
       }
       if(this->do_max_) {
         auto &dimax = diags_max[a];
         auto &djmax = diags_max[b];
-        distance += computePowerDistance(dimax, djmax);
+        distance += computePowerDistance(dimax, djmax, auctionThreadNumber);
       }
       return Geometry::pow(distance, 1.0 / this->Wasserstein);
     };
@@ -79,7 +79,8 @@ namespace ttk {
     double
       getMostPersistent(const std::vector<BidderDiagram> &bidder_diags) const;
     double computePowerDistance(const BidderDiagram &D1,
-                                const BidderDiagram &D2) const;
+                                const BidderDiagram &D2,
+                                const int auctionThreadNumber = 1) const;
     void getDiagramsDistMat(const std::array<size_t, 2> &nInputs,
                             std::vector<std::vector<double>> &distanceMatrix,
                             const std::vector<BidderDiagram> &diags_min,
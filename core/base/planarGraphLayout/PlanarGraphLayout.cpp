@@ -1,6 +1,6 @@
 #include <PlanarGraphLayout.h>
 
-#if TTK_ENABLE_GRAPHVIZ
+#ifdef TTK_ENABLE_GRAPHVIZ
 #include <cgraph.h>
 #include <gvc.h>
 #endif
@@ -10,6 +10,14 @@ ttk::PlanarGraphLayout::PlanarGraphLayout() {
 }
 ttk::PlanarGraphLayout::~PlanarGraphLayout() = default;
 
+bool ttk::PlanarGraphLayout::isGraphvizFound() const {
+#ifdef TTK_ENABLE_GRAPHVIZ
+  return true;
+#else
+  return false;
+#endif // TTK_ENABLE_GRAPHVIZ
+}
+
 // Compute Dot Layout
 int ttk::PlanarGraphLayout::computeDotLayout(
   // Output
@@ -16,6 +16,11 @@
 /// nested based on the level hierarchy. This makes it possible to draw nested
 /// graphs where each level is a layer of the resulting graph.
 ///
+/// The layout of each level is computed either by a native layered layout
+/// engine (longest path ranking, barycentric crossing reduction and
+/// priority-based coordinate assignment) or, if TTK was built with GraphViz
+/// support, by the 'dot' layout engine of GraphViz.
+///
 /// \b Related \b publication: \n
 /// 'Nested Tracking Graphs'
 /// Jonas Lukasczyk, Gunther Weber, Ross Maciejewski, Christoph Garth, and Heike
@@ -33,7 +38,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
 #include <map>
+#include <numeric>
 
 // base code includes
 #include <Debug.h>
@@ -46,6 +56,23 @@ namespace ttk {
     PlanarGraphLayout();
     ~PlanarGraphLayout() override;
 
+    /** Engine used to compute the layout of each level */
+    enum class LAYOUT_ENGINE {
+      /** Built-in layered layout */
+      NATIVE = 0,
+      /** GraphViz 'dot' layout */
+      GRAPHVIZ = 1,
+    };
+
+    inline void setLayoutEngine(const LAYOUT_ENGINE engine) {
+      this->LayoutEngine = engine;
+    }
+
+    /**
+     * @brief Whether TTK was built with GraphViz support
+     */
+    bool isGraphvizFound() const;
+
     template <typename ST, typename IT, typename CT>
     int computeLayout(
       // Output
@@ -108,6 +135,23 @@ namespace ttk {
       // Input
       const std::vector<size_t> &nodeIndices,
       const std::string &dotString) const;
+
+    template <typename ST, typename IT, typename CT>
+    int computeNativeLayout(
+      // Output
+      float *layout,
+
+      // Input
+      const CT *connectivityList,
+      const ST *pointSequences,
+      const float *sizes,
+      const IT *branches,
+      const std::vector<size_t> &nodeIndices,
+      const std::vector<size_t> &edgeIndices,
+      const std::map<ST, size_t> &sequenceValueToIndexMap) const;
+
+  protected:
+    LAYOUT_ENGINE LayoutEngine{LAYOUT_ENGINE::NATIVE};
   };
 } // namespace ttk
 
@@ -272,6 +316,333 @@ int ttk::PlanarGraphLayout::computeDotString(
   return 1;
 }
 
+// =============================================================================
+// Compute Native Layout
+// =============================================================================
+template <typename ST, typename IT, typename CT>
+int ttk::PlanarGraphLayout::computeNativeLayout(
+  // Output
+  float *layout,
+
+  // Input
+  const CT *connectivityList,
+  const ST *pointSequences,
+  const float *sizes,
+  const IT *branches,
+  const std::vector<size_t> &nodeIndices,
+  const std::vector<size_t> &edgeIndices,
+  const std::map<ST, size_t> &sequenceValueToIndexMap) const {
+
+  Timer t;
+
+  this->printMsg("Computing layout", 0, debug::LineMode::REPLACE);
+
+  bool const useSequences = pointSequences != nullptr;
+  bool const useSizes = sizes != nullptr;
+  bool const useBranches = branches != nullptr;
+
+  // same units as the dot layout (inches)
+  const float rankSep = 1.5; // node width + rank separation
+  const float nodeSep = 0.25;
+  // weight of the edges between nodes of the same branch
+  const double branchWeight = 4.0;
+  const int nSweeps = 4;
+
+  const size_t nNodes = nodeIndices.size();
+  if(nNodes == 0) {
+    this->printMsg("Computing layout", 1, t.getElapsedTime());
+    return 1;
+  }
+
+  // ---------------------------------------------------------------------------
+  // Adjacency (CSR) of the level subgraph, in local indices
+  // ---------------------------------------------------------------------------
+  // nodeIndices is sorted by extractLevel
+  const auto localIndex = [&nodeIndices](const size_t i) {
+    return static_cast<size_t>(
+      std::lower_bound(nodeIndices.begin(), nodeIndices.end(), i)
+      - nodeIndices.begin());
+  };
+
+  std::vector<size_t> outOffsets(nNodes + 1, 0), inOffsets(nNodes + 1, 0);
+  std::vector<std::array<size_t, 2>> edges;
+  std::vector<char> edgeInBranch;
+  edges.reserve(edgeIndices.size());
+  edgeInBranch.reserve(edgeIndices.size());
+  for(const auto &edgeIndex : edgeIndices) {
+    const auto i0 = connectivityList[edgeIndex * 2 + 0];
+    const auto i1 = connectivityList[edgeIndex * 2 + 1];
+    if(i0 == i1)
+      continue;
+    edges.push_back({localIndex(i0), localIndex(i1)});
+    edgeInBranch.push_back(useBranches && branches[i0] == branches[i1]);
+    outOffsets[edges.back()[0] + 1]++;
+    inOffsets[edges.back()[1] + 1]++;
+  }
+  std::partial_sum(outOffsets.begin(), outOffsets.end(), outOffsets.begin());
+  std::partial_sum(inOffsets.begin(), inOffsets.end(), inOffsets.begin());
+
+  std::vector<size_t> outTargets(edges.size()), inSources(edges.size());
+  std::vector<char> outInBranch(edges.size()), inInBranch(edges.size());
+  {
+    std::vector<size_t> outCursor(outOffsets.begin(), outOffsets.end() - 1);
+    std::vector<size_t> inCursor(inOffsets.begin(), inOffsets.end() - 1);
+    for(size_t e = 0; e < edges.size(); e++) {
+      const size_t o = outCursor[edges[e][0]]++;
+      outTargets[o] = edges[e][1];
+      outInBranch[o] = edgeInBranch[e];
+      const size_t i = inCursor[edges[e][1]]++;
+      inSources[i] = edges[e][0];
+      inInBranch[i] = edgeInBranch[e];
+    }
+  }
+
+  // ---------------------------------------------------------------------------
+  // Ranks
+  // ---------------------------------------------------------------------------
+  std::vector<size_t> ranks(nNodes, 0);
+  size_t nRanks = 1;
+  if(useSequences) {
+    nRanks = sequenceValueToIndexMap.size();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t v = 0; v < nNodes; v++)
+      ranks[v]
+        = sequenceValueToIndexMap.find(pointSequences[nodeIndices[v]])->second;
+  } else {
+    // longest path ranking, the nodes of a rank (sources first) are
+    // processed in parallel
+    std::vector<long> inDegree(nNodes);
+    std::vector<char> processed(nNodes, 0);
+    std::vector<size_t> frontier, next;
+    for(size_t v = 0; v < nNodes; v++) {
+      inDegree[v] = inOffsets[v + 1] - inOffsets[v];
+      if(inDegree[v] == 0)
+        frontier.push_back(v);
+    }
+
+    size_t nProcessed = 0, rank = 0, firstUnprocessed = 0;
+    while(nProcessed < nNodes) {
+      if(frontier.empty()) {
+        // the graph has a cycle: break it at the first unprocessed node
+        while(processed[firstUnprocessed])
+          firstUnprocessed++;
+        frontier.push_back(firstUnprocessed);
+      }
+      nProcessed += frontier.size();
+      next.clear();
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+      {
+        std::vector<size_t> localNext;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for nowait
+#endif // TTK_ENABLE_OPENMP
+        for(size_t k = 0; k < frontier.size(); k++) {
+          const size_t v = frontier[k];
+          ranks[v] = rank;
+          processed[v] = 1;
+          for(size_t o = outOffsets[v]; o < outOffsets[v + 1]; o++) {
+            const size_t w = outTargets[o];
+            long d;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic capture
+#endif // TTK_ENABLE_OPENMP
+            d = --inDegree[w];
+            // (d == 0 can only be reached once, nodes of the current frontier
+            // are already at 0)
+            if(d == 0 && !processed[w])
+              localNext.push_back(w);
+          }
+        }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp critical
+#endif // TTK_ENABLE_OPENMP
+        next.insert(next.end(), localNext.begin(), localNext.end());
+      }
+
+      // deterministic order, whatever the number of threads
+      std::sort(next.begin(), next.end());
+      frontier.swap(next);
+      rank++;
+    }
+    nRanks = rank;
+  }
+
+  // ---------------------------------------------------------------------------
+  // Initial order: depth first traversal (planar for trees)
+  // ---------------------------------------------------------------------------
+  std::vector<size_t> dfsOrder(nNodes, nNodes);
+  {
+    size_t order = 0;
+    std::vector<size_t> stack;
+    const auto traverse = [&](const size_t root) {
+      stack.push_back(root);
+      while(!stack.empty()) {
+        const size_t v = stack.back();
+        stack.pop_back();
+        if(dfsOrder[v] != nNodes)
+          continue;
+        dfsOrder[v] = order++;
+        for(size_t o = outOffsets[v + 1]; o > outOffsets[v]; o--)
+          if(dfsOrder[outTargets[o - 1]] == nNodes)
+            stack.push_back(outTargets[o - 1]);
+      }
+    };
+    for(size_t v = 0; v < nNodes; v++)
+      if(inOffsets[v] == inOffsets[v + 1])
+        traverse(v);
+    for(size_t v = 0; v < nNodes; v++)
+      traverse(v);
+  }
+
+  std::vector<std::vector<size_t>> rankNodes(nRanks);
+  for(size_t v = 0; v < nNodes; v++)
+    rankNodes[ranks[v]].push_back(v);
+
+  std::vector<double> positions(nNodes);
+  for(auto &nodes : rankNodes) {
+    std::sort(nodes.begin(), nodes.end(), [&dfsOrder](size_t a, size_t b) {
+      return dfsOrder[a] < dfsOrder[b];
+    });
+    for(size_t k = 0; k < nodes.size(); k++)
+      positions[nodes[k]] = k;
+  }
+
+  // ---------------------------------------------------------------------------
+  // Crossing reduction: barycentric down and up sweeps
+  // ---------------------------------------------------------------------------
+  // weighted mean of the values of the neighbors of v in lower (down) or
+  // upper ranks, NaN if none
+  const auto neighborMean
+    = [&](const size_t v, const bool down, const std::vector<double> &values) {
+        const auto &offsets = down ? inOffsets : outOffsets;
+        const auto &neighbors = down ? inSources : outTargets;
+        const auto &inBranch = down ? inInBranch : outInBranch;
+        double sum = 0, weight = 0;
+        for(size_t o = offsets[v]; o < offsets[v + 1]; o++) {
+          const size_t u = neighbors[o];
+          if(down ? ranks[u] >= ranks[v] : ranks[u] <= ranks[v])
+            continue;
+          const double w = inBranch[o] ? branchWeight : 1.0;
+          sum += w * values[u];
+          weight += w;
+        }
+        return weight > 0 ? sum / weight
+                          : std::numeric_limits<double>::quiet_NaN();
+      };
+
+  std::vector<double> keys(nNodes);
+  for(int s = 0; s < 2 * nSweeps; s++) {
+    const bool down = (s % 2 == 0);
+    for(size_t rr = 1; rr < nRanks; rr++) {
+      auto &nodes = rankNodes[down ? rr : nRanks - 1 - rr];
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_) \
+  if(nodes.size() > 1024)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t k = 0; k < nodes.size(); k++) {
+        const double mean = neighborMean(nodes[k], down, positions);
+        keys[nodes[k]] = std::isnan(mean) ? positions[nodes[k]] : mean;
+      }
+      std::stable_sort(
+        nodes.begin(), nodes.end(),
+        [&keys](size_t a, size_t b) { return keys[a] < keys[b]; });
+      for(size_t k = 0; k < nodes.size(); k++)
+        positions[nodes[k]] = k;
+    }
+  }
+
+  // ---------------------------------------------------------------------------
+  // Coordinates: align nodes with their neighbors (straight branches), then
+  // resolve overlaps in each rank following the computed order
+  // ---------------------------------------------------------------------------
+  const auto height
+    = [&](const size_t v) { return useSizes ? sizes[nodeIndices[v]] : 1.0f; };
+
+  // y coordinate of the neighbor on the same branch if any, or weighted mean
+  const auto alignedY = [&](const size_t v, const bool down,
+                            const std::vector<double> &ys) {
+    const auto &offsets = down ? inOffsets : outOffsets;
+    const auto &neighbors = down ? inSources : outTargets;
+    const auto &inBranch = down ? inInBranch : outInBranch;
+    for(size_t o = offsets[v]; o < offsets[v + 1]; o++) {
+      const size_t u = neighbors[o];
+      if(inBranch[o] && (down ? ranks[u] < ranks[v] : ranks[u] > ranks[v]))
+        return ys[u];
+    }
+    return neighborMean(v, down, ys);
+  };
+
+  std::vector<double> ys(nNodes, 0);
+  std::vector<double> desired(nNodes);
+  const auto placeRank = [&](const std::vector<size_t> &nodes) {
+    bool first = true;
+    double bottom = 0;
+    for(const auto v : nodes) {
+      const double h = height(v);
+      double y = desired[v];
+      if(!first)
+        y = std::isnan(y) ? bottom + nodeSep + h / 2
+                          : std::max(y, bottom + nodeSep + h / 2);
+      else if(std::isnan(y))
+        y = h / 2;
+      ys[v] = y;
+      bottom = y + h / 2;
+      first = false;
+    }
+  };
+
+  // down: follow the lower ranks
+  for(size_t r = 0; r < nRanks; r++) {
+    const auto &nodes = rankNodes[r];
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_) \
+  if(nodes.size() > 1024)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t k = 0; k < nodes.size(); k++)
+      desired[nodes[k]] = alignedY(nodes[k], true, ys);
+    placeRank(nodes);
+  }
+  // up: center the nodes without lower neighbors on their upper neighbors
+  for(size_t rr = 1; rr <= nRanks; rr++) {
+    const auto &nodes = rankNodes[nRanks - rr];
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_) \
+  if(nodes.size() > 1024)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t k = 0; k < nodes.size(); k++) {
+      const size_t v = nodes[k];
+      desired[v] = ys[v];
+      if(std::isnan(neighborMean(v, true, ys))) {
+        const double y = alignedY(v, false, ys);
+        if(!std::isnan(y))
+          desired[v] = y;
+      }
+    }
+    placeRank(nodes);
+  }
+
+  // ---------------------------------------------------------------------------
+  // Write layout
+  // ---------------------------------------------------------------------------
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t v = 0; v < nNodes; v++) {
+    const size_t offset = nodeIndices[v] * 2;
+    layout[offset] = ranks[v] * rankSep;
+    layout[offset + 1] = ys[v];
+  }
+
+  this->printMsg("Computing layout", 1, t.getElapsedTime());
+
+  return 1;
+}
+
 // =============================================================================
 // Compute Slots
 // =============================================================================
@@ -422,6 +793,12 @@ int ttk::PlanarGraphLayout::computeLayout(
     return 0;
   }
 
+  bool useGraphviz = this->LayoutEngine == LAYOUT_ENGINE::GRAPHVIZ;
+  if(useGraphviz && !this->isGraphvizFound()) {
+    this->printWrn("GraphViz support disabled, using the native layout.");
+    useGraphviz = false;
+  }
+
   // Global SequenceValue to SequenceIndex map
   std::map<ST, size_t> sequenceValueToIndexMap;
   if(useSequences) {
@@ -460,12 +837,33 @@ int ttk::PlanarGraphLayout::computeLayout(
         return 0;
     }
 
-    // Compute Dot String
-    std::string dotString;
-    {
-      int const status = this->computeDotString<ST, IT, CT>(
+    if(useGraphviz) {
+      // Compute Dot String
+      std::string dotString;
+      {
+        int const status = this->computeDotString<ST, IT, CT>(
+          // Output
+          dotString,
+
+          // Input
+          connectivityList, pointSequences, sizes, branches, nodeIndices,
+          edgeIndices, sequenceValueToIndexMap);
+        if(status != 1)
+          return 0;
+      }
+
+      // Compute Dot Layout
+      {
+        int const status
+          = this->computeDotLayout(layout, nodeIndices, dotString);
+        if(status != 1)
+          return 0;
+      }
+    } else {
+      // Compute Native Layout
+      int const status = this->computeNativeLayout<ST, IT, CT>(
         // Output
-        dotString,
+        layout,
 
         // Input
         connectivityList, pointSequences, sizes, branches, nodeIndices,
@@ -473,13 +871,6 @@ int ttk::PlanarGraphLayout::computeLayout(
       if(status != 1)
         return 0;
     }
-
-    // Compute Dot Layout
-    {
-      int const status = this->computeDotLayout(layout, nodeIndices, dotString);
-      if(status != 1)
-        return 0;
-    }
   }
 
   // ---------------------------------------------------------------------------
@@ -30,6 +30,7 @@
 
 // base code includes
 #include <FiberSurface.h>
+#include <FlatUnionFind.h>
 #include <Geometry.h>
 #include <JacobiSet.h>
 #include <Triangulation.h>
@@ -244,6 +245,15 @@ namespace ttk {
       vertexNumber_ = vertexNumber;
     }
 
+    /// Set the number of threads, also used by the Jacobi set and fiber
+    /// surface computations.
+    inline int setThreadNumber(const int threadNumber) override {
+      Debug::setThreadNumber(threadNumber);
+      jacobiSet_.setThreadNumber(threadNumber);
+      fiberSurface_.setThreadNumber(threadNumber);
+      return 0;
+    }
+
     // WARNING: if you plan to use the range driven octree, make sure
     // that you provided pointers to the u and v fields.
     inline int
@@ -323,10 +333,26 @@ namespace ttk {
                                      const triangulationType &triangulation);
 
     template <typename triangulationType>
-    int compute3sheet(
-      const SimplexId &vertexId,
-      const std::vector<std::vector<std::array<SimplexId, 3>>> &tetTriangles,
-      const triangulationType &triangulation);
+    int compute3sheet(const SimplexId &vertexId,
+                      const SimplexId &sheetId,
+                      const std::vector<uint8_t> &tetCutEdges,
+                      const triangulationType &triangulation);
+
+    inline bool isCut(
+      const SimplexId &tetId,
+      const SimplexId &vertexId0,
+      const SimplexId &vertexId1,
+      const std::vector<std::vector<std::array<SimplexId, 3>>> &tetTriangles)
+      const;
+
+    /// Bit of the edge between the local vertices @p j and @p k (j != k) of
+    /// a tet.
+    static inline uint8_t tetEdgeBit(const int j, const int k) {
+      const int minId = std::min(j, k);
+      const int maxId = std::max(j, k);
+      // (0,1) -> 0, (0,2) -> 1, (0,3) -> 2, (1,2) -> 3, (1,3) -> 4, (2,3) -> 5
+      return 1 << (minId * (5 - minId) / 2 + maxId - 1);
+    }
 
     template <typename triangulationType>
     int compute3sheets(
@@ -567,8 +593,10 @@ inline int ttk::ReebSpace::compute2sheets(
     }
   }
 
+  // the cost of a fiber surface strongly varies from a Jacobi edge to the
+  // other
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
 #endif
   for(size_t i = 0; i < jacobiEdges.size(); i++) {
 
@@ -880,10 +908,16 @@ int ttk::ReebSpace::compute1sheetsOnly(
   jacobiClassification.reserve(jacobiSet.size());
 
   // markup the saddle jacobi and visisted edges
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
   for(size_t i = 0; i < jacobiSet.size(); i++) {
     originalData_.edgeTypes_[jacobiSet[i].first] = jacobiSet[i].second;
   }
 
+  // NOTE: the traversal of the Jacobi set (1-dimensional, orders of
+  // magnitude smaller than the mesh) is kept sequential, its order
+  // defines the identifiers of the 0-, 1- and 2-sheets.
   std::vector<bool> visitedEdges(triangulation.getNumberOfEdges(), false);
 
   for(size_t i = 0; i < jacobiSet.size(); i++) {
@@ -1204,17 +1238,59 @@ int ttk::ReebSpace::compute1sheets(
   return 0;
 }
 
+inline bool ttk::ReebSpace::isCut(
+  const SimplexId &tetId,
+  const SimplexId &vertexId0,
+  const SimplexId &vertexId1,
+  const std::vector<std::vector<std::array<SimplexId, 3>>> &tetTriangles)
+  const {
+
+  // we need to see if the edge <vertexId0, vertexId1> is cut by a fiber
+  // surface triangle or not.
+  for(size_t k = 0; k < tetTriangles[tetId].size(); k++) {
+    SimplexId l = 0, m = 0, n = 0;
+    l = tetTriangles[tetId][k][0];
+    m = tetTriangles[tetId][k][1];
+    n = tetTriangles[tetId][k][2];
+
+    for(int p = 0; p < 3; p++) {
+      std::pair<SimplexId, SimplexId> meshEdge;
+
+      if(fiberSurfaceVertexList_.size()) {
+        // the fiber surfaces have been merged
+        meshEdge = fiberSurfaceVertexList_[originalData_.sheet2List_[l]
+                                             .triangleList_[m][n]
+                                             .vertexIds_[p]]
+                     .meshEdge_;
+      } else {
+        // the fiber surfaces have not been merged
+        meshEdge
+          = originalData_.sheet2List_[l]
+              .vertexList_[m][originalData_.sheet2List_[l]
+                                .triangleList_[m][n]
+                                .vertexIds_[p]]
+              .meshEdge_;
+      }
+
+      if(((meshEdge.first == vertexId0) && (meshEdge.second == vertexId1))
+         || ((meshEdge.second == vertexId0)
+             && (meshEdge.first == vertexId1))) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
 template <typename triangulationType>
 int ttk::ReebSpace::compute3sheet(
   const SimplexId &vertexId,
-  const std::vector<std::vector<std::array<SimplexId, 3>>> &tetTriangles,
+  const SimplexId &sheetId,
+  const std::vector<uint8_t> &tetCutEdges,
   const triangulationType &triangulation) {
 
-  SimplexId const sheetId = originalData_.sheet3List_.size();
-  originalData_.sheet3List_.resize(originalData_.sheet3List_.size() + 1);
-  originalData_.sheet3List_.back().pruned_ = false;
-  originalData_.sheet3List_.back().preMerger_ = -1;
-  originalData_.sheet3List_.back().Id_ = sheetId;
+  Sheet3 &sheet = originalData_.sheet3List_[sheetId];
 
   std::queue<SimplexId> vertexQueue;
   vertexQueue.push(vertexId);
@@ -1227,7 +1303,7 @@ int ttk::ReebSpace::compute3sheet(
     if(originalData_.vertex2sheet3_[localVertexId] == -1) {
       // not visited yet
 
-      originalData_.sheet3List_.back().vertexList_.push_back(localVertexId);
+      sheet.vertexList_.push_back(localVertexId);
       originalData_.vertex2sheet3_[localVertexId] = sheetId;
 
       SimplexId const vertexStarNumber
@@ -1237,74 +1313,22 @@ int ttk::ReebSpace::compute3sheet(
         SimplexId tetId = -1;
         triangulation.getVertexStar(localVertexId, i, tetId);
 
-        if(tetTriangles[tetId].empty()) {
-          //             if(originalData_.tet2sheet3_[tetId] == -1){
-          //               originalData_.tet2sheet3_[tetId] = sheetId;
-          //               originalData_.sheet3List_.back().tetList_.push_back(tetId);
-          //             }
-          for(int j = 0; j < 4; j++) {
-
-            SimplexId tetVertexId = -1;
-            triangulation.getCellVertex(tetId, j, tetVertexId);
-
-            if(originalData_.vertex2sheet3_[tetVertexId] == -1) {
-              vertexQueue.push(tetVertexId);
-            }
+        std::array<SimplexId, 4> tetVertices{};
+        int localId = 0;
+        for(int j = 0; j < 4; j++) {
+          triangulation.getCellVertex(tetId, j, tetVertices[j]);
+          if(tetVertices[j] == localVertexId) {
+            localId = j;
           }
-        } else {
-          // fiber surface in there
-          for(int j = 0; j < 4; j++) {
-            SimplexId otherVertexId = -1;
-            triangulation.getCellVertex(tetId, j, otherVertexId);
-            if((otherVertexId != localVertexId)
-               && (originalData_.vertex2sheet3_[otherVertexId] == -1)) {
-              // we need to see if the edge <localVertexId, otherVertexId> is
-              // cut by a fiber surface triangle or not.
-
-              bool isCut = false;
-              for(size_t k = 0; k < tetTriangles[tetId].size(); k++) {
-                SimplexId l = 0, m = 0, n = 0;
-                l = tetTriangles[tetId][k][0];
-                m = tetTriangles[tetId][k][1];
-                n = tetTriangles[tetId][k][2];
-
-                for(int p = 0; p < 3; p++) {
-                  std::pair<SimplexId, SimplexId> meshEdge;
-
-                  if(fiberSurfaceVertexList_.size()) {
-                    // the fiber surfaces have been merged
-                    meshEdge
-                      = fiberSurfaceVertexList_[originalData_.sheet2List_[l]
-                                                  .triangleList_[m][n]
-                                                  .vertexIds_[p]]
-                          .meshEdge_;
-                  } else {
-                    // the fiber surfaces have not been merged
-                    meshEdge = originalData_.sheet2List_[l]
-                                 .vertexList_[m][originalData_.sheet2List_[l]
-                                                   .triangleList_[m][n]
-                                                   .vertexIds_[p]]
-                                 .meshEdge_;
-                  }
-
-                  if(((meshEdge.first == localVertexId)
-                      && (meshEdge.second == otherVertexId))
-                     || ((meshEdge.second == localVertexId)
-                         && (meshEdge.first == otherVertexId))) {
-                    isCut = true;
-                    break;
-                  }
-                }
-
-                if(isCut)
-                  break;
-              }
+        }
 
-              if(!isCut) {
-                // add the vertex to the queue
-                vertexQueue.push(otherVertexId);
-              }
-            }
+        for(int j = 0; j < 4; j++) {
+          // an edge that is not cut by a fiber surface links two vertices
+          // of the same 3-sheet (other 3-sheets are traversed concurrently)
+          if((j != localId)
+             && (!(tetCutEdges[tetId] & tetEdgeBit(localId, j)))
+             && (originalData_.vertex2sheet3_[tetVertices[j]] == -1)) {
+            vertexQueue.push(tetVertices[j]);
           }
         }
       }
@@ -1356,12 +1380,60 @@ int ttk::ReebSpace::compute3sheets(
     }
   }
 
+  // 1) identify the 3-sheets in parallel: two vertices (not on the
+  // Jacobi set) are in the same 3-sheet if they share an edge that is not
+  // cut by a fiber surface. The cut edges of each tet are stored for the
+  // traversal of the 3-sheets.
+  std::vector<uint8_t> tetCutEdges(tetNumber_, 0);
+  AtomicUnionFind sheetUF(vertexNumber_, threadNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic, 512)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId i = 0; i < tetNumber_; i++) {
+    std::array<SimplexId, 4> tetVertices{};
+    for(int j = 0; j < 4; j++) {
+      triangulation.getCellVertex(i, j, tetVertices[j]);
+    }
+    for(int j = 0; j < 4; j++) {
+      for(int k = j + 1; k < 4; k++) {
+        if((!tetTriangles[i].empty())
+           && (isCut(i, tetVertices[j], tetVertices[k], tetTriangles))) {
+          tetCutEdges[i] |= tetEdgeBit(j, k);
+        } else if((originalData_.vertex2sheet3_[tetVertices[j]] == -1)
+                  && (originalData_.vertex2sheet3_[tetVertices[k]] == -1)) {
+          sheetUF.makeUnion(tetVertices[j], tetVertices[k]);
+        }
+      }
+    }
+  }
+  sheetUF.compress(threadNumber_);
+
+  // 3-sheets are numbered by increasing smallest vertex (the union-find
+  // representative), as with a sequential traversal of the vertices
+  std::vector<SimplexId> sheetSeeds;
   for(SimplexId i = 0; i < vertexNumber_; i++) {
-    if(originalData_.vertex2sheet3_[i] == -1) {
-      compute3sheet(i, tetTriangles, triangulation);
+    if((originalData_.vertex2sheet3_[i] == -1) && (sheetUF.getRoot(i) == i)) {
+      sheetSeeds.emplace_back(i);
     }
   }
 
+  originalData_.sheet3List_.resize(sheetSeeds.size());
+  for(size_t i = 0; i < sheetSeeds.size(); i++) {
+    originalData_.sheet3List_[i].pruned_ = false;
+    originalData_.sheet3List_[i].preMerger_ = -1;
+    originalData_.sheet3List_[i].Id_ = i;
+  }
+
+  // 2) traverse the 3-sheets in parallel from their seeds (the vertex
+  // lists are in traversal order)
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < sheetSeeds.size(); i++) {
+    compute3sheet(sheetSeeds[i], i, tetCutEdges, triangulation);
+  }
+
   // for 3-sheet expansion
   std::vector<std::vector<std::pair<SimplexId, bool>>> neighborList(
     originalData_.sheet3List_.size());
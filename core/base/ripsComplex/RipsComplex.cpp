@@ -1,5 +1,7 @@
 #include <RipsComplex.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 ttk::RipsComplex::RipsComplex() {
@@ -12,6 +14,42 @@ struct LocCell {
   std::array<ttk::SimplexId, n> verts;
 };
 
+/**
+ * @brief Concatenate the cells found around every point (their first
+ * vertex) into the VTK connectivity array
+ */
+template <size_t n>
+static void fillCells(std::vector<ttk::SimplexId> &connectivity,
+                      std::vector<double> &diameters,
+                      const std::vector<std::vector<LocCell<n>>> &cells,
+                      const int nThreads) {
+
+  TTK_FORCE_USE(nThreads);
+
+  std::vector<size_t> psum(cells.size() + 1);
+  for(size_t i = 0; i < cells.size(); ++i) {
+    psum[i + 1] = psum[i] + cells[i].size();
+  }
+
+  const auto nCells{psum.back()};
+  diameters.resize(nCells);
+  connectivity.resize((n + 1) * nCells);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads) schedule(dynamic)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < cells.size(); ++i) {
+    for(size_t j = 0; j < cells[i].size(); ++j) {
+      const auto c{psum[i] + j};
+      connectivity[(n + 1) * c] = static_cast<ttk::SimplexId>(i);
+      for(size_t k = 0; k < n; ++k) {
+        connectivity[(n + 1) * c + k + 1] = cells[i][j].verts[k];
+      }
+      diameters[c] = cells[i][j].diam;
+    }
+  }
+}
+
 static void computeEdges(std::vector<ttk::SimplexId> &connectivity,
                          std::vector<double> &diameters,
                          const double epsilon,
@@ -35,25 +73,7 @@ static void computeEdges(std::vector<ttk::SimplexId> &connectivity,
     }
   }
 
-  std::vector<size_t> psum(edges.size() + 1);
-  for(size_t i = 0; i < edges.size(); ++i) {
-    psum[i + 1] = psum[i] + edges[i].size();
-  }
-
-  const auto nCells{psum.back()};
-  diameters.resize(nCells);
-  connectivity.resize(2 * nCells);
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(nThreads) schedule(dynamic)
-#endif // TTK_ENABLE_OPENMP
-  for(size_t i = 0; i < edges.size(); ++i) {
-    for(size_t j = 0; j < edges[i].size(); ++j) {
-      connectivity[2 * (psum[i] + j) + 0] = static_cast<ttk::SimplexId>(i);
-      connectivity[2 * (psum[i] + j) + 1] = edges[i][j].verts[0];
-      diameters[psum[i] + j] = edges[i][j].diam;
-    }
-  }
+  fillCells(connectivity, diameters, edges, nThreads);
 }
 
 static inline void maxAssign(double &a, const double b) {
@@ -97,26 +117,7 @@ static void
     }
   }
 
-  std::vector<size_t> psum(triangles.size() + 1);
-  for(size_t i = 0; i < triangles.size(); ++i) {
-    psum[i + 1] = psum[i] + triangles[i].size();
-  }
-
-  const auto nCells{psum.back()};
-  diameters.resize(nCells);
-  connectivity.resize(3 * nCells);
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(nThreads) schedule(dynamic)
-#endif // TTK_ENABLE_OPENMP
-  for(size_t i = 0; i < triangles.size(); ++i) {
-    for(size_t j = 0; j < triangles[i].size(); ++j) {
-      connectivity[3 * (psum[i] + j) + 0] = static_cast<ttk::SimplexId>(i);
-      connectivity[3 * (psum[i] + j) + 1] = triangles[i][j].verts[0];
-      connectivity[3 * (psum[i] + j) + 2] = triangles[i][j].verts[1];
-      diameters[psum[i] + j] = triangles[i][j].diam;
-    }
-  }
+  fillCells(connectivity, diameters, triangles, nThreads);
 }
 
 static void
@@ -164,27 +165,303 @@ static void
     }
   }
 
-  std::vector<size_t> psum(tetras.size() + 1);
-  for(size_t i = 0; i < tetras.size(); ++i) {
-    psum[i + 1] = psum[i] + tetras[i].size();
+  fillCells(connectivity, diameters, tetras, nThreads);
+}
+
+namespace {
+
+  /**
+   * @brief Point cloud neighbour, sorted by increasing id
+   */
+  struct Neighbour {
+    ttk::SimplexId id;
+    double dist;
+  };
+
+  /**
+   * @brief Implicit KD-tree on a point cloud of any dimension
+   *
+   * The points are permuted so that every range [begin, end) of the
+   * permutation is split at its median point along the axis of
+   * largest extent. No node is stored, only the split axis at the
+   * median of each range.
+   */
+  class PointCloudKDTree {
+  public:
+    PointCloudKDTree(const double *const coordinates,
+                     const size_t nPoints,
+                     const int dimension)
+      : coords_{coordinates}, dim_{static_cast<size_t>(dimension)},
+        perm_(nPoints), axes_(nPoints) {
+      for(size_t i = 0; i < nPoints; ++i) {
+        perm_[i] = i;
+      }
+      this->build(0, nPoints);
+    }
+
+    /**
+     * @brief Find the points of id greater than @p i at distance
+     * lower or equal than @p epsilon, sorted by increasing id
+     */
+    void
+      getUpperNeighbours(const size_t i,
+                         const double epsilon,
+                         std::vector<Neighbour> &neighbours,
+                         std::vector<std::pair<size_t, size_t>> &stack) const {
+      const auto p{this->point(i)};
+      const auto eps2{epsilon * epsilon};
+      const auto visit = [&](const size_t j) {
+        if(j <= i) {
+          return;
+        }
+        const auto q{this->point(j)};
+        double d2{};
+        for(size_t k = 0; k < this->dim_; ++k) {
+          d2 += (p[k] - q[k]) * (p[k] - q[k]);
+        }
+        if(d2 <= eps2) {
+          neighbours.emplace_back(
+            Neighbour{static_cast<ttk::SimplexId>(j), std::sqrt(d2)});
+        }
+      };
+
+      neighbours.clear();
+      stack.clear();
+      stack.emplace_back(0, this->perm_.size());
+      while(!stack.empty()) {
+        const auto range{stack.back()};
+        stack.pop_back();
+        if(range.second - range.first <= leafSize_) {
+          for(size_t j = range.first; j < range.second; ++j) {
+            visit(this->perm_[j]);
+          }
+          continue;
+        }
+        const auto mid{(range.first + range.second) / 2};
+        const auto axis{this->axes_[mid]};
+        const auto split{this->point(this->perm_[mid])[axis]};
+        visit(this->perm_[mid]);
+        if(p[axis] - epsilon <= split) {
+          stack.emplace_back(range.first, mid);
+        }
+        if(p[axis] + epsilon >= split) {
+          stack.emplace_back(mid + 1, range.second);
+        }
+      }
+
+      std::sort(neighbours.begin(), neighbours.end(),
+                [](const Neighbour &a, const Neighbour &b) {
+                  return a.id < b.id;
+                });
+    }
+
+  private:
+    inline const double *point(const size_t i) const {
+      return &this->coords_[i * this->dim_];
+    }
+
+    void build(const size_t begin, const size_t end) {
+      if(end - begin <= leafSize_) {
+        return;
+      }
+
+      // split along the axis of largest extent
+      size_t axis{};
+      double maxExtent{-1.0};
+      for(size_t k = 0; k < this->dim_; ++k) {
+        auto lo{std::numeric_limits<double>::max()};
+        auto hi{std::numeric_limits<double>::lowest()};
+        for(size_t j = begin; j < end; ++j) {
+          const auto c{this->point(this->perm_[j])[k]};
+          lo = std::min(lo, c);
+          hi = std::max(hi, c);
+        }
+        if(hi - lo > maxExtent) {
+          maxExtent = hi - lo;
+          axis = k;
+        }
+      }
+
+      const auto mid{(begin + end) / 2};
+      this->axes_[mid] = axis;
+      std::nth_element(this->perm_.begin() + begin, this->perm_.begin() + mid,
+                       this->perm_.begin() + end,
+                       [this, axis](const size_t a, const size_t b) {
+                         return this->point(a)[axis] < this->point(b)[axis];
+                       });
+      this->build(begin, mid);
+      this->build(mid + 1, end);
+    }
+
+    static constexpr size_t leafSize_{16};
+
+    const double *const coords_;
+    const size_t dim_;
+    std::vector<size_t> perm_;
+    std::vector<size_t> axes_;
+  };
+
+} // namespace
+
+/**
+ * @brief Compute the epsilon-neighbourhoods of every point, keeping
+ * only the neighbours of greater id
+ */
+static void computeNeighbourhoods(
+  std::vector<std::vector<Neighbour>> &neighbourhoods,
+  const double epsilon,
+  const double *const coordinates,
+  const size_t nPoints,
+  const int dimension,
+  const int nThreads) {
+
+  TTK_FORCE_USE(nThreads);
+
+  const PointCloudKDTree kdTree{coordinates, nPoints, dimension};
+  neighbourhoods.resize(nPoints);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+  {
+    std::vector<Neighbour> neighbours{};
+    std::vector<std::pair<size_t, size_t>> stack{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < nPoints; ++i) {
+      kdTree.getUpperNeighbours(i, epsilon, neighbours, stack);
+      neighbourhoods[i].assign(neighbours.begin(), neighbours.end());
+    }
   }
+}
 
-  const auto nCells{psum.back()};
-  diameters.resize(nCells);
-  connectivity.resize(4 * nCells);
+/**
+ * @brief Intersect two neighbourhoods sorted by id, keeping the
+ * largest distance of the common neighbours
+ */
+static void intersect(std::vector<Neighbour> &common,
+                      std::vector<Neighbour>::const_iterator first1,
+                      const std::vector<Neighbour>::const_iterator last1,
+                      std::vector<Neighbour>::const_iterator first2,
+                      const std::vector<Neighbour>::const_iterator last2) {
+  common.clear();
+  while(first1 != last1 && first2 != last2) {
+    if(first1->id < first2->id) {
+      ++first1;
+    } else if(first2->id < first1->id) {
+      ++first2;
+    } else {
+      common.emplace_back(
+        Neighbour{first1->id, std::max(first1->dist, first2->dist)});
+      ++first1;
+      ++first2;
+    }
+  }
+}
+
+static void computeSparseEdges(
+  std::vector<ttk::SimplexId> &connectivity,
+  std::vector<double> &diameters,
+  const double epsilon,
+  const std::vector<std::vector<Neighbour>> &neighbourhoods,
+  const int nThreads) {
+
+  TTK_FORCE_USE(nThreads);
+
+  std::vector<std::vector<LocCell<1>>> edges(neighbourhoods.size());
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(nThreads) schedule(dynamic)
 #endif // TTK_ENABLE_OPENMP
-  for(size_t i = 0; i < tetras.size(); ++i) {
-    for(size_t j = 0; j < tetras[i].size(); ++j) {
-      connectivity[4 * (psum[i] + j) + 0] = static_cast<ttk::SimplexId>(i);
-      connectivity[4 * (psum[i] + j) + 1] = tetras[i][j].verts[0];
-      connectivity[4 * (psum[i] + j) + 2] = tetras[i][j].verts[1];
-      connectivity[4 * (psum[i] + j) + 3] = tetras[i][j].verts[2];
-      diameters[psum[i] + j] = tetras[i][j].diam;
+  for(size_t i = 0; i < neighbourhoods.size(); ++i) {
+    for(const auto &nj : neighbourhoods[i]) {
+      if(nj.dist < epsilon) {
+        edges[i].emplace_back(
+          LocCell<1>{nj.dist, std::array<ttk::SimplexId, 1>{nj.id}});
+      }
+    }
+  }
+
+  fillCells(connectivity, diameters, edges, nThreads);
+}
+
+static void computeSparseTriangles(
+  std::vector<ttk::SimplexId> &connectivity,
+  std::vector<double> &diameters,
+  const std::vector<std::vector<Neighbour>> &neighbourhoods,
+  const int nThreads) {
+
+  TTK_FORCE_USE(nThreads);
+
+  std::vector<std::vector<LocCell<2>>> triangles(neighbourhoods.size());
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+  {
+    std::vector<Neighbour> commonJ{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < neighbourhoods.size(); ++i) {
+      const auto &ni{neighbourhoods[i]};
+      for(auto j = ni.begin(); j != ni.end(); ++j) {
+        const auto &nj{neighbourhoods[j->id]};
+        // vertices k > j adjacent to both i and j
+        intersect(commonJ, j + 1, ni.end(), nj.begin(), nj.end());
+        for(const auto &k : commonJ) {
+          triangles[i].emplace_back(LocCell<2>{
+            std::max(j->dist, k.dist),
+            std::array<ttk::SimplexId, 2>{j->id, k.id},
+          });
+        }
+      }
     }
   }
+
+  fillCells(connectivity, diameters, triangles, nThreads);
+}
+
+static void computeSparseTetras(
+  std::vector<ttk::SimplexId> &connectivity,
+  std::vector<double> &diameters,
+  const std::vector<std::vector<Neighbour>> &neighbourhoods,
+  const int nThreads) {
+
+  TTK_FORCE_USE(nThreads);
+
+  std::vector<std::vector<LocCell<3>>> tetras(neighbourhoods.size());
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+  {
+    std::vector<Neighbour> commonJ{}, commonK{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < neighbourhoods.size(); ++i) {
+      const auto &ni{neighbourhoods[i]};
+      for(auto j = ni.begin(); j != ni.end(); ++j) {
+        const auto &nj{neighbourhoods[j->id]};
+        intersect(commonJ, j + 1, ni.end(), nj.begin(), nj.end());
+        for(auto k = commonJ.cbegin(); k != commonJ.cend(); ++k) {
+          const auto &nk{neighbourhoods[k->id]};
+          // vertices l > k adjacent to i, j and k
+          intersect(commonK, k + 1, commonJ.cend(), nk.begin(), nk.end());
+          for(const auto &l : commonK) {
+            tetras[i].emplace_back(LocCell<3>{
+              std::max({j->dist, k->dist, l.dist}),
+              std::array<ttk::SimplexId, 3>{j->id, k->id, l.id},
+            });
+          }
+        }
+      }
+    }
+  }
+
+  fillCells(connectivity, diameters, tetras, nThreads);
 }
 
 int ttk::RipsComplex::computeGaussianDensity(
@@ -210,6 +487,33 @@ int ttk::RipsComplex::computeGaussianDensity(
   return 0;
 }
 
+int ttk::RipsComplex::computeGaussianDensity(double *const density,
+                                             const double *const coordinates,
+                                             const SimplexId nPoints,
+                                             const int dimension) const {
+
+  const auto sq = [](const double a) -> double { return a * a; };
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId i = 0; i < nPoints; ++i) {
+    const auto p{&coordinates[i * dimension]};
+    // same as the distance matrix version, i == j counted twice
+    density[i] = 1.0;
+    for(SimplexId j = 0; j < nPoints; ++j) {
+      const auto q{&coordinates[j * dimension]};
+      double d2{};
+      for(int k = 0; k < dimension; ++k) {
+        d2 += sq(p[k] - q[k]);
+      }
+      density[i] += std::exp(-d2 / (2.0 * sq(this->StdDev)));
+    }
+  }
+
+  return 0;
+}
+
 int ttk::RipsComplex::computeDiameterStats(
   const SimplexId nPoints,
   std::array<double *const, 3> diamStats,
@@ -301,3 +605,55 @@ int ttk::RipsComplex::execute(
   this->printMsg("Complete", 1.0, tm.getElapsedTime(), this->threadNumber_);
   return 0;
 }
+
+int ttk::RipsComplex::execute(std::vector<SimplexId> &connectivity,
+                              std::vector<double> &diameters,
+                              std::array<double *const, 3> diamStats,
+                              const double *const coordinates,
+                              const SimplexId nPoints,
+                              const int dimension,
+                              double *const density) const {
+
+  Timer tm{};
+
+  if(coordinates == nullptr || nPoints <= 0 || dimension <= 0) {
+    this->printErr("Invalid point cloud");
+    return 1;
+  }
+
+  Timer tm_nbh{};
+
+  std::vector<std::vector<Neighbour>> neighbourhoods{};
+  computeNeighbourhoods(neighbourhoods, this->Epsilon, coordinates, nPoints,
+                        dimension, this->threadNumber_);
+
+  this->printMsg("Computed epsilon-neighbourhoods", 1.0,
+                 tm_nbh.getElapsedTime(), this->threadNumber_,
+                 debug::LineMode::NEW, debug::Priority::DETAIL);
+
+  Timer tm_rips{};
+
+  if(this->OutputDimension == 1) {
+    computeSparseEdges(connectivity, diameters, this->Epsilon, neighbourhoods,
+                       this->threadNumber_);
+  } else if(this->OutputDimension == 2) {
+    computeSparseTriangles(
+      connectivity, diameters, neighbourhoods, this->threadNumber_);
+  } else if(this->OutputDimension == 3) {
+    computeSparseTetras(
+      connectivity, diameters, neighbourhoods, this->threadNumber_);
+  }
+
+  this->printMsg("Generated Rips complex from point cloud", 1.0,
+                 tm_rips.getElapsedTime(), this->threadNumber_,
+                 debug::LineMode::NEW, debug::Priority::DETAIL);
+
+  this->computeDiameterStats(nPoints, diamStats, connectivity, diameters);
+
+  if(this->ComputeGaussianDensity) {
+    this->computeGaussianDensity(density, coordinates, nPoints, dimension);
+  }
+
+  this->printMsg("Complete", 1.0, tm.getElapsedTime(), this->threadNumber_);
+  return 0;
+}
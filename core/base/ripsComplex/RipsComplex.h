@@ -28,6 +28,7 @@
 #include <Debug.h>
 
 #include <array>
+#include <vector>
 
 namespace ttk {
 
@@ -50,6 +51,33 @@ namespace ttk {
                 const std::vector<std::vector<double>> &distanceMatrix,
                 double *const density = nullptr) const;
 
+    /**
+     * @brief Main entry point for point clouds
+     *
+     * Generates the same complex as from the matrix of the Euclidean
+     * distances between the points, without storing it. The
+     * epsilon-neighbourhoods of the points are found with a KD-tree
+     * and the cells are enumerated from their intersections, so that
+     * the complexity depends on the output size instead of the cube
+     * (or fourth power) of the number of points.
+     *
+     * @param[out] connectivity Cell connectivity array (VTK format)
+     * @param[out] diameters Cell diameters
+     * @param[out] diamStats Min, mean and max cell diameters around point
+     * @param[in] coordinates Point coordinates (row-major, @p nPoints
+     * rows of @p dimension components)
+     * @param[in] nPoints Number of input points
+     * @param[in] dimension Number of coordinates per point
+     * @param[out] density Gaussian density array on points
+     */
+    int execute(std::vector<SimplexId> &connectivity,
+                std::vector<double> &diameters,
+                std::array<double *const, 3> diamStats,
+                const double *const coordinates,
+                const SimplexId nPoints,
+                const int dimension,
+                double *const density = nullptr) const;
+
   protected:
     /**
      * @brief Compute diameter statistics on points
@@ -74,6 +102,19 @@ namespace ttk {
       double *const density,
       const std::vector<std::vector<double>> &distanceMatrix) const;
 
+    /**
+     * @brief Compute Gaussian density on points
+     *
+     * @param[out] density Gaussian density array on points
+     * @param[in] coordinates Point coordinates
+     * @param[in] nPoints Number of input points
+     * @param[in] dimension Number of coordinates per point
+     */
+    int computeGaussianDensity(double *const density,
+                               const double *const coordinates,
+                               const SimplexId nPoints,
+                               const int dimension) const;
+
     /** Dimension of the generated complex */
     int OutputDimension{2};
     /** Distance threshold */
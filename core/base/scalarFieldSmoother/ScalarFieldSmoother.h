@@ -130,48 +130,91 @@ int ttk::ScalarFieldSmoother::smooth(const triangulationType *triangulation,
   if(numberOfIterations < timeBuckets)
     timeBuckets = numberOfIterations;
 
-  for(int it = 0; it < numberOfIterations; it++) {
+  // smooth the vertices of vertexIds (or the first vertexNumber vertices)
+  const auto smoothVertices
+    = [&](const SimplexId *const vertexIds, const SimplexId nVertices) {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-    for(SimplexId i = 0; i < vertexNumber; i++) {
-
-      // avoid to process masked vertices
-      if(mask_ != nullptr && mask_[i] == 0)
-        continue;
-
-      for(int j = 0; j < dimensionNumber_; j++) {
-        const auto curr{dimensionNumber_ * i + j};
-        tmpData[curr] = outputData[curr];
+        for(SimplexId k = 0; k < nVertices; k++) {
+          const SimplexId i = vertexIds != nullptr ? vertexIds[k] : k;
+
+          // avoid to process masked vertices
+          if(mask_ != nullptr && mask_[i] == 0) {
+            for(int j = 0; j < dimensionNumber_; j++) {
+              tmpData[dimensionNumber_ * i + j]
+                = outputData[dimensionNumber_ * i + j];
+            }
+            continue;
+          }
 
-        const auto neighborNumber = triangulation->getVertexNeighborNumber(i);
-        for(SimplexId k = 0; k < neighborNumber; k++) {
-          SimplexId neighborId = -1;
-          triangulation->getVertexNeighbor(i, k, neighborId);
-          tmpData[curr] += outputData[dimensionNumber_ * (neighborId) + j];
+          for(int j = 0; j < dimensionNumber_; j++) {
+            const auto curr{dimensionNumber_ * i + j};
+            tmpData[curr] = outputData[curr];
+
+            const auto neighborNumber
+              = triangulation->getVertexNeighborNumber(i);
+            for(SimplexId l = 0; l < neighborNumber; l++) {
+              SimplexId neighborId = -1;
+              triangulation->getVertexNeighbor(i, l, neighborId);
+              tmpData[curr] += outputData[dimensionNumber_ * (neighborId) + j];
+            }
+            tmpData[curr] /= static_cast<double>(neighborNumber + 1);
+          }
         }
-        tmpData[curr] /= static_cast<double>(neighborNumber + 1);
+      };
+
+#ifdef TTK_ENABLE_MPI
+  // the vertices sent to the neighbor ranks are smoothed first, their
+  // values are then exchanged while the other vertices are smoothed
+  std::vector<SimplexId> boundaryVertices{}, interiorVertices{};
+  GhostExchange<dataType> *ghostExchange{};
+  if(ttk::isRunningWithMPI()) {
+    // the exchange (and its persistent requests) is kept by the
+    // triangulation for the next calls
+    ghostExchange = getGhostVerticesExchange<dataType>(
+      triangulation, ttk::MPIcomm_, dimensionNumber_);
+    if(ghostExchange == nullptr) {
+      this->printErr("The ghost vertices are not preconditioned");
+      return -1;
+    }
+    std::vector<bool> isBoundary(vertexNumber, false);
+    for(const auto &ids : ghostExchange->getPlan().sendIds) {
+      for(const auto id : ids) {
+        isBoundary[id] = true;
       }
     }
-
-    if(numberOfIterations) {
-      // assign the tmpData back to the output
-      for(SimplexId i = 0; i < vertexNumber; i++) {
-        for(int j = 0; j < dimensionNumber_; j++) {
-          // only set value for unmasked points
-          if(mask_ == nullptr || mask_[i] != 0) {
-            outputData[dimensionNumber_ * i + j]
-              = tmpData[dimensionNumber_ * i + j];
-          }
-        }
+    for(SimplexId i = 0; i < vertexNumber; i++) {
+      if(isBoundary[i]) {
+        boundaryVertices.emplace_back(i);
+      } else {
+        interiorVertices.emplace_back(i);
       }
     }
+  }
+#endif // TTK_ENABLE_MPI
+
+  for(int it = 0; it < numberOfIterations; it++) {
+#ifdef TTK_ENABLE_MPI
+    if(ttk::isRunningWithMPI()) {
+      smoothVertices(boundaryVertices.data(), boundaryVertices.size());
+      ghostExchange->start(tmpData.data());
+      smoothVertices(interiorVertices.data(), interiorVertices.size());
+    } else {
+      smoothVertices(nullptr, vertexNumber);
+    }
+#else
+    smoothVertices(nullptr, vertexNumber);
+#endif // TTK_ENABLE_MPI
+
+    // assign the tmpData back to the output (masked vertices are unchanged)
+    std::copy(tmpData.begin(), tmpData.end(), outputData);
+
 #ifdef TTK_ENABLE_MPI
     if(ttk::isRunningWithMPI()) {
-      // after each iteration we need to exchange the ghostcell values with our
+      // after each iteration we need to receive the ghost values of our
       // neighbors
-      exchangeGhostVertices<dataType, triangulationType>(
-        outputData, triangulation, ttk::MPIcomm_, dimensionNumber_);
+      ghostExchange->wait(outputData);
     }
 #endif // TTK_ENABLE_MPI
 
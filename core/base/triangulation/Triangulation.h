@@ -1416,6 +1416,10 @@ namespace ttk {
       return abstractTriangulation_->hasPreconditionedDistributedVertices();
     }
 
+    inline GhostExchangeCache &getGhostExchangeCache() const override {
+      return abstractTriangulation_->getGhostExchangeCache();
+    }
+
     inline const std::vector<int> &getNeighborRanks() const override {
       return abstractTriangulation_->getNeighborRanks();
     }
@@ -2416,6 +2420,195 @@ namespace ttk {
       return abstractTriangulation_->getCellVTKID(ttkId, vtkId);
     }
 
+    // Zero-copy adjacency API, see AbstractTriangulation
+
+    inline const FlatJaggedArray *getCellNeighborsCSR() override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return nullptr;
+#endif
+      return abstractTriangulation_->getCellNeighborsCSR();
+    }
+
+    inline SimplexRange
+      getCellNeighborsRange(const SimplexId &cellId) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return {0, nullptr};
+#endif
+      return abstractTriangulation_->getCellNeighborsRange(cellId);
+    }
+
+    inline const FlatJaggedArray *getEdgeLinksCSR() override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return nullptr;
+#endif
+      return abstractTriangulation_->getEdgeLinksCSR();
+    }
+
+    inline SimplexRange
+      getEdgeLinksRange(const SimplexId &edgeId) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return {0, nullptr};
+#endif
+      return abstractTriangulation_->getEdgeLinksRange(edgeId);
+    }
+
+    inline const FlatJaggedArray *getEdgeStarsCSR() override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return nullptr;
+#endif
+      return abstractTriangulation_->getEdgeStarsCSR();
+    }
+
+    inline SimplexRange
+      getEdgeStarsRange(const SimplexId &edgeId) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return {0, nullptr};
+#endif
+      return abstractTriangulation_->getEdgeStarsRange(edgeId);
+    }
+
+    inline const FlatJaggedArray *getEdgeTrianglesCSR() override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return nullptr;
+#endif
+      return abstractTriangulation_->getEdgeTrianglesCSR();
+    }
+
+    inline SimplexRange
+      getEdgeTrianglesRange(const SimplexId &edgeId) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return {0, nullptr};
+#endif
+      return abstractTriangulation_->getEdgeTrianglesRange(edgeId);
+    }
+
+    inline const FlatJaggedArray *getTriangleLinksCSR() override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return nullptr;
+#endif
+      return abstractTriangulation_->getTriangleLinksCSR();
+    }
+
+    inline SimplexRange
+      getTriangleLinksRange(const SimplexId &triangleId) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return {0, nullptr};
+#endif
+      return abstractTriangulation_->getTriangleLinksRange(triangleId);
+    }
+
+    inline const FlatJaggedArray *getTriangleStarsCSR() override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return nullptr;
+#endif
+      return abstractTriangulation_->getTriangleStarsCSR();
+    }
+
+    inline SimplexRange
+      getTriangleStarsRange(const SimplexId &triangleId) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return {0, nullptr};
+#endif
+      return abstractTriangulation_->getTriangleStarsRange(triangleId);
+    }
+
+    inline const FlatJaggedArray *getVertexEdgesCSR() override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return nullptr;
+#endif
+      return abstractTriangulation_->getVertexEdgesCSR();
+    }
+
+    inline SimplexRange
+      getVertexEdgesRange(const SimplexId &vertexId) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return {0, nullptr};
+#endif
+      return abstractTriangulation_->getVertexEdgesRange(vertexId);
+    }
+
+    inline const FlatJaggedArray *getVertexLinksCSR() override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return nullptr;
+#endif
+      return abstractTriangulation_->getVertexLinksCSR();
+    }
+
+    inline SimplexRange
+      getVertexLinksRange(const SimplexId &vertexId) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return {0, nullptr};
+#endif
+      return abstractTriangulation_->getVertexLinksRange(vertexId);
+    }
+
+    inline const FlatJaggedArray *getVertexNeighborsCSR() override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return nullptr;
+#endif
+      return abstractTriangulation_->getVertexNeighborsCSR();
+    }
+
+    inline SimplexRange
+      getVertexNeighborsRange(const SimplexId &vertexId) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return {0, nullptr};
+#endif
+      return abstractTriangulation_->getVertexNeighborsRange(vertexId);
+    }
+
+    inline const FlatJaggedArray *getVertexStarsCSR() override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return nullptr;
+#endif
+      return abstractTriangulation_->getVertexStarsCSR();
+    }
+
+    inline SimplexRange
+      getVertexStarsRange(const SimplexId &vertexId) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return {0, nullptr};
+#endif
+      return abstractTriangulation_->getVertexStarsRange(vertexId);
+    }
+
+    inline const FlatJaggedArray *getVertexTrianglesCSR() override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return nullptr;
+#endif
+      return abstractTriangulation_->getVertexTrianglesCSR();
+    }
+
+    inline SimplexRange
+      getVertexTrianglesRange(const SimplexId &vertexId) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return {0, nullptr};
+#endif
+      return abstractTriangulation_->getVertexTrianglesRange(vertexId);
+    }
+
 #ifdef TTK_ENABLE_MPI
     /// Pre-process the distributed vertex ids.
     ///
@@ -2682,6 +2875,13 @@ namespace ttk {
       return 0;
     }
 
+    // Set the memory budget (in bytes) of the discrete gradient cache
+    inline void setGradientCacheMemoryBudget(const size_t budget) const {
+      if(abstractTriangulation_) {
+        abstractTriangulation_->setGradientCacheMemoryBudget(budget);
+      }
+    }
+
 #ifdef TTK_CELL_ARRAY_NEW
     /// Here the notion of cell refers to the simplicices of maximal
     /// dimension (3D: tetrahedra, 2D: triangles, 1D: edges).
@@ -2900,6 +3100,21 @@ namespace ttk {
         pointNumber, pointSet, indexArray, doublePrecision);
     }
 
+    /// Set up a compact triangulation whose vertex coordinates and cells
+    /// are paged on demand from a cluster file (out-of-core mode).
+    /// \param fileName Path to a file written by
+    /// ttk::CompactTriangulation::writeToFile() or
+    /// ttk::CompactTriangulationPreconditioning::writeClusterFile().
+    /// \return Returns 0 upon success, negative values otherwise.
+    ///
+    /// \sa setCacheSize() to bound the number of clusters in memory.
+    inline int setStellarInputFile(const std::string &fileName) {
+
+      abstractTriangulation_ = &compactTriangulation_;
+      gridDimensions_[0] = gridDimensions_[1] = gridDimensions_[2] = -1;
+      return compactTriangulation_.setInputFile(fileName);
+    }
+
     /// Tune the number of active threads (default: number of logical cores)
     inline int setThreadNumber(const ThreadId threadNumber) override {
       explicitTriangulation_.setThreadNumber(threadNumber);
@@ -0,0 +1,278 @@
+/// \ingroup base
+/// \class ttk::FlatUnionFind
+/// \date October 2026.
+///
+/// \brief Index-based Union Find implementation for connectivity
+/// tracking.
+///
+/// Contrary to ttk::UnionFind, the elements are not objects linked by
+/// pointers but indices in two flat arrays (parent and rank). This
+/// costs one integer and one byte per element, without any dynamic
+/// allocation per element nor virtual inheritance.
+///
+/// ttk::AtomicUnionFind is a lock-free variant that can be used
+/// concurrently from several threads.
+///
+/// \sa ttk::UnionFind
+
+#pragma once
+
+#include <BaseClass.h>
+#include <DataTypes.h>
+
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace ttk {
+
+  class FlatUnionFind {
+
+  public:
+    FlatUnionFind() = default;
+
+    inline explicit FlatUnionFind(const size_t nElements) {
+      this->reset(nElements);
+    }
+
+    /**
+     * @brief Set the number of elements, each one in its own set
+     */
+    inline void reset(const size_t nElements) {
+      this->parent_.resize(nElements);
+      std::iota(this->parent_.begin(), this->parent_.end(), 0);
+      this->rank_.assign(nElements, 0);
+    }
+
+    inline void clear() {
+      this->parent_.clear();
+      this->rank_.clear();
+    }
+
+    inline void reserve(const size_t nElements) {
+      this->parent_.reserve(nElements);
+      this->rank_.reserve(nElements);
+    }
+
+    inline size_t size() const {
+      return this->parent_.size();
+    }
+
+    /**
+     * @brief Append a new singleton set
+     *
+     * @return The index of the new element
+     */
+    inline SimplexId makeSet() {
+      const SimplexId id = this->parent_.size();
+      this->parent_.emplace_back(id);
+      this->rank_.emplace_back(0);
+      return id;
+    }
+
+    /**
+     * @brief Get the representative of the set of an element
+     *
+     * Two-pass iterative path compression (no recursion, no stack
+     * overflow on degenerate trees).
+     */
+    inline SimplexId find(const SimplexId element) {
+      SimplexId root = element;
+      while(this->parent_[root] != root) {
+        root = this->parent_[root];
+      }
+      SimplexId cur = element;
+      while(this->parent_[cur] != root) {
+        const SimplexId next = this->parent_[cur];
+        this->parent_[cur] = root;
+        cur = next;
+      }
+      return root;
+    }
+
+    inline int getRank(const SimplexId element) const {
+      return this->rank_[element];
+    }
+
+    /**
+     * @brief Merge the sets of two elements (union by rank)
+     *
+     * On equal ranks, the representative of @p uf0 becomes the
+     * representative of the merged set.
+     *
+     * @return The representative of the merged set
+     */
+    inline SimplexId makeUnion(SimplexId uf0, SimplexId uf1) {
+      uf0 = this->find(uf0);
+      uf1 = this->find(uf1);
+
+      if(uf0 == uf1) {
+        return uf0;
+      } else if(this->rank_[uf0] > this->rank_[uf1]) {
+        this->parent_[uf1] = uf0;
+        return uf0;
+      } else if(this->rank_[uf0] < this->rank_[uf1]) {
+        this->parent_[uf0] = uf1;
+        return uf1;
+      } else {
+        this->parent_[uf1] = uf0;
+        this->rank_[uf0]++;
+        return uf0;
+      }
+    }
+
+    /**
+     * @brief Merge the sets of a list of elements
+     *
+     * @return The representative of the merged set, -1 if @p sets is
+     * empty
+     */
+    inline SimplexId makeUnion(const std::vector<SimplexId> &sets) {
+      if(sets.empty()) {
+        return -1;
+      }
+
+      SimplexId n = sets[0];
+      for(size_t i = 0; i + 1 < sets.size(); i++) {
+        n = this->makeUnion(sets[i], sets[i + 1]);
+      }
+
+      return n;
+    }
+
+    inline size_t footprint() const {
+      return this->parent_.capacity() * sizeof(SimplexId)
+             + this->rank_.capacity() * sizeof(uint8_t);
+    }
+
+  protected:
+    std::vector<SimplexId> parent_{};
+    // rank is bounded by log2(nElements)
+    std::vector<uint8_t> rank_{};
+  };
+
+  /**
+   * @brief Lock-free index-based Union Find
+   *
+   * Only one integer per element. To be linearizable without locks,
+   * the union is done by index instead of by rank: the root with the
+   * highest index is always attached to the root with the lowest one,
+   * so parent indices are monotonically decreasing along a path and
+   * the representative of a set is its smallest element. Concurrent
+   * calls to find() use lock-free path halving.
+   */
+  class AtomicUnionFind {
+
+  public:
+    AtomicUnionFind() = default;
+
+    inline explicit AtomicUnionFind(const size_t nElements,
+                                    const int threadNumber = 1) {
+      this->reset(nElements, threadNumber);
+    }
+
+    /**
+     * @brief Set the number of elements, each one in its own set
+     *
+     * Not thread-safe.
+     */
+    inline void reset(const size_t nElements, const int threadNumber = 1) {
+      // std::atomic is neither copyable nor movable
+      std::vector<std::atomic<SimplexId>> parent(nElements);
+      this->parent_.swap(parent);
+      TTK_FORCE_USE(threadNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 0; i < nElements; ++i) {
+        this->parent_[i].store(i, std::memory_order_relaxed);
+      }
+    }
+
+    inline size_t size() const {
+      return this->parent_.size();
+    }
+
+    /**
+     * @brief Get the representative of the set of an element
+     *
+     * The representative might be outdated if another thread merges
+     * the set concurrently.
+     */
+    inline SimplexId find(SimplexId element) {
+      while(true) {
+        SimplexId parent
+          = this->parent_[element].load(std::memory_order_relaxed);
+        if(parent == element) {
+          return element;
+        }
+        const SimplexId grandParent
+          = this->parent_[parent].load(std::memory_order_relaxed);
+        if(grandParent != parent) {
+          // path halving: any ancestor is a valid parent
+          this->parent_[element].compare_exchange_weak(
+            parent, grandParent, std::memory_order_relaxed);
+        }
+        element = grandParent;
+      }
+    }
+
+    /**
+     * @brief Merge the sets of two elements
+     *
+     * @return The representative of the merged set at the time of the
+     * union
+     */
+    inline SimplexId makeUnion(SimplexId uf0, SimplexId uf1) {
+      while(true) {
+        uf0 = this->find(uf0);
+        uf1 = this->find(uf1);
+        if(uf0 == uf1) {
+          return uf0;
+        }
+        if(uf0 < uf1) {
+          std::swap(uf0, uf1);
+        }
+        // uf0 > uf1: attach uf0 to uf1 if uf0 is still a root
+        SimplexId expected = uf0;
+        if(this->parent_[uf0].compare_exchange_strong(
+             expected, uf1, std::memory_order_acq_rel)) {
+          return uf1;
+        }
+      }
+    }
+
+    /**
+     * @brief Flatten every path so that parent(i) == find(i)
+     *
+     * To be called once the concurrent unions are done, to get
+     * constant-time queries with getRoot().
+     */
+    inline void compress(const int threadNumber = 1) {
+      TTK_FORCE_USE(threadNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 0; i < this->parent_.size(); ++i) {
+        this->parent_[i].store(this->find(i), std::memory_order_relaxed);
+      }
+    }
+
+    /**
+     * @brief Representative of an element after compress()
+     */
+    inline SimplexId getRoot(const SimplexId element) const {
+      return this->parent_[element].load(std::memory_order_relaxed);
+    }
+
+    inline size_t footprint() const {
+      return this->parent_.capacity() * sizeof(std::atomic<SimplexId>);
+    }
+
+  protected:
+    std::vector<std::atomic<SimplexId>> parent_{};
+  };
+
+} // namespace ttk
@@ -176,24 +176,30 @@ int ttk::WebSocketIO::sendMessage(const Message &msg) const {
 }
 
 int ttk::WebSocketIO::queueMessage(const std::string &msg) {
+  std::lock_guard<std::mutex> lock(this->mutex);
   this->messageQueue.emplace_back(msg);
   return 1;
 }
 int ttk::WebSocketIO::queueMessage(const size_t &sizeInBytes,
                                    const void *data) {
+  std::lock_guard<std::mutex> lock(this->mutex);
   this->messageQueue.emplace_back(sizeInBytes, data);
   return 1;
 }
 int ttk::WebSocketIO::queueMessage(const Message &msg) {
+  std::lock_guard<std::mutex> lock(this->mutex);
   this->messageQueue.emplace_back(msg);
   return 1;
 }
 int ttk::WebSocketIO::clearMessageQueue() {
+  std::lock_guard<std::mutex> lock(this->mutex);
   this->messageQueue = std::list<Message>();
   return 1;
 }
 
 int ttk::WebSocketIO::sendNextQueuedMessage() {
+  std::lock_guard<std::mutex> lock(this->mutex);
+
   const size_t nRemainingMessages = this->messageQueue.size();
   if(nRemainingMessages < 1) {
     this->printWrn("Empty message queue.");
@@ -214,10 +220,19 @@ int ttk::WebSocketIO::sendNextQueuedMessage() {
 
   auto msg = this->messageQueue.front();
   this->messageQueue.pop_front();
-  return this->sendMessage(msg);
+  if(!this->sendMessage(msg))
+    return 0;
+
+  if(msg.binaryPayload == nullptr
+     && msg.stringPayload.compare("ttk_WSIO_EndMessageSequence") == 0)
+    return this->processEvent("on_sequence_sent");
+
+  return 1;
 }
 
 int ttk::WebSocketIO::processMessageQueue() {
+  std::unique_lock<std::mutex> lock(this->mutex);
+
   this->nMessages = this->messageQueue.size() + 2;
   msgTimer.reStart();
   this->printMsg(
@@ -233,6 +248,7 @@ int ttk::WebSocketIO::processMessageQueue() {
   this->messageQueue.emplace_back(
     ttk::WebSocketIO::Message("ttk_WSIO_EndMessageSequence"));
 
+  lock.unlock();
   return this->sendNextQueuedMessage();
 }
 
@@ -249,6 +265,13 @@ int ttk::WebSocketIO::processEvent(const std::string &eventName,
   return 1;
 }
 
+int ttk::WebSocketIO::processBinaryEvent(std::string &payload) {
+  this->printMsg("processBinaryEventBase: " + std::to_string(payload.size())
+                   + " bytes",
+                 ttk::debug::Priority::VERBOSE);
+  return 1;
+}
+
 int ttk::WebSocketIO::on_open(const websocketpp::connection_hdl &hdl) {
   std::lock_guard<std::mutex> lock(this->mutex);
 
@@ -286,6 +309,12 @@ int ttk::WebSocketIO::on_message(
   const websocketpp::connection_hdl &ttkNotUsed(hdl),
   const WSServer::message_ptr &msg) {
 
+  if(msg->get_opcode() == websocketpp::frame::opcode::binary) {
+    // hand over the payload buffer itself
+    this->processBinaryEvent(msg->get_raw_payload());
+    return 1;
+  }
+
   const auto &eventData = msg->get_payload();
   if(eventData.rfind("ttk_WSIO_", 9) != 0)
     this->printMsg("Custom Message Received", 1, 0);
@@ -339,5 +368,8 @@ int ttk::WebSocketIO::processEvent(const std::string &ttkNotUsed(eventName),
                                    const std::string &ttkNotUsed(eventData)) {
   return 0;
 }
+int ttk::WebSocketIO::processBinaryEvent(std::string &ttkNotUsed(payload)) {
+  return 0;
+}
 
 #endif
@@ -19,11 +19,16 @@
 /// connected clients every time the filter is called with a new input. When the
 /// server receives a serialized JSON object form the client, then the filter
 /// will instantiate a vtkDataObject and pass it as the filter output.
+///
+/// Binary websocket frames received from the client are fed into the
+/// processBinaryEvent function, which receives the payload buffer itself so
+/// that it can be adopted without copy.
 
 #pragma once
 
 #include <Debug.h>
 #include <list>
+#include <mutex>
 #include <set>
 
 #include <iostream>
@@ -75,6 +80,9 @@ namespace ttk {
     int virtual processEvent(const std::string &eventName,
                              const std::string &eventData = "");
 
+    // payload of a binary message, can be moved from to avoid a copy
+    int virtual processBinaryEvent(std::string &payload);
+
     int startServer(int PortNumber);
     int stopServer();
 
@@ -91,6 +99,13 @@ namespace ttk {
     int processMessageQueue();
     int clearMessageQueue();
 
+  protected:
+    // guards the connections and the message queue, which are shared with the
+    // server thread. The "on_open" and "on_sequence_sent" events (the latter
+    // once the last message of a sequence is sent) are processed with the
+    // mutex locked.
+    std::mutex mutex;
+
   private:
 #ifdef TTK_ENABLE_WEBSOCKETPP
     mutable WSServer server;
@@ -100,7 +115,6 @@ namespace ttk {
 
     std::thread serverThread{};
     con_list connections;
-    std::mutex mutex;
     websocketpp::lib::error_code ec;
 
     // keep the state of the object sending process
@@ -63,8 +63,14 @@ ttk::Triangulation *ttkAlgorithm::GetTriangulation(vtkDataSet *dataSet) {
   }
 #endif // TTK_ENABLE_MPI
 
-  if(triangulation)
+  if(triangulation) {
+    // the triangulation (and its cache) is shared by the filters: only the
+    // filters that explicitly set a budget change it
+    if(this->GradientCacheMemoryBudget > 0)
+      triangulation->setGradientCacheMemoryBudget(
+        static_cast<size_t>(this->GradientCacheMemoryBudget) * 1024 * 1024);
     return triangulation;
+  }
 
   this->printErr("Unable to retrieve/initialize triangulation for '"
                  + std::string(dataSet->GetClassName()) + "'");
@@ -190,13 +196,39 @@ vtkDataArray *ttkAlgorithm::GetOrderArray(vtkDataSet *const inputData,
         this->MPIPipelinePreconditioning(inputData, neighbors, nullptr);
       }
 #endif
-      switch(scalarArray->GetDataType()) {
-        vtkTemplateMacro(ttk::preconditionOrderArray(
-          nVertices,
-          static_cast<VTK_TT *>(ttkUtils::GetVoidPointer(scalarArray)),
-          static_cast<ttk::SimplexId *>(
-            ttkUtils::GetVoidPointer(newOrderArray)),
-          this->threadNumber_));
+      // start from the order of the previous time step if any
+      const auto prevOrder
+        = this->PreviousOrderArrays.find(scalarArray->GetName());
+      const bool isIncremental
+        = this->IncrementalOrderArray
+          && prevOrder != this->PreviousOrderArrays.end()
+          && prevOrder->second->GetNumberOfTuples() == nVertices;
+      if(isIncremental) {
+        std::copy_n(static_cast<ttk::SimplexId *>(
+                      ttkUtils::GetVoidPointer(prevOrder->second)),
+                    nVertices,
+                    static_cast<ttk::SimplexId *>(
+                      ttkUtils::GetVoidPointer(newOrderArray)));
+        switch(scalarArray->GetDataType()) {
+          vtkTemplateMacro(ttk::updateOrderArray(
+            nVertices,
+            static_cast<VTK_TT *>(ttkUtils::GetVoidPointer(scalarArray)),
+            static_cast<ttk::SimplexId *>(
+              ttkUtils::GetVoidPointer(newOrderArray)),
+            this->threadNumber_));
+        }
+      } else {
+        switch(scalarArray->GetDataType()) {
+          vtkTemplateMacro(ttk::preconditionOrderArray(
+            nVertices,
+            static_cast<VTK_TT *>(ttkUtils::GetVoidPointer(scalarArray)),
+            static_cast<ttk::SimplexId *>(
+              ttkUtils::GetVoidPointer(newOrderArray)),
+            this->threadNumber_));
+        }
+      }
+      if(this->IncrementalOrderArray) {
+        this->PreviousOrderArrays[scalarArray->GetName()] = newOrderArray;
       }
 
       // append order array temporarily to input
@@ -873,7 +905,10 @@ int ttkAlgorithm::ProcessRequest(vtkInformation *request,
       };
     }
 #endif // TTK_ENABLE_MPI
-    return this->RequestData(request, inputVector, outputVector);
+    const auto status = this->RequestData(request, inputVector, outputVector);
+    // store the new preconditioning results in the on-disk cache
+    ttkTriangulationFactory::UpdateCache();
+    return status;
   }
 
   this->printErr("Unsupported pipeline pass:");
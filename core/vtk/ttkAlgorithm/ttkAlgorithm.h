@@ -19,6 +19,8 @@
 
 // VTK Includes
 #include <vtkAlgorithm.h>
+#include <vtkSmartPointer.h>
+class vtkDataArray;
 class vtkDataSet;
 class vtkInformation;
 class vtkInformationIntegerKey;
@@ -26,6 +28,9 @@ class vtkInformationIntegerKey;
 // Base Includes
 #include <Debug.h>
 
+#include <map>
+#include <string>
+
 namespace ttk {
   class Triangulation;
 }
@@ -85,6 +90,30 @@ public:
     this->Modified();
   }
 
+  /**
+   * Set the maximum memory footprint (in megabytes) of the discrete
+   * gradients cached on the triangulations requested by this filter (0:
+   * keep the budget of the triangulation, unlimited by default).
+   */
+  void SetGradientCacheMemoryBudget(int budget) {
+    this->GradientCacheMemoryBudget = budget;
+    this->Modified();
+  }
+
+  /**
+   * Controls if the order arrays generated by GetOrderArray() are
+   * updated from the previous execution instead of being recomputed
+   * from scratch (time-varying scalar fields). The previous order
+   * arrays are kept in memory.
+   */
+  void SetIncrementalOrderArray(bool incrementalOrderArray) {
+    this->IncrementalOrderArray = incrementalOrderArray;
+    if(!incrementalOrderArray) {
+      this->PreviousOrderArrays.clear();
+    }
+    this->Modified();
+  }
+
   /// This method retrieves an optional array to process.
   /// The logic of this method is as follows:
   ///   - if \p enforceArrayIndex is set to true, this method will try to
@@ -235,6 +264,10 @@ protected:
   ttkAlgorithm();
   ~ttkAlgorithm() override;
   float CompactTriangulationCacheSize{0.2f};
+  int GradientCacheMemoryBudget{0};
+  bool IncrementalOrderArray{false};
+  // last order array generated for each scalar array name
+  std::map<std::string, vtkSmartPointer<vtkDataArray>> PreviousOrderArrays{};
 
 #ifdef TTK_ENABLE_MPI
   /**
@@ -7,12 +7,19 @@
 #include <vtkCellData.h>
 #include <vtkCellTypes.h>
 #include <vtkCommand.h>
+#include <vtkFieldData.h>
 #include <vtkImageData.h>
 #include <vtkPointData.h>
 #include <vtkPolyData.h>
+#include <vtkStringArray.h>
 #include <vtkUnstructuredGrid.h>
 #include <vtkVersion.h>
 
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
 static vtkCellArray *GetCells(vtkDataSet *dataSet) {
   switch(dataSet->GetDataObjectType()) {
     case VTK_UNSTRUCTURED_GRID: {
@@ -65,6 +72,59 @@ static int checkCellTypes(vtkPointSet *object) {
   return 1;
 }
 
+// hash a buffer by blocks of 64-bit words (processed in parallel), in
+// two independent 64-bit lanes
+static std::array<uint64_t, 2> hashBuffer(const void *const buffer,
+                                          const size_t nBytes,
+                                          const int threadNumber) {
+
+  const auto mix = [](uint64_t x) {
+    // splitmix64 finalizer
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+  };
+
+  const auto bytes = static_cast<const unsigned char *>(buffer);
+  const size_t nWords = nBytes / sizeof(uint64_t);
+  const size_t blockSize = 1 << 20;
+  const size_t nBlocks = (nWords + blockSize - 1) / blockSize;
+  std::vector<std::array<uint64_t, 2>> blockHashes(nBlocks);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < nBlocks; ++i) {
+    std::array<uint64_t, 2> h{mix(i + 1), mix(~i)};
+    const size_t end = std::min(nWords, (i + 1) * blockSize);
+    for(size_t j = i * blockSize; j < end; ++j) {
+      uint64_t w{};
+      std::memcpy(&w, bytes + j * sizeof(uint64_t), sizeof(uint64_t));
+      h[0] = mix(h[0] ^ w);
+      h[1] = mix(h[1] + w);
+    }
+    blockHashes[i] = h;
+  }
+  TTK_FORCE_USE(threadNumber);
+
+  std::array<uint64_t, 2> res{mix(nBytes), mix(~nBytes)};
+  const auto combine = [&res, &mix](const uint64_t h0, const uint64_t h1) {
+    res[0] = mix(res[0] ^ h0);
+    res[1] = mix(res[1] + h1);
+  };
+  for(const auto &h : blockHashes) {
+    combine(h[0], h[1]);
+  }
+  // remaining bytes
+  for(size_t i = nWords * sizeof(uint64_t); i < nBytes; ++i) {
+    combine(bytes[i], bytes[i]);
+  }
+  return res;
+}
+
 struct ttkOnDeleteCommand : public vtkCommand {
   RegistryKey key;
   vtkObject *observee;
@@ -166,6 +226,162 @@ bool RegistryValue::isValid(vtkDataSet *dataSet) const {
 
 ttkTriangulationFactory::ttkTriangulationFactory() {
   this->setDebugMsgPrefix("TriangulationFactory");
+
+  const auto cacheDir = std::getenv("TTK_TRIANGULATION_CACHE_DIR");
+  if(cacheDir != nullptr) {
+    this->cacheDirectory_ = cacheDir;
+  }
+}
+
+int ttkTriangulationFactory::LoadFromCache(RegistryValue &value,
+                                           vtkDataSet *dataSet) {
+
+  if(this->cacheDirectory_.empty() || !dataSet->IsA("vtkPointSet")
+     || value.triangulation->getType() != ttk::Triangulation::Type::EXPLICIT) {
+    return 0;
+  }
+
+  auto cells = GetCells(dataSet);
+  if(cells == nullptr || cells->GetNumberOfCells() == 0) {
+    return 0;
+  }
+
+  ttk::Timer timer;
+
+  // the preconditioned arrays only depend on the number of points and
+  // on the cells (the point coordinates are not needed)
+  const auto connectivity = cells->GetConnectivityArray();
+  const auto offsets = cells->GetOffsetsArray();
+  const auto hashArray = [](vtkDataArray *const array) {
+    return hashBuffer(ttkUtils::GetVoidPointer(array),
+                      array->GetNumberOfValues() * array->GetDataTypeSize(),
+                      ttk::globalThreadNumber_);
+  };
+  const auto connectivityHash = hashArray(connectivity);
+  const auto offsetsHash = hashArray(offsets);
+  const std::array<uint64_t, 6> keys{
+    static_cast<uint64_t>(dataSet->GetNumberOfPoints()),
+    static_cast<uint64_t>(cells->GetNumberOfCells()),
+    connectivityHash[0],
+    connectivityHash[1],
+    offsetsHash[0],
+    offsetsHash[1]};
+  const auto key = hashBuffer(keys.data(), sizeof(keys), 1);
+
+  // the first lane names the cache file, the second one is stored in
+  // its header to reject files of other cells (hash collisions); the
+  // numbers of vertices and cells are also checked when reading
+  std::stringstream fileName;
+  fileName << this->cacheDirectory_ << "/" << std::hex << std::setfill('0')
+           << std::setw(16) << key[0] << ".tpt";
+  value.cacheFile = fileName.str();
+
+  auto explTri
+    = static_cast<ttk::ExplicitTriangulation *>(value.triangulation->getData());
+  explTri->setFileChecksum(std::max<uint64_t>(key[1], 1));
+
+  std::ifstream cacheFile(value.cacheFile);
+  if(!cacheFile.good()) {
+    // cache miss: the file will be written by UpdateCache
+    this->printMsg("Triangulation not in cache (" + value.cacheFile + ")",
+                   ttk::debug::Priority::DETAIL);
+    return 0;
+  }
+  cacheFile.close();
+
+  if(explTri->readFromMappedFile(value.cacheFile) != 0) {
+    this->printWrn("Could not read cached triangulation " + value.cacheFile);
+    return -1;
+  }
+  value.cachedArrays = explTri->getNumberOfStoredArrays();
+
+  this->printMsg("Loaded cached triangulation (" + value.cacheFile + ")", 1,
+                 timer.getElapsedTime(), ttk::debug::LineMode::NEW,
+                 ttk::debug::Priority::DETAIL);
+
+  return 0;
+}
+
+int ttkTriangulationFactory::WriteToCache(RegistryValue &value) {
+
+  ttk::Timer timer;
+
+  auto explTri
+    = static_cast<ttk::ExplicitTriangulation *>(value.triangulation->getData());
+  const auto nArrays = explTri->getNumberOfStoredArrays();
+  if(nArrays <= value.cachedArrays) {
+    return 0;
+  }
+
+  // serialize the updates of the cache file between processes
+  ttk::FileLock lock{};
+  const auto lockStatus = lock.tryLock(value.cacheFile + ".lock");
+  if(lockStatus == -1) {
+    this->printWrn("Could not write to cache directory "
+                   + this->cacheDirectory_);
+    // do not try again
+    value.cacheFile.clear();
+    return -1;
+  } else if(lockStatus != 0) {
+    // another process is updating the file, try again later
+    return 0;
+  }
+
+  // only append the new arrays to an existing file
+  std::ifstream existingFile(value.cacheFile);
+  const bool exists = existingFile.good();
+  existingFile.close();
+  if(exists && explTri->appendToFile(value.cacheFile) == 0) {
+    value.cachedArrays = nArrays;
+    this->printMsg("Appended to cached triangulation (" + value.cacheFile
+                     + ")",
+                   1, timer.getElapsedTime(), ttk::debug::LineMode::NEW,
+                   ttk::debug::Priority::DETAIL);
+    return 0;
+  }
+
+  // otherwise, write to a temporary file then rename it so that
+  // concurrent processes never read a partially written file (files
+  // that are currently mapped remain valid after the rename)
+  const auto tmpFile
+    = value.cacheFile + ".part"
+      + std::to_string(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+  {
+    std::ofstream stream(tmpFile, std::ios::out | std::ios::binary);
+    if(!stream.good()) {
+      this->printWrn("Could not write to cache directory "
+                     + this->cacheDirectory_);
+      // do not try again
+      value.cacheFile.clear();
+      return -1;
+    }
+    explTri->writeToFile(stream);
+  }
+  if(ttk::OsCall::replaceFile(tmpFile, value.cacheFile) != 0) {
+    ttk::OsCall::rmFile(tmpFile);
+    this->printWrn("Could not update cached triangulation " + value.cacheFile);
+    return -1;
+  }
+  value.cachedArrays = nArrays;
+
+  this->printMsg("Updated cached triangulation (" + value.cacheFile + ")", 1,
+                 timer.getElapsedTime(), ttk::debug::LineMode::NEW,
+                 ttk::debug::Priority::DETAIL);
+
+  return 0;
+}
+
+void ttkTriangulationFactory::UpdateCache() {
+  auto instance = &ttkTriangulationFactory::Instance;
+  if(instance->cacheDirectory_.empty()) {
+    return;
+  }
+  for(auto &it : instance->registry) {
+    if(!it.second.cacheFile.empty()) {
+      instance->WriteToCache(it.second);
+    }
+  }
 }
 
 RegistryTriangulation
@@ -232,6 +448,29 @@ RegistryTriangulation
                    ttk::debug::LineMode::REPLACE, ttk::debug::Priority::DETAIL);
   }
 
+  // Out-of-core mode: page the clusters from the file written by
+  // ttkTriangulationManager instead of the in-memory points and cells
+  if(hasIndexArray) {
+    auto clusterFile = vtkStringArray::SafeDownCast(
+      pointSet->GetFieldData()->GetAbstractArray(
+        ttk::compactTriangulationFile));
+    if(clusterFile != nullptr && clusterFile->GetNumberOfValues() > 0) {
+      const std::string fileName = clusterFile->GetValue(0);
+      if(triangulation->setStellarInputFile(fileName) == 0
+         && triangulation->getNumberOfVertices()
+              == points->GetNumberOfPoints()
+         && triangulation->getNumberOfCells() == cells->GetNumberOfCells()) {
+        this->printMsg("Initializing Compact Triangulation (out-of-core)", 1,
+                       timer.getElapsedTime(), ttk::debug::LineMode::NEW,
+                       ttk::debug::Priority::DETAIL);
+        return triangulation;
+      }
+      this->printWrn("Cannot page the clusters from `" + fileName + "'");
+      this->printWrn("Keeping the in-memory Compact Triangulation.");
+      triangulation = std::make_unique<ttk::Triangulation>();
+    }
+  }
+
   // Points
   {
     auto pointDataType = points->GetDataType();
@@ -371,9 +610,10 @@ ttk::Triangulation *ttkTriangulationFactory::GetTriangulation(
   if(!triangulation) {
     triangulation = instance->CreateTriangulation(object).release();
     if(triangulation) {
-      instance->registry.emplace(std::piecewise_construct,
-                                 std::forward_as_tuple(key),
-                                 std::forward_as_tuple(object, triangulation));
+      auto res = instance->registry.emplace(
+        std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(object, triangulation));
+      instance->LoadFromCache(res.first->second, object);
     }
   }
 
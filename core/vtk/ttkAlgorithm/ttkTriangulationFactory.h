@@ -25,6 +25,11 @@ struct RegistryValue {
 
   vtkMTimeType cellModTime{0};
 
+  // on-disk cache file of the preconditioned arrays (empty if disabled)
+  std::string cacheFile{};
+  // number of arrays stored in cacheFile
+  int cachedArrays{0};
+
   int extent[6];
   double origin[3];
   double spacing[3];
@@ -37,11 +42,37 @@ struct RegistryValue {
 using RegistryKey = long long;
 using Registry = std::unordered_map<RegistryKey, RegistryValue>;
 
+/**
+ * Creates and stores the triangulations of the VTK datasets.
+ *
+ * Setting the TTK_TRIANGULATION_CACHE_DIR environment variable to a
+ * directory path enables a persistent cache of the explicit
+ * triangulations preconditioning results (edges, stars, links...),
+ * keyed by a hash of the number of points and of the cell array
+ * content. Cached results are memory-mapped when a triangulation is
+ * created (see ttk::ExplicitTriangulation::readFromMappedFile) and the
+ * cache is updated after each filter execution that computed new
+ * preconditioning results (see UpdateCache): the new arrays are
+ * appended to the existing file. The file header stores the numbers
+ * of vertices and cells and a second checksum of the cells, which are
+ * checked before using a cached file.
+ *
+ * Compact triangulations whose field data names a cluster file
+ * (ttk::compactTriangulationFile, set by ttkTriangulationManager) are
+ * loaded in out-of-core mode: the clusters are paged from that file
+ * (see ttk::Triangulation::setStellarInputFile).
+ */
 class TTKALGORITHM_EXPORT ttkTriangulationFactory : public ttk::Debug {
 public:
   static ttk::Triangulation *
     GetTriangulation(int debugLevel, float cacheRatio, vtkDataSet *object);
 
+  /**
+   * Write the new preconditioning results of the registered
+   * triangulations to the on-disk cache (if enabled).
+   */
+  static void UpdateCache();
+
   static ttkTriangulationFactory Instance;
   static RegistryKey GetKey(vtkDataSet *dataSet);
 
@@ -59,6 +90,11 @@ private:
   RegistryTriangulation CreateTriangulation(vtkDataSet *dataSet);
   int FindImplicitTriangulation(ttk::Triangulation *&triangulation,
                                 vtkImageData *image);
+  int LoadFromCache(RegistryValue &value, vtkDataSet *dataSet);
+  int WriteToCache(RegistryValue &value);
+
+  // value of the TTK_TRIANGULATION_CACHE_DIR environment variable
+  std::string cacheDirectory_{};
 
   ttkTriangulationFactory();
 };
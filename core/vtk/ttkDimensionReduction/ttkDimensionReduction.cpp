@@ -55,7 +55,7 @@ int ttkDimensionReduction::RequestData(vtkInformation *ttkNotUsed(request),
     }
   }
 
-  if(this->isPythonFound()) {
+  if(this->isNativeMethod() || this->isPythonFound()) {
     const SimplexId numberOfRows = input->GetNumberOfRows();
     const SimplexId numberOfColumns = ScalarFields.size();
 
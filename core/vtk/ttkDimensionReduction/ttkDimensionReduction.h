@@ -93,6 +93,9 @@ public:
   vtkSetMacro(KeepAllDataArrays, bool);
   vtkGetMacro(KeepAllDataArrays, bool);
 
+  vtkSetMacro(UseNativeImplementation, bool);
+  vtkGetMacro(UseNativeImplementation, bool);
+
   // SE && MDS
   void SetInputIsADistanceMatrix(const bool b) {
     this->InputIsADistanceMatrix = b;
@@ -152,6 +155,9 @@ public:
   vtkSetMacro(mds_Epsilon, float);
   vtkGetMacro(mds_Epsilon, float);
 
+  vtkSetMacro(mds_LandmarkNumber, int);
+  vtkGetMacro(mds_LandmarkNumber, int);
+
   // TSNE
   vtkSetMacro(tsne_Perplexity, float);
   vtkGetMacro(tsne_Perplexity, float);
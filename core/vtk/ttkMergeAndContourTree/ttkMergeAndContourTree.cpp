@@ -8,11 +8,15 @@
 #include <vtkInformation.h>
 #include <vtkInformationVector.h>
 #include <vtkNew.h>
+#include <vtkPointData.h>
 #include <vtkPolyData.h>
 #include <vtkThreshold.h>
 #include <vtkUnstructuredGrid.h>
 #include <vtkVersion.h> // for VTK_VERSION_CHECK via ParaView 5.8.1
 
+#include <algorithm>
+#include <array>
+
 vtkStandardNewMacro(ttkMergeAndContourTree);
 
 ttkMergeAndContourTree::ttkMergeAndContourTree() {
@@ -95,8 +99,32 @@ int ttkMergeAndContourTree::RequestData(vtkInformation *ttkNotUsed(request),
     if(!inputArray)
       return 0;
 
+    // With MPI, the join or split tree of the whole domain is stitched
+    // from the trees of every rank (see
+    // ttk::ftm::FTMTree::setDistributedTrees()): each rank processes its
+    // whole block at once, the connectivity of the domain and the global
+    // order are checked by the base layer
+    bool distributedTrees{false};
+#ifdef TTK_ENABLE_MPI
+    if(ttk::isRunningWithMPI()) {
+      if(GetTreeType() != ttk::ftm::TreeType::Join
+         && GetTreeType() != ttk::ftm::TreeType::Split) {
+        this->printErr("Only the join and split trees are supported with MPI");
+        return 0;
+      }
+      distributedTrees = true;
+      this->hasMPISupport_ = true;
+    }
+#endif // TTK_ENABLE_MPI
+
     // Connected components
-    if(input->IsA("vtkUnstructuredGrid")) {
+    if(distributedTrees) {
+      nbCC_ = 1;
+      connected_components_.resize(nbCC_);
+      connected_components_[0].TakeReference(input->NewInstance());
+      connected_components_[0]->ShallowCopy(input);
+      identify(connected_components_[0]);
+    } else if(input->IsA("vtkUnstructuredGrid")) {
       // This data set may have several connected components,
       // we need to apply the FTM Tree for each one of these components
       // We then reconstruct the global tree using an offset mechanism
@@ -187,11 +215,19 @@ int ttkMergeAndContourTree::RequestData(vtkInformation *ttkNotUsed(request),
       ftmTree_[cc].tree.setTreeType(GetTreeType());
       ftmTree_[cc].tree.setSegmentation(GetWithSegmentation());
       ftmTree_[cc].tree.setNormalizeIds(GetWithNormalize());
+#ifdef TTK_ENABLE_MPI
+      ftmTree_[cc].tree.setDistributedTrees(distributedTrees);
+#endif // TTK_ENABLE_MPI
 
+      int status = 0;
       ttkVtkTemplateMacro(inputArray->GetDataType(),
                           triangulation_[cc]->getType(),
-                          (ftmTree_[cc].tree.build<VTK_TT, TTK_TT>(
-                            (TTK_TT *)triangulation_[cc]->getData())));
+                          (status = ftmTree_[cc].tree.build<VTK_TT, TTK_TT>(
+                             (TTK_TT *)triangulation_[cc]->getData())));
+      if(status != 0) {
+        this->printErr("Error : tree computation failed.");
+        return 0;
+      }
 
       ftmTree_[cc].offset = acc_nbNodes;
       acc_nbNodes
@@ -200,6 +236,19 @@ int ttkMergeAndContourTree::RequestData(vtkInformation *ttkNotUsed(request),
 
     UpdateProgress(0.50);
 
+#ifdef TTK_ENABLE_MPI
+    if(distributedTrees) {
+      if(getDistributedTree(input, outputSkeletonNodes, outputSkeletonArcs,
+                            outputSegmentation)
+         == 0) {
+        this->printErr("Error : wrong distributed tree.");
+        return 0;
+      }
+      UpdateProgress(1);
+      return 1;
+    }
+#endif // TTK_ENABLE_MPI
+
     // Construct output
     if(getSkeletonNodes(outputSkeletonNodes) == 0) {
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -631,6 +680,168 @@ int ttkMergeAndContourTree::getSkeletonNodes(
   return 1;
 }
 
+#ifdef TTK_ENABLE_MPI
+int ttkMergeAndContourTree::getDistributedTree(
+  vtkDataSet *input,
+  vtkUnstructuredGrid *outputSkeletonNodes,
+  vtkUnstructuredGrid *outputSkeletonArcs,
+  vtkDataSet *outputSegmentation) {
+  using ttk::CriticalType;
+  using ttk::SimplexId;
+  using ttk::ftm::idNode;
+  using ttk::ftm::idSuperArc;
+
+  const auto &tree = ftmTree_[0].tree.getDistributedTree(GetTreeType());
+  const auto triangulation = triangulation_[0];
+  const bool isST = GetTreeType() == ttk::ftm::TreeType::Split;
+  const size_t nNodes = tree.nodesVertex.size();
+  const size_t nArcs = tree.arcs.size();
+
+  std::vector<int> downDegree(nNodes, 0), upDegree(nNodes, 0);
+  std::vector<idSuperArc> nodeArc(nNodes, ttk::ftm::nullSuperArc);
+  for(size_t i = 0; i < nArcs; ++i) {
+    upDegree[tree.arcs[i][0]]++;
+    downDegree[tree.arcs[i][1]]++;
+    // segmentation of a node: arc above, arc below for the root
+    nodeArc[tree.arcs[i][0]] = i;
+    if(nodeArc[tree.arcs[i][1]] == ttk::ftm::nullSuperArc) {
+      nodeArc[tree.arcs[i][1]] = i;
+    }
+  }
+  const auto nodeType = [&](const idNode n) {
+    if(downDegree[n] == 0) {
+      return isST ? CriticalType::Local_maximum : CriticalType::Local_minimum;
+    }
+    if(upDegree[n] == 0) {
+      return isST ? CriticalType::Local_minimum : CriticalType::Local_maximum;
+    }
+    if(downDegree[n] == 1) {
+      return CriticalType::Regular;
+    }
+    if(downDegree[n] == 2) {
+      return isST ? CriticalType::Saddle2 : CriticalType::Saddle1;
+    }
+    return CriticalType::Degenerate;
+  };
+
+  // coordinates and scalar value of every node, sent by the rank owning
+  // its vertex
+  std::vector<char> isOwned(nNodes, 0);
+  std::vector<double> nodesData{}, gNodesData{};
+  for(size_t n = 0; n < nNodes; ++n) {
+    const auto lid = triangulation->getVertexLocalId(tree.nodesVertex[n]);
+    if(lid == -1 || triangulation->getVertexRank(lid) != ttk::MPIrank_) {
+      continue;
+    }
+    isOwned[n] = 1;
+    float p[3];
+    triangulation->getVertexPoint(lid, p[0], p[1], p[2]);
+    nodesData.insert(nodesData.end(),
+                     {static_cast<double>(n), p[0], p[1], p[2],
+                      inputScalars_[0]->GetTuple1(lid)});
+  }
+  ttk::gatherVector(nodesData, gNodesData);
+  ttk::broadcastVector(gNodesData);
+  std::vector<std::array<double, 4>> nodes(nNodes);
+  for(size_t i = 0; i + 4 < gNodesData.size(); i += 5) {
+    nodes[static_cast<size_t>(gNodesData[i])]
+      = {gNodesData[i + 1], gNodesData[i + 2], gNodesData[i + 3],
+         gNodesData[i + 4]};
+  }
+
+  ttk::ftm::WrapperData wrapper{};
+
+  // 1. nodes owned by the current rank
+  {
+    vtkNew<vtkUnstructuredGrid> skeletonNodes{};
+    vtkNew<vtkPoints> points{};
+    const auto nOwned = std::count(isOwned.begin(), isOwned.end(), 1);
+    auto ids = wrapper.initArray<ttkSimplexIdTypeArray>("NodeId", nOwned);
+    auto vertIds
+      = wrapper.initArray<ttkSimplexIdTypeArray>("VertexId", nOwned);
+    auto type = wrapper.initArray<vtkIntArray>("CriticalType", nOwned);
+    auto scalars = wrapper.initArray<vtkFloatArray>("Scalar", nOwned);
+    for(size_t n = 0; n < nNodes; ++n) {
+      if(!isOwned[n]) {
+        continue;
+      }
+      const auto &node = nodes[n];
+      const auto p = points->InsertNextPoint(node[0], node[1], node[2]);
+      ids->SetTuple1(p, n);
+      vertIds->SetTuple1(p, tree.nodesVertex[n]);
+      type->SetTuple1(p, static_cast<int>(nodeType(n)));
+      scalars->SetTuple1(p, node[3]);
+    }
+    ttkUtils::CellVertexFromPoints(skeletonNodes, points);
+    auto pointData = skeletonNodes->GetPointData();
+    pointData->AddArray(ids);
+    pointData->AddArray(vertIds);
+    pointData->AddArray(type);
+    pointData->AddArray(scalars);
+    outputSkeletonNodes->ShallowCopy(skeletonNodes);
+  }
+
+  // 2. arcs whose down node is owned by the current rank
+  {
+    vtkNew<vtkUnstructuredGrid> skeletonArcs{};
+    vtkNew<vtkPoints> points{};
+    std::vector<idSuperArc> arcs{};
+    for(size_t i = 0; i < nArcs; ++i) {
+      if(isOwned[tree.arcs[i][0]]) {
+        arcs.emplace_back(i);
+      }
+    }
+    auto ids
+      = wrapper.initArray<ttkSimplexIdTypeArray>("SegmentationId", arcs.size());
+    auto upNode
+      = wrapper.initArray<ttkSimplexIdTypeArray>("upNodeId", arcs.size());
+    auto downNode
+      = wrapper.initArray<ttkSimplexIdTypeArray>("downNodeId", arcs.size());
+    auto scalars
+      = wrapper.initArray<vtkFloatArray>("Scalar", 2 * arcs.size());
+    skeletonArcs->Allocate(arcs.size());
+    for(size_t i = 0; i < arcs.size(); ++i) {
+      const auto &arc = tree.arcs[arcs[i]];
+      vtkIdType pointIds[2];
+      for(int j = 0; j < 2; ++j) {
+        const auto &node = nodes[arc[j]];
+        pointIds[j] = points->InsertNextPoint(node[0], node[1], node[2]);
+        scalars->SetTuple1(pointIds[j], node[3]);
+      }
+      skeletonArcs->InsertNextCell(VTK_LINE, 2, pointIds);
+      ids->SetTuple1(i, arcs[i]);
+      downNode->SetTuple1(i, arc[0]);
+      upNode->SetTuple1(i, arc[1]);
+    }
+    skeletonArcs->SetPoints(points);
+    skeletonArcs->GetCellData()->SetScalars(ids);
+    skeletonArcs->GetCellData()->AddArray(upNode);
+    skeletonArcs->GetCellData()->AddArray(downNode);
+    skeletonArcs->GetPointData()->AddArray(scalars);
+    outputSkeletonArcs->ShallowCopy(skeletonArcs);
+  }
+
+  // 3. segmentation of the local vertices (global arc identifiers)
+  if(GetWithSegmentation()) {
+    outputSegmentation->ShallowCopy(input);
+    const SimplexId nVerts = input->GetNumberOfPoints();
+    auto ids
+      = wrapper.initArray<ttkSimplexIdTypeArray>("SegmentationId", nVerts);
+    for(SimplexId v = 0; v < nVerts; ++v) {
+      const auto n = tree.vertNode[v];
+      const auto arc
+        = n != ttk::ftm::nullNodes ? nodeArc[n] : tree.vertArc[v];
+      ids->SetTuple1(
+        v, arc != ttk::ftm::nullSuperArc ? static_cast<SimplexId>(arc) : -1);
+    }
+    outputSegmentation->GetPointData()->AddArray(ids);
+    outputSegmentation->GetPointData()->SetActiveScalars(ids->GetName());
+  }
+
+  return 1;
+}
+#endif // TTK_ENABLE_MPI
+
 #ifdef TTK_ENABLE_FTM_TREE_STATS_TIME
 void ttkMergeAndContourTree::printCSVStats() {
   using namespace ttk;
@@ -13,6 +13,8 @@
 /// The VTK wrapper will first call a connectivity filter, and then call
 /// a contour / merge tree computation for each connected components. The final
 /// tree is then aggregated.
+/// With MPI, the join and split trees are computed on the whole distributed
+/// domain (assumed to be connected) by stitching the trees of every rank.
 ///
 /// \param Input Input scalar field, either 2D or 3D, regular
 /// grid or triangulation (vtkDataSet)
@@ -202,6 +204,18 @@ public:
 
   int getSegmentation(vtkDataSet *outputSegmentation);
 
+#ifdef TTK_ENABLE_MPI
+  /**
+   * Outputs of the join or split tree of the whole distributed domain:
+   * every rank outputs the nodes whose vertex it owns, the arcs whose
+   * down node it owns and the segmentation of its vertices.
+   */
+  int getDistributedTree(vtkDataSet *input,
+                         vtkUnstructuredGrid *outputSkeletonNodes,
+                         vtkUnstructuredGrid *outputSkeletonArcs,
+                         vtkDataSet *outputSegmentation);
+#endif // TTK_ENABLE_MPI
+
 #ifdef TTK_ENABLE_FTM_TREE_STATS_TIME
   void printCSVStats();
   void printCSVTree(const ttk::ftm::FTMTree_MT *const tree) const;
@@ -99,6 +99,11 @@ int ttkPersistenceDiagram::RequestData(vtkInformation *ttkNotUsed(request),
   vtkUnstructuredGrid *outputCTPersistenceDiagram
     = vtkUnstructuredGrid::GetData(outputVector, 0);
 
+#ifdef TTK_ENABLE_MPI
+  // only the DiscreteMorseSandwich backend handles distributed inputs
+  this->hasMPISupport_ = (this->BackEnd == BACKEND::DISCRETE_MORSE_SANDWICH);
+#endif // TTK_ENABLE_MPI
+
   ttk::Triangulation *triangulation = ttkAlgorithm::GetTriangulation(input);
 #ifndef TTK_ENABLE_KAMIKAZE
   if(!triangulation) {
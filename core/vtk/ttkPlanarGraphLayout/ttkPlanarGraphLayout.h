@@ -53,6 +53,7 @@
 
 // VTK includes
 #include <ttkAlgorithm.h>
+#include <ttkMacros.h>
 #include <vtkUnstructuredGrid.h>
 
 // TTK includes
@@ -102,6 +103,9 @@ public:
   vtkSetMacro(UseLevels, bool);
   vtkGetMacro(UseLevels, bool);
 
+  ttkSetEnumMacro(LayoutEngine, LAYOUT_ENGINE);
+  vtkGetEnumMacro(LayoutEngine, LAYOUT_ENGINE);
+
   // getters and setters for output array name
   vtkSetMacro(OutputArrayName, const std::string &);
   vtkGetMacro(OutputArrayName, std::string);
@@ -59,6 +59,9 @@ public:
   vtkSetMacro(Epsilon, double);
   vtkGetMacro(Epsilon, double);
 
+  vtkSetMacro(InputIsADistanceMatrix, bool);
+  vtkGetMacro(InputIsADistanceMatrix, bool);
+
   vtkSetMacro(KeepAllDataArrays, bool);
   vtkGetMacro(KeepAllDataArrays, bool);
 
@@ -93,6 +96,7 @@ protected:
                   vtkInformationVector *outputVector) override;
 
 private:
+  bool InputIsADistanceMatrix{true};
   bool KeepAllDataArrays{true};
   bool SelectFieldsWithRegexp{false};
   std::string RegexpString{".*"};
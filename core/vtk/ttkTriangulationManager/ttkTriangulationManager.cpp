@@ -7,11 +7,13 @@
 #include <vtkCommand.h>
 #include <vtkDataArray.h>
 #include <vtkDataSet.h>
+#include <vtkFieldData.h>
 #include <vtkInformation.h>
 #include <vtkIntArray.h>
 #include <vtkPointData.h>
 #include <vtkPointSet.h>
 #include <vtkSmartPointer.h>
+#include <vtkStringArray.h>
 
 #include <CompactTriangulationPreconditioning.h>
 #include <Triangulation.h>
@@ -187,6 +189,17 @@ int ttkTriangulationManager::processExplicit(
   if(status != 1)
     return 0;
 
+  // Store the clusters for out-of-core usage
+  if(!this->ClusterFileName.empty()) {
+    ttkTemplateMacro(
+      triangulation.getType(),
+      (status = worker.writeClusterFile(
+         this->ClusterFileName,
+         static_cast<TTK_TT *>(triangulation.getData()))));
+    if(status != 0)
+      return 0;
+  }
+
   // Get input data array selection
   std::vector<vtkDataArray *> pointDataArrays{};
   std::vector<vtkDataArray *> cellDataArrays{};
@@ -285,6 +298,14 @@ int ttkTriangulationManager::processExplicit(
     output->GetCellData()->AddArray(updatedField);
   }
 
+  // let ttkTriangulationFactory page the clusters from the cluster file
+  if(!this->ClusterFileName.empty()) {
+    vtkNew<vtkStringArray> clusterFile{};
+    clusterFile->SetName(ttk::compactTriangulationFile);
+    clusterFile->InsertNextValue(this->ClusterFileName);
+    output->GetFieldData()->AddArray(clusterFile);
+  }
+
   this->printMsg("Done!", 1.0, tm.getElapsedTime(), 1);
 
   // return success
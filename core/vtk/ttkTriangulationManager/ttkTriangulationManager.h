@@ -46,6 +46,7 @@ class TTKTRIANGULATIONMANAGER_EXPORT ttkTriangulationManager
   bool Periodicity{false};
   STRATEGY PreconditioningStrategy{STRATEGY::DEFAULT};
   int Threshold{1000};
+  std::string ClusterFileName{};
   vtkSmartPointer<vtkDataArraySelection> ArraySelection{};
 #ifdef TTK_ENABLE_MPI
   vtkNew<ttkPeriodicGhostsGeneration> periodicGhostGenerator{};
@@ -61,6 +62,9 @@ public:
   vtkSetMacro(Threshold, int);
   vtkGetMacro(Threshold, int);
 
+  vtkSetMacro(ClusterFileName, const std::string &);
+  vtkGetMacro(ClusterFileName, std::string);
+
   // copy the vtkPassSelectedArray ("PassArrays" filter) API
   vtkDataArraySelection *GetDataArraySelection() {
     return this->ArraySelection.GetPointer();
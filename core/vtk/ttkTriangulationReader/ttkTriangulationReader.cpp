@@ -76,8 +76,11 @@ int ttkTriangulationReader::RequestData(vtkInformation *ttkNotUsed(request),
   if(!this->validateFilePath()) {
     return 0;
   }
-  std::ifstream in(this->TriangulationFilePath);
-  explTri->readFromFile(in);
+  // memory-map the file: the precomputed arrays are only loaded when
+  // accessed and shared with other processes reading the same file
+  if(explTri->readFromMappedFile(this->TriangulationFilePath) != 0) {
+    return 0;
+  }
 
   this->printMsg("Restored triangulation from " + this->TriangulationFilePath,
                  1.0, timer.getElapsedTime(), 1);
@@ -25,6 +25,10 @@
 
 #include <ttkUtils.h>
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 vtkStandardNewMacro(ttkWebSocketIO);
 
 ttkWebSocketIO::ttkWebSocketIO() {
@@ -94,17 +98,49 @@ int ttkWebSocketIO::RequestData(vtkInformation *ttkNotUsed(request),
 
 int ttkWebSocketIO::processEvent(const std::string &eventName,
                                  const std::string &eventData) {
+  // both events are processed with the server mutex locked
+  if(eventName.compare("on_open") == 0) {
+    // a new client has none of the previously sent arrays
+    this->SentArrayMTimes.clear();
+    this->PendingArrayMTimes.clear();
+  } else if(eventName.compare("on_sequence_sent") == 0) {
+    // the client now holds the arrays of this sequence (and only those)
+    this->SentArrayMTimes = std::move(this->PendingArrayMTimes);
+    this->PendingArrayMTimes.clear();
+  }
+
   if(eventData.compare("RequestInputVtkDataSet") == 0) {
     if(!this->SendVtkDataObject(this->LastInput))
       return 0;
   } else if(eventData.rfind("{\"vtkDataSet", 12) == 0) {
     if(!this->ParseVtkDataObjectFromJSON(eventData))
       return 0;
+  } else if(eventData.compare("ttk_WSIO_BeginBinarySequence") == 0) {
+    this->ReceiveTimer.reStart();
+    this->printMsg("Receiving vtkDataObject", 0, 0,
+                   ttk::debug::LineMode::REPLACE);
+    this->ReceivedBlocks.clear();
+    this->ReceivedHeader.clear();
+    this->ReceivingBinarySequence = true;
+  } else if(eventData.compare("ttk_WSIO_EndBinarySequence") == 0) {
+    if(!this->FinalizeBinarySequence())
+      return 0;
+  } else if(this->ReceivingBinarySequence && eventData.rfind("{", 0) == 0) {
+    if(!this->ParseBinaryHeader(eventData))
+      return 0;
   }
 
   return WebSocketIO::processEvent(eventName, eventData);
 }
 
+int ttkWebSocketIO::processBinaryEvent(std::string &payload) {
+  if(!this->ReceivingBinarySequence) {
+    this->printWrn("Binary message received outside of a binary sequence.");
+    return 0;
+  }
+  return this->ParseBinaryPayload(payload);
+}
+
 template <typename T>
 T jsonGetValue(const boost::property_tree::ptree &pt,
                const boost::property_tree::ptree::key_type &key) {
@@ -124,6 +160,28 @@ void jsonArrayToArray(const boost::property_tree::ptree &pt,
   }
 }
 
+// VTK CELL TYPES MAP
+constexpr int vtkCellsTypeHash[20] = {VTK_EMPTY_CELL,
+                                      VTK_VERTEX,
+                                      VTK_LINE,
+                                      VTK_TRIANGLE,
+                                      VTK_TETRA,
+                                      VTK_CONVEX_POINT_SET,
+                                      VTK_CONVEX_POINT_SET,
+                                      VTK_CONVEX_POINT_SET,
+                                      VTK_VOXEL,
+                                      VTK_CONVEX_POINT_SET,
+                                      VTK_CONVEX_POINT_SET,
+                                      VTK_CONVEX_POINT_SET,
+                                      VTK_CONVEX_POINT_SET,
+                                      VTK_CONVEX_POINT_SET,
+                                      VTK_CONVEX_POINT_SET,
+                                      VTK_CONVEX_POINT_SET,
+                                      VTK_CONVEX_POINT_SET,
+                                      VTK_CONVEX_POINT_SET,
+                                      VTK_CONVEX_POINT_SET,
+                                      VTK_CONVEX_POINT_SET};
+
 static bool jsonHasChild(const boost::property_tree::ptree &pt,
                          const boost::property_tree::ptree::key_type &key) {
   return pt.find(key) != pt.not_found();
@@ -189,28 +247,6 @@ int ttkWebSocketIO::ParseVtkDataObjectFromJSON(const std::string &json) {
 
     // parse cells
     {
-      // VTK CELL TYPES MAP
-      constexpr int vtkCellsTypeHash[20] = {VTK_EMPTY_CELL,
-                                            VTK_VERTEX,
-                                            VTK_LINE,
-                                            VTK_TRIANGLE,
-                                            VTK_TETRA,
-                                            VTK_CONVEX_POINT_SET,
-                                            VTK_CONVEX_POINT_SET,
-                                            VTK_CONVEX_POINT_SET,
-                                            VTK_VOXEL,
-                                            VTK_CONVEX_POINT_SET,
-                                            VTK_CONVEX_POINT_SET,
-                                            VTK_CONVEX_POINT_SET,
-                                            VTK_CONVEX_POINT_SET,
-                                            VTK_CONVEX_POINT_SET,
-                                            VTK_CONVEX_POINT_SET,
-                                            VTK_CONVEX_POINT_SET,
-                                            VTK_CONVEX_POINT_SET,
-                                            VTK_CONVEX_POINT_SET,
-                                            VTK_CONVEX_POINT_SET,
-                                            VTK_CONVEX_POINT_SET};
-
       auto nOffsets
         = jsonGetValue<int>(jsonVtkDataSet, "cells.offsetsArray.nTuples");
       auto offsets = vtkSmartPointer<vtkIdTypeArray>::New();
@@ -307,13 +343,249 @@ int ttkWebSocketIO::ParseVtkDataObjectFromJSON(const std::string &json) {
   return 1;
 }
 
+// -----------------------------------------------------------------------------
+// Binary transport
+// -----------------------------------------------------------------------------
+
+// payloads adopted by vtkDataArrays, released by their free function
+static std::mutex adoptedPayloadsMutex;
+static std::unordered_map<void *, std::unique_ptr<std::string>>
+  adoptedPayloads;
+
+static void releasePayload(void *data) {
+  std::lock_guard<std::mutex> const lock(adoptedPayloadsMutex);
+  adoptedPayloads.erase(data);
+}
+
+// create an empty array described by a binary header
+static vtkSmartPointer<vtkDataArray>
+  createArray(const boost::property_tree::ptree &header) {
+  auto array = vtkSmartPointer<vtkDataArray>::Take(
+    vtkDataArray::CreateDataArray(jsonGetValue<int>(header, "dataType")));
+  if(array) {
+    array->SetName(jsonGetValue<std::string>(header, "name").data());
+    array->SetNumberOfComponents(jsonGetValue<int>(header, "nComponents"));
+  }
+  return array;
+}
+
+// let the array use the payload buffer as its values (without copy)
+static int adoptPayload(vtkDataArray *array,
+                        const vtkIdType nTuples,
+                        std::string &payload) {
+  const vtkIdType nValues = nTuples * array->GetNumberOfComponents();
+  if(static_cast<size_t>(nValues) * array->GetDataTypeSize()
+     != payload.size())
+    return 0;
+
+  // the string is moved to the heap so that its buffer (even a short one)
+  // keeps its address
+  auto buffer = std::make_unique<std::string>(std::move(payload));
+  void *data = &(*buffer)[0];
+  {
+    std::lock_guard<std::mutex> const lock(adoptedPayloadsMutex);
+    adoptedPayloads[data] = std::move(buffer);
+  }
+  array->SetVoidArray(
+    data, nValues, 0, vtkAbstractArray::VTK_DATA_ARRAY_USER_DEFINED);
+  array->SetArrayFreeFunction(releasePayload);
+  return 1;
+}
+
+int ttkWebSocketIO::ParseBinaryHeader(const std::string &json) {
+  boost::property_tree::ptree header;
+  try {
+    std::stringstream ss;
+    ss << json;
+    boost::property_tree::read_json(ss, header);
+  } catch(const std::exception &e) {
+    this->printErr("Unable to parse JSON header: " + json);
+    return 0;
+  }
+
+  if(jsonHasChild(header, "className")) {
+    if(jsonGetValue<std::string>(header, "className")
+         .compare("vtkUnstructuredGrid")
+       != 0) {
+      this->printErr(
+        "Currently WebSocketIO only supports parsing 'vtkUnstructuredGrids'.");
+      return 0;
+    }
+    ReceivedBlock received;
+    received.block = vtkSmartPointer<vtkUnstructuredGrid>::New();
+    this->ReceivedBlocks.emplace_back(received);
+    return 1;
+  }
+
+  if(!jsonHasChild(header, "target"))
+    return 1;
+
+  if(this->ReceivedBlocks.empty()) {
+    this->printErr("Array header received before any 'className'.");
+    return 0;
+  }
+
+  if(jsonHasChild(header, "data")) {
+    // string arrays are sent within their header
+    auto block = this->ReceivedBlocks.back().block;
+    auto stringArray = vtkSmartPointer<vtkStringArray>::New();
+    stringArray->SetName(jsonGetValue<std::string>(header, "name").data());
+    std::vector<std::string> values;
+    ttkUtils::stringListToVector(
+      jsonGetValue<std::string>(header, "data"), values);
+    stringArray->SetNumberOfValues(values.size());
+    for(size_t i = 0; i < values.size(); i++)
+      stringArray->SetValue(i, values[i]);
+
+    const auto target = jsonGetValue<std::string>(header, "target");
+    if(target.compare("pointData") == 0)
+      block->GetPointData()->AddArray(stringArray);
+    else if(target.compare("cellData") == 0)
+      block->GetCellData()->AddArray(stringArray);
+    else
+      block->GetFieldData()->AddArray(stringArray);
+    return 1;
+  }
+
+  this->ReceivedHeader = json;
+  if(jsonGetValue<size_t>(header, "nTuples") == 0
+     || jsonGetValue<size_t>(header, "nComponents") == 0) {
+    // empty arrays have no binary payload
+    std::string empty;
+    return this->ParseBinaryPayload(empty);
+  }
+  return 1;
+}
+
+int ttkWebSocketIO::ParseBinaryPayload(std::string &payload) {
+  if(this->ReceivedHeader.empty() || this->ReceivedBlocks.empty()) {
+    this->printErr("Binary payload received without header.");
+    return 0;
+  }
+
+  boost::property_tree::ptree header;
+  {
+    std::stringstream ss;
+    ss << this->ReceivedHeader;
+    boost::property_tree::read_json(ss, header);
+  }
+  this->ReceivedHeader.clear();
+
+  const auto target = jsonGetValue<std::string>(header, "target");
+  const auto name = jsonGetValue<std::string>(header, "name");
+
+  auto array = createArray(header);
+  if(!array) {
+    this->printErr("Unsupported data type for array '" + name + "'.");
+    return 0;
+  }
+  const auto nTuples = jsonGetValue<vtkIdType>(header, "nTuples");
+  if(!adoptPayload(array, nTuples, payload)) {
+    this->printErr("Invalid payload size for array '" + name + "'.");
+    return 0;
+  }
+
+  auto &received = this->ReceivedBlocks.back();
+  if(target.compare("points") == 0) {
+    if(array->GetNumberOfComponents() != 3) {
+      this->printErr("Point coordinates require 3 components.");
+      return 0;
+    }
+    auto points = vtkSmartPointer<vtkPoints>::New();
+    points->SetData(array);
+    received.block->SetPoints(points);
+  } else if(target.compare("cells") == 0) {
+    if(name.compare("offsetsArray") == 0)
+      received.offsets = array;
+    else
+      received.connectivity = array;
+  } else if(target.compare("pointData") == 0) {
+    received.block->GetPointData()->AddArray(array);
+  } else if(target.compare("cellData") == 0) {
+    received.block->GetCellData()->AddArray(array);
+  } else {
+    received.block->GetFieldData()->AddArray(array);
+  }
+
+  return 1;
+}
+
+int ttkWebSocketIO::FinalizeBinarySequence() {
+  this->ReceivingBinarySequence = false;
+
+  auto output = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  size_t b = 0;
+  for(auto &received : this->ReceivedBlocks) {
+    if(received.offsets && received.connectivity) {
+      auto cells = vtkSmartPointer<vtkCellArray>::New();
+      if(!cells->SetData(received.offsets, received.connectivity)) {
+        this->printErr("Unsupported cell array types.");
+        return 0;
+      }
+
+      // cell types from the number of vertices of the cells
+      const vtkIdType nCells = cells->GetNumberOfCells();
+      auto cellTypes = vtkSmartPointer<vtkUnsignedCharArray>::New();
+      cellTypes->SetNumberOfTuples(nCells);
+      for(vtkIdType i = 0; i < nCells; i++) {
+        const vtkIdType cellSize = cells->GetCellSize(i);
+        cellTypes->SetValue(
+          i, cellSize < 20 ? vtkCellsTypeHash[cellSize] : VTK_CONVEX_POINT_SET);
+      }
+      received.block->SetCells(cellTypes, cells);
+    }
+    output->SetBlock(b++, received.block);
+  }
+  this->ReceivedBlocks.clear();
+
+  this->LastOutput = output;
+
+  this->printMsg("Receiving vtkDataObject", 1,
+                 this->ReceiveTimer.getElapsedTime());
+
+  this->SetNeedsUpdate(true);
+
+  return 1;
+}
+
+int ttkWebSocketIO::QueueArray(const std::string &key,
+                               const std::string &header,
+                               vtkDataArray *array) {
+  const vtkMTimeType mTime = array->GetMTime();
+  bool unchanged = false;
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    const auto it = this->SentArrayMTimes.find(key);
+    unchanged = this->SendOnlyModifiedArrays
+                && it != this->SentArrayMTimes.end() && it->second == mTime;
+    this->PendingArrayMTimes[key] = mTime;
+  }
+
+  if(unchanged) {
+    // the client keeps the values received in a previous sequence
+    this->queueMessage(header + ",\"unchanged\": true}");
+    return 1;
+  }
+
+  this->queueMessage(header + "}");
+  // raw values, sent from the array memory
+  if(array->GetNumberOfValues() > 0)
+    this->queueMessage(array->GetNumberOfValues() * array->GetDataTypeSize(),
+                       ttkUtils::GetVoidPointer(array));
+  return 1;
+}
+
 int ttkWebSocketIO::SendVtkDataObject(vtkDataObject *object) {
   ttk::Timer timer;
   this->printMsg(
     "Serializing vtkDataObject", 0, 0, ttk::debug::LineMode::REPLACE);
 
-  // clear queue
+  // clear queue, the arrays of an interrupted sequence are not committed
   this->clearMessageQueue();
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->PendingArrayMTimes.clear();
+  }
 
   auto objectAsMB = vtkSmartPointer<vtkMultiBlockDataSet>::New();
   if(object->IsA("vtkMultiBlockDataSet"))
@@ -371,24 +643,22 @@ int ttkWebSocketIO::SendVtkDataObject(vtkDataObject *object) {
     auto blockAsPS = vtkPointSet::SafeDownCast(block);
     if(blockAsPS != nullptr) {
       auto points = blockAsPS->GetPoints();
-      this->queueMessage(
-        "{"
-        "\"target\": \"points\","
-        "\"name\": \"coordinates\","
-        "\"dataType\":"
-        + std::to_string(points ? points->GetDataType() : VTK_FLOAT)
-        + ","
-          "\"nTuples\":"
-        + std::to_string(blockAsPS->GetNumberOfPoints())
-        + ","
-          "\"nComponents\": 3"
-          "}");
-      if(blockAsPS->GetNumberOfPoints() > 0 && points != nullptr)
-        switch(points->GetDataType()) {
-          vtkTemplateMacro(this->queueMessage(
-            blockAsPS->GetNumberOfPoints() * sizeof(VTK_TT) * 3,
-            ttkUtils::GetVoidPointer(points)));
-        }
+      const std::string header
+        = "{"
+          "\"target\": \"points\","
+          "\"name\": \"coordinates\","
+          "\"dataType\":"
+          + std::to_string(points ? points->GetDataType() : VTK_FLOAT)
+          + ","
+            "\"nTuples\":"
+          + std::to_string(blockAsPS->GetNumberOfPoints())
+          + ","
+            "\"nComponents\": 3";
+      if(points != nullptr)
+        this->QueueArray(std::to_string(b) + "/points/coordinates", header,
+                         points->GetData());
+      else
+        this->queueMessage(header + "}");
     }
 
     this->printMsg(
@@ -412,43 +682,26 @@ int ttkWebSocketIO::SendVtkDataObject(vtkDataObject *object) {
       }
 
       if(cells) {
-        {
-          auto connectivityArray = cells->GetConnectivityArray();
-          this->queueMessage(
-            "{"
-            "\"target\": \"cells\","
-            "\"name\": \"connectivityArray\","
-            "\"dataType\":"
-            + std::to_string(VTK_ID_TYPE)
-            + ","
-              "\"nTuples\":"
-            + std::to_string(connectivityArray->GetNumberOfTuples())
-            + ","
-              "\"nComponents\": 1"
-              "}");
-          if(connectivityArray->GetNumberOfTuples() > 0)
-            this->queueMessage(
-              connectivityArray->GetNumberOfTuples() * sizeof(vtkIdType),
-              ttkUtils::GetVoidPointer(connectivityArray));
-        }
-
-        {
-          auto offsetsArray = cells->GetOffsetsArray();
-          this->queueMessage("{"
-                             "\"target\": \"cells\","
-                             "\"name\": \"offsetsArray\","
-                             "\"dataType\":"
-                             + std::to_string(VTK_ID_TYPE)
+        for(const auto &cellArray :
+            {std::make_pair(std::string("connectivityArray"),
+                            cells->GetConnectivityArray()),
+             std::make_pair(std::string("offsetsArray"),
+                            cells->GetOffsetsArray())}) {
+          this->QueueArray(std::to_string(b) + "/cells/" + cellArray.first,
+                           "{"
+                           "\"target\": \"cells\","
+                           "\"name\": \""
+                             + cellArray.first
+                             + "\","
+                               "\"dataType\":"
+                             + std::to_string(cellArray.second->GetDataType())
                              + ","
                                "\"nTuples\":"
-                             + std::to_string(offsetsArray->GetNumberOfTuples())
+                             + std::to_string(
+                               cellArray.second->GetNumberOfTuples())
                              + ","
-                               "\"nComponents\": 1"
-                               "}");
-          if(offsetsArray->GetNumberOfTuples() > 0)
-            this->queueMessage(
-              offsetsArray->GetNumberOfTuples() * sizeof(vtkIdType),
-              ttkUtils::GetVoidPointer(offsetsArray));
+                               "\"nComponents\": 1",
+                           cellArray.second);
         }
       }
     }
@@ -474,28 +727,25 @@ int ttkWebSocketIO::SendVtkDataObject(vtkDataObject *object) {
             if(dataArray == nullptr) {
               continue;
             }
-            this->queueMessage(
+            this->QueueArray(
+              std::to_string(b) + "/" + attribute.first + "/"
+                + std::string(dataArray->GetName()),
               "{"
               "\"target\":\""
-              + attribute.first
-              + "\","
-                "\"name\":\""
-              + std::string(dataArray->GetName())
-              + "\","
-                "\"dataType\":"
-              + std::to_string(dataArray->GetDataType())
-              + ","
-                "\"nTuples\":"
-              + std::to_string(dataArray->GetNumberOfTuples())
-              + ","
-                "\"nComponents\":"
-              + std::to_string(dataArray->GetNumberOfComponents()) + "}");
-            if(dataArray->GetNumberOfValues() > 0)
-              switch(dataArray->GetDataType()) {
-                vtkTemplateMacro(this->queueMessage(
-                  dataArray->GetNumberOfValues() * sizeof(VTK_TT),
-                  ttkUtils::GetVoidPointer(dataArray)));
-              }
+                + attribute.first
+                + "\","
+                  "\"name\":\""
+                + std::string(dataArray->GetName())
+                + "\","
+                  "\"dataType\":"
+                + std::to_string(dataArray->GetDataType())
+                + ","
+                  "\"nTuples\":"
+                + std::to_string(dataArray->GetNumberOfTuples())
+                + ","
+                  "\"nComponents\":"
+                + std::to_string(dataArray->GetNumberOfComponents()),
+              dataArray);
           } else if(array->IsA("vtkStringArray")) {
             auto stringArray = vtkStringArray::SafeDownCast(array);
             std::string values;
@@ -19,6 +19,16 @@
 /// connected clients every time the filter is called with a new input. When the
 /// server receives a serialized JSON object form the client, then the filter
 /// will instantiate a vtkDataObject and pass it as the filter output.
+///
+/// The client can also send its vtkDataObject with the binary protocol used
+/// by the server: a small JSON header per array, followed by the raw array
+/// values in a binary frame (enclosed by the ttk_WSIO_BeginBinarySequence and
+/// ttk_WSIO_EndBinarySequence messages). The received buffers are adopted by
+/// the vtkDataArrays of the output without copy. With SendOnlyModifiedArrays,
+/// the server only sends the values of the arrays whose MTime changed since
+/// the last message sequence fully sent to the client; the other arrays are
+/// sent as a header flagged "unchanged" that tells the client to keep its
+/// previous values.
 
 #pragma once
 
@@ -29,8 +39,13 @@
 #include <ttkAlgorithm.h>
 #include <vtkSmartPointer.h>
 
+class vtkDataArray;
 class vtkDataObject;
 class vtkMultiBlockDataSet;
+class vtkUnstructuredGrid;
+
+#include <map>
+#include <vector>
 
 // TTK Base Includes
 #include <WebSocketIO.h>
@@ -40,10 +55,28 @@ class TTKWEBSOCKETIO_EXPORT ttkWebSocketIO : public ttkAlgorithm,
 private:
   int PortNumber{9285};
   bool NeedsUpdate{false};
+  bool SendOnlyModifiedArrays{false};
 
   vtkSmartPointer<vtkDataObject> LastInput;
   vtkSmartPointer<vtkMultiBlockDataSet> LastOutput;
 
+  // MTime of the arrays of the last message sequence fully sent to the
+  // client, and of the arrays of the sequence being sent (committed once its
+  // last message is sent), guarded by the server mutex
+  std::map<std::string, vtkMTimeType> SentArrayMTimes;
+  std::map<std::string, vtkMTimeType> PendingArrayMTimes;
+
+  // state of the binary message sequence received from the client
+  struct ReceivedBlock {
+    vtkSmartPointer<vtkUnstructuredGrid> block;
+    vtkSmartPointer<vtkDataArray> offsets;
+    vtkSmartPointer<vtkDataArray> connectivity;
+  };
+  std::vector<ReceivedBlock> ReceivedBlocks;
+  std::string ReceivedHeader;
+  bool ReceivingBinarySequence{false};
+  ttk::Timer ReceiveTimer;
+
 public:
   static ttkWebSocketIO *New();
   vtkTypeMacro(ttkWebSocketIO, ttkAlgorithm);
@@ -54,8 +87,12 @@ public:
   vtkSetMacro(NeedsUpdate, bool);
   vtkGetMacro(NeedsUpdate, bool);
 
+  vtkSetMacro(SendOnlyModifiedArrays, bool);
+  vtkGetMacro(SendOnlyModifiedArrays, bool);
+
   int processEvent(const std::string &eventName,
                    const std::string &eventData = "") override;
+  int processBinaryEvent(std::string &payload) override;
 
 protected:
   ttkWebSocketIO();
@@ -70,4 +107,15 @@ protected:
 
   int SendVtkDataObject(vtkDataObject *object);
   int ParseVtkDataObjectFromJSON(const std::string &json);
+
+  int ParseBinaryHeader(const std::string &json);
+  int ParseBinaryPayload(std::string &payload);
+  int FinalizeBinarySequence();
+
+  // queue the header of an array, and its values unless the array did not
+  // change since the last message sequence fully sent
+  // (SendOnlyModifiedArrays)
+  int QueueArray(const std::string &key,
+                 const std::string &header,
+                 vtkDataArray *array);
 };
@@ -18,7 +18,9 @@
     VTK_FLOAT: 10,
     VTK_DOUBLE: 11,
     VTK_ID_TYPE: 12,
-    VTK_STRING: 13
+    VTK_STRING: 13,
+    VTK_LONG_LONG: 16,
+    VTK_UNSIGNED_LONG_LONG: 17
   };
 
   // Base Class
@@ -95,7 +97,9 @@
       return JSON.stringify(this.toJSON());
     }
 
-    static async createFromMessageSequence(msgs) {
+    // previousObjects: objects of the previous message sequence, whose arrays
+    // are reused for the headers flagged 'unchanged' by the server
+    static async createFromMessageSequence(msgs, previousObjects) {
       const objects = [];
 
       let object = null;
@@ -108,6 +112,12 @@
             object = new vtkDataSet();
             object.className = msgJSON.className;
             objects.push(object);
+          } else if (msgJSON.unchanged) {
+            const previous = previousObjects && previousObjects[objects.length-1];
+            if (previous && previous[msgJSON.target][msgJSON.name])
+              object[msgJSON.target][msgJSON.name] = previous[msgJSON.target][msgJSON.name];
+            else
+              console.error('Missing previous values of array ' + msgJSON.name);
           } else if (msgJSON.hasOwnProperty('dimension')) {
             object.dimension = msgJSON.dimension;
             object.origin = msgJSON.origin;
@@ -156,43 +166,65 @@
       return JSON.stringify(this.toJSON());
     }
 
-    static async createFromBinaryData(header, binaryData) {
-      const array = new vtkArray(
-        header.name,
-        header.nTuples,
-        header.nComponents,
-        header.dataType
-      );
-
-      const arrayBuffer = await binaryData.arrayBuffer();
-      switch (header.dataType) {
+    // typed array class matching a vtk data type (null if unsupported)
+    static getTypedArrayClass(dataType) {
+      switch (dataType) {
         case CONSTS.VTK_FLOAT:
-          array.data = new Float32Array(arrayBuffer, 0, binaryData.size/4);
-          break;
+          return Float32Array;
         case CONSTS.VTK_DOUBLE:
-          array.data = new Float64Array(arrayBuffer, 0, binaryData.size/8);
-          break;
+          return Float64Array;
         case CONSTS.VTK_LONG:
         case CONSTS.VTK_ID_TYPE:
-          array.data = new BigInt64Array(arrayBuffer, 0, binaryData.size/8);
-          break;
+        case CONSTS.VTK_LONG_LONG:
+          return BigInt64Array;
+        case CONSTS.VTK_UNSIGNED_LONG:
+        case CONSTS.VTK_UNSIGNED_LONG_LONG:
+          return BigUint64Array;
         case CONSTS.VTK_CHAR:
         case CONSTS.VTK_SIGNED_CHAR:
-          array.data = new Int8Array(arrayBuffer, 0, binaryData.size);
-          break;
+          return Int8Array;
         case CONSTS.VTK_UNSIGNED_CHAR:
-          array.data = new Uint8Array(arrayBuffer, 0, binaryData.size);
-          break;
+          return Uint8Array;
+        case CONSTS.VTK_SHORT:
+          return Int16Array;
+        case CONSTS.VTK_UNSIGNED_SHORT:
+          return Uint16Array;
         case CONSTS.VTK_INT:
-          array.data = new Int32Array(arrayBuffer, 0, binaryData.size/4);
-          break;
+          return Int32Array;
         case CONSTS.VTK_UNSIGNED_INT:
-          array.data = new Uint32Array(arrayBuffer, 0, binaryData.size/4);
-          break;
+          return Uint32Array;
         default:
-          console.error('Unsupported Data Type');
           return null;
       }
+    }
+
+    // values of the array as a typed array (without copy if possible)
+    toTypedArray() {
+      const TypedArray = vtkArray.getTypedArrayClass(this.dataType);
+      if (TypedArray === null || this.data instanceof TypedArray)
+        return this.data;
+      if (TypedArray === BigInt64Array || TypedArray === BigUint64Array)
+        return TypedArray.from(this.data, v=>BigInt(v));
+      return TypedArray.from(this.data);
+    }
+
+    static async createFromBinaryData(header, binaryData) {
+      const array = new vtkArray(
+        header.name,
+        header.nTuples,
+        header.nComponents,
+        header.dataType
+      );
+
+      const TypedArray = vtkArray.getTypedArrayClass(header.dataType);
+      if (TypedArray === null) {
+        console.error('Unsupported Data Type');
+        return null;
+      }
+
+      const arrayBuffer = await binaryData.arrayBuffer();
+      array.data = new TypedArray(
+        arrayBuffer, 0, binaryData.size/TypedArray.BYTES_PER_ELEMENT);
 
       return array;
     }
@@ -278,6 +310,40 @@
       this.sendString(JSON.stringify({
         "vtkDataSet": object.toJSON()}));
     }
+
+    // send the object as a sequence of array headers and binary frames, which
+    // the server adopts without parsing or copying the values
+    sendVTKDataSetBinary(object) {
+      if (!(object instanceof vtkDataSet)) {
+        console.error("Input is not a vtkDataSet");
+        return 0;
+      }
+
+      this.sendString('ttk_WSIO_BeginBinarySequence');
+      this.sendString(JSON.stringify({className: object.className}));
+      for (let target of ['points', 'cells', 'pointData', 'cellData', 'fieldData']) {
+        for (let name of Object.keys(object[target])) {
+          const array = object[target][name];
+          const header = {
+            target: target,
+            name: name,
+            dataType: array.dataType,
+            nTuples: array.nTuples,
+            nComponents: array.nComponents
+          };
+          if (array.dataType === CONSTS.VTK_STRING) {
+            header.data = array.data.join(',');
+            this.sendString(JSON.stringify(header));
+            continue;
+          }
+          const values = array.toTypedArray();
+          this.sendString(JSON.stringify(header));
+          if (array.nTuples * array.nComponents > 0)
+            this.sendString(values);
+        }
+      }
+      this.sendString('ttk_WSIO_EndBinarySequence');
+    }
   }
 
   if (!window.hasOwnProperty('TTK'))